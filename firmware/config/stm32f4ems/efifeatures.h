@@ -313,6 +313,12 @@
 #define EFI_CAN_SUPPORT TRUE
 #endif
 
+// program CAN acceptance filters from registered listeners, where the port supports it
+// off until validated on boards, a missing filter silently drops frames
+#ifndef EFI_CAN_HW_FILTERS
+#define EFI_CAN_HW_FILTERS FALSE
+#endif
+
 #if !defined(EFI_CAN_SERIAL) && EFI_CAN_SUPPORT
 #define EFI_CAN_SERIAL TRUE
 #endif
@@ -365,6 +371,14 @@
 #define EFI_FILE_LOGGING TRUE
 #endif
 
+/**
+ * Log to SD card as .mld: only changed fields, LZ compressed. Several times smaller than plain MLG,
+ * needs misc/mlg_delta_decoder before TS/MLV can open it. Costs about 12K of RAM.
+ */
+#ifndef EFI_MLG_DELTA_LOG
+#define EFI_MLG_DELTA_LOG FALSE
+#endif
+
 #ifndef EFI_EMBED_INI_MSD
 #define EFI_EMBED_INI_MSD TRUE
 #endif
@@ -415,6 +429,11 @@
 #define EFI_LUA_LOOKUP TRUE
 #endif
 
+// keep compiled Lua script in storage so that boot does not have to parse it
+#ifndef EFI_LUA_BYTECODE_STORAGE
+#define EFI_LUA_BYTECODE_STORAGE TRUE
+#endif
+
 #ifndef EFI_ENGINE_SNIFFER
 #define EFI_ENGINE_SNIFFER TRUE
 #endif
@@ -44,3 +44,4 @@ decl_frag<long_term_fuel_trim_state_s>{},
 decl_frag<short_term_fuel_trim_state_s>{},
 decl_frag<vvl_controller_state_s>{},
 decl_frag<live_data_rotational_idle_s>{},
+decl_frag<lua_state_s>{},
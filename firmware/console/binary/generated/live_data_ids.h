@@ -48,6 +48,7 @@ LDS_long_term_fuel_trim_state,
 LDS_short_term_fuel_trim_state,
 LDS_vvl_controller_state,
 LDS_live_data_rotational_idle,
+LDS_lua_state,
 } live_data_e;
 #define OUTPUT_CHANNELS_BASE_ADDRESS 0
 #define FUEL_COMPUTER_BASE_ADDRESS 884
@@ -87,3 +88,4 @@ LDS_live_data_rotational_idle,
 #define SHORT_TERM_FUEL_TRIM_STATE_BASE_ADDRESS 2060
 #define VVL_CONTROLLER_STATE_BASE_ADDRESS 2076
 #define LIVE_DATA_ROTATIONAL_IDLE_BASE_ADDRESS 2080
+#define LUA_STATE_BASE_ADDRESS 2084
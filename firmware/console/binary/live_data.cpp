@@ -12,6 +12,7 @@
 #include "closed_loop_idle_generated.h"
 #include "vvt_generated.h"
 #include "mc33810_state_generated.h"
+#include "lua_heap.h"
 #include <livedata_board_extra.h>
 
 template<>
@@ -327,4 +328,13 @@ const live_data_rotational_idle_s* getLiveData(size_t) {
 #else
 	return nullptr;
 #endif
-}
\ No newline at end of file
+}
+
+template<>
+const lua_state_s* getLiveData(size_t) {
+#if EFI_LUA
+	return &getLuaState();
+#else
+	return nullptr;
+#endif
+}
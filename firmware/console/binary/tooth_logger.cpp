@@ -80,16 +80,19 @@ void DisableToothLogger() {
 
 #else // not EFI_UNIT_TEST
 
-static constexpr size_t BUFFER_COUNT = BIG_BUFFER_SIZE / sizeof(CompositeBuffer);
-static_assert(BUFFER_COUNT >= 2);
+#include "spsc_ring.h"
 
-static CompositeBuffer* buffers = nullptr;
-static chibios_rt::Mailbox<CompositeBuffer*, BUFFER_COUNT> freeBuffers CCM_OPTIONAL;
-static chibios_rt::Mailbox<CompositeBuffer*, BUFFER_COUNT> filledBuffers CCM_OPTIONAL;
+static SpscRing<composite_logger_s> toothRing;
 
-static CompositeBuffer* currentBuffer = nullptr;
+// set once the ring has enough entries for a read, cleared once the reader has drained it
+static volatile bool toothLogReady = false;
+// time of the oldest unread entry, so that the user sees *something* even without many trigger events
+static Timer oldestEntryTime;
+
+static chibios_rt::BinarySemaphore toothLogReadySem(/* taken =*/ true);
 
 static void setToothLogReady(bool value) {
+	toothLogReady = value;
 #if EFI_TUNER_STUDIO && (EFI_PROD_CODE || EFI_SIMULATOR)
 	engine->outputChannels.toothLogReady = value;
 #endif // EFI_TUNER_STUDIO
@@ -97,31 +100,37 @@ static void setToothLogReady(bool value) {
 
 static BigBufferHandle bufferHandle;
 
+// set while the reader holds entries returned by GetToothLoggerData*, until ConsumeToothLoggerData
+static bool toothReaderBusy = false;
+// the ring and the buffer are released/reset by the reader once it's done with the entries it holds
+static bool toothBufferReleasePending = false;
+static bool toothRingResetPending = false;
+
+static void releaseToothLoggerBuffer() {
+	// Release the big buffer for another user
+	// C++ magic: here we are calling BigBufferHandle::operator=() with empty instance
+	bufferHandle = {};
+	toothRing.init(nullptr, 0);
+}
+
 void EnableToothLogger() {
 	chibios_rt::CriticalSectionLocker csl;
 
-	bufferHandle = getBigBuffer(BigBufferUser::ToothLogger);
-	if (!bufferHandle) {
-		return;
-	}
-
-	buffers = bufferHandle.get<CompositeBuffer>();
+	toothBufferReleasePending = false;
 
-	// Reset all buffers
-	for (size_t i = 0; i < BUFFER_COUNT; i++) {
-		buffers[i].nextIdx = 0;
+	if (!bufferHandle) {
+		bufferHandle = getBigBuffer(BigBufferUser::ToothLogger);
+		if (!bufferHandle) {
+			return;
+		}
 	}
 
-	// Reset state
-	currentBuffer = nullptr;
-
-	// Empty the filled buffer list
-	CompositeBuffer* dummy;
-	while (MSG_TIMEOUT != filledBuffers.fetchI(&dummy)) ;
-
-	// Put all buffers in the free list
-	for (size_t i = 0; i < BUFFER_COUNT; i++) {
-		freeBuffers.postI(&buffers[i]);
+	// Reset state, everything not yet read is dropped
+	if (toothReaderBusy) {
+		// ...once the reader is done with what it holds
+		toothRingResetPending = true;
+	} else {
+		toothRing.init(bufferHandle.get<composite_logger_s>(), bufferHandle.size() / sizeof(composite_logger_s));
 	}
 
 	// Reset the last edge to now - this prevents the first edge logged from being bogus
@@ -136,120 +145,107 @@ void EnableToothLogger() {
 void DisableToothLogger() {
 	chibios_rt::CriticalSectionLocker csl;
 
+	if (ToothLoggerEnabled && toothRing.getOverrunCount() != 0) {
+		efiPrintf("Tooth logger dropped %d entries", (int)toothRing.getOverrunCount());
+	}
+
 	ToothLoggerEnabled = false;
 	setToothLogReady(false);
+	toothRingResetPending = false;
 
-	// Release the big buffer for another user
-	// C++ magic: here we are calling BigBufferHandle::operator=() with empty instance
-	bufferHandle = {};
-	buffers = nullptr;
-}
-
-static CompositeBuffer* GetToothLoggerBufferImpl(sysinterval_t timeout) {
-	CompositeBuffer* buffer;
-	msg_t msg = filledBuffers.fetch(&buffer, timeout);
-
-	if (msg == MSG_TIMEOUT) {
-		setToothLogReady(false);
-		return nullptr;
-	}
-
-	if (msg != MSG_OK) {
-		// What even happened if we didn't get timeout, but also didn't get OK?
-		return nullptr;
+	if (toothReaderBusy) {
+		// SD/TS reader may be writing out entries straight from the buffer, it releases the buffer on consume
+		toothBufferReleasePending = true;
+	} else {
+		releaseToothLoggerBuffer();
 	}
+}
 
+static size_t peekToothLoggerData(const composite_logger_s** entries, size_t maxCount) {
 	chibios_rt::CriticalSectionLocker csl;
 
-	// If the used list is empty, clear the ready flag
-	if (filledBuffers.getUsedCountI() == 0) {
-		setToothLogReady(false);
-	}
-
-	return buffer;
-}
-
-CompositeBuffer* GetToothLoggerBufferNonblocking() {
-	return GetToothLoggerBufferImpl(TIME_IMMEDIATE);
+	size_t count = toothRing.peek(entries, maxCount);
+	toothReaderBusy = count != 0;
+	return count;
 }
 
-CompositeBuffer* GetToothLoggerBufferBlocking() {
-	return GetToothLoggerBufferImpl(TIME_INFINITE);
+size_t GetToothLoggerDataNonblocking(const composite_logger_s** entries, size_t maxCount) {
+	return peekToothLoggerData(entries, maxCount);
 }
 
-void ReturnToothLoggerBuffer(CompositeBuffer* buffer) {
-	chibios_rt::CriticalSectionLocker csl;
+size_t GetToothLoggerDataBlocking(const composite_logger_s** entries, size_t maxCount) {
+	// Wait for a chunk worth reading instead of waking up for every tooth
+	while (!toothLogReady) {
+		toothLogReadySem.wait();
+	}
 
-	msg_t msg = freeBuffers.postI(buffer);
-	criticalAssertVoid(msg == MSG_OK, "Composite logger post to free buffer fail");
+	return peekToothLoggerData(entries, maxCount);
 }
 
-static CompositeBuffer* findBuffer(efitick_t timestamp) {
-	CompositeBuffer* buffer;
+void ConsumeToothLoggerData(size_t count) {
+	chibios_rt::CriticalSectionLocker csl;
 
-	if (!currentBuffer) {
-		// try and find a buffer, if none available, we can't log
-		if (MSG_OK != freeBuffers.fetchI(&buffer)) {
-			return nullptr;
-		}
+	toothRing.consume(count);
+	toothReaderBusy = false;
 
-		// Record the time of the last buffer swap so we can force a swap after a minimum period of time
-		// This ensures the user sees *something* even if they don't have enough trigger events
-		// to fill the buffer.
-		buffer->startTime.reset(timestamp);
-		buffer->nextIdx = 0;
+	// Disable/Enable arrived while the reader was busy, act on it now
+	if (toothBufferReleasePending) {
+		toothBufferReleasePending = false;
+		releaseToothLoggerBuffer();
+	} else if (toothRingResetPending) {
+		toothRingResetPending = false;
+		toothRing.reset();
+	}
 
-		currentBuffer = buffer;
+	// If the ring is drained, clear the ready flag
+	if (toothRing.isEmpty()) {
+		setToothLogReady(false);
 	}
+}
 
-	return currentBuffer;
+uint32_t GetToothLoggerOverrunCount() {
+	return toothRing.getOverrunCount();
 }
 
 static void SetNextCompositeEntry(efitick_t timestamp) {
-	// This is called from multiple interrupts/threads, so we need a lock.
+	// This is called from multiple interrupts/threads: the lock makes us the single producer of the ring.
 	chibios_rt::CriticalSectionLocker csl;
 
-	CompositeBuffer* buffer = findBuffer(timestamp);
-
-	if (!buffer) {
-		// All buffers are full, nothing to do here.
-		return;
+	if (toothRing.isEmpty()) {
+		oldestEntryTime.reset(timestamp);
 	}
 
-	size_t idx = buffer->nextIdx;
-	auto nextIdx = idx + 1;
-	buffer->nextIdx = nextIdx;
+	composite_logger_s entry;
 
-	if (idx < efi::size(buffer->buffer)) {
-		composite_logger_s* entry = &buffer->buffer[idx];
+	uint32_t nowUs = NT2US(timestamp);
 
-		uint32_t nowUs = NT2US(timestamp);
+	// TS uses big endian, grumble
+	entry.timestamp = SWAP_UINT32(nowUs);
+	entry.priLevel = currentTrigger1;
+	entry.secLevel = currentTrigger2;
+	entry.trigger = currentTdc;
+	entry.sync = engine->triggerCentral.triggerState.getShaftSynchronized();
+	entry.coil = currentCoilState;
+	entry.injector = currentInjectorState;
 
-		// TS uses big endian, grumble
-		entry->timestamp = SWAP_UINT32(nowUs);
-		entry->priLevel = currentTrigger1;
-		entry->secLevel = currentTrigger2;
-		entry->trigger = currentTdc;
-		entry->sync = engine->triggerCentral.triggerState.getShaftSynchronized();
-		entry->coil = currentCoilState;
-		entry->injector = currentInjectorState;
+	if (!toothRing.push(entry)) {
+		// Ring is full, reader is too slow. The entry is counted as an overrun.
+		return;
 	}
 
-	// if the buffer is full...
-	bool bufferFull = nextIdx >= efi::size(buffer->buffer);
-	// ... or it's been too long since the last flush
-	bool bufferTimedOut = buffer->startTime.hasElapsedSec(5);
-
-	// Then cycle buffers and set the ready flag.
-	if (bufferFull || bufferTimedOut) {
-		// Post to the output queue
-		filledBuffers.postI(buffer);
+	if (toothLogReady) {
+		return;
+	}
 
-		// Null the current buffer so we get a new one next time
-		currentBuffer = nullptr;
+	// if there's enough to read...
+	bool enoughEntries = toothRing.size() >= toothLoggerReadyEntries;
+	// ... or it's been too long since the oldest entry
+	bool timedOut = oldestEntryTime.hasElapsedSec(5);
 
-		// Flag that we are ready
+	// Then set the ready flag and wake up the blocking reader.
+	if (enoughEntries || timedOut) {
 		setToothLogReady(true);
+		toothLogReadySem.signalI();
 	}
 }
 
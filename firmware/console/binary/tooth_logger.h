@@ -22,7 +22,7 @@ void EnableToothLoggerIfNotEnabled();
 // Enable the tooth logger - this clears the buffer starts logging
 void EnableToothLogger();
 
-// Stop logging - leave buffer intact
+// Stop logging - big buffer is released once the reader has consumed the entries it holds
 void DisableToothLogger();
 
 bool IsToothLoggerEnabled();
@@ -49,21 +49,22 @@ typedef struct __attribute__ ((packed)) {
 	bool injector : 1;
 } composite_logger_s;
 
-static constexpr size_t toothLoggerEntriesPerBuffer = 250;
+// toothLogReady is set once this many entries are waiting to be read
+static constexpr size_t toothLoggerReadyEntries = 250;
 
-struct CompositeBuffer {
-	composite_logger_s buffer[toothLoggerEntriesPerBuffer];
-	size_t nextIdx;
-	Timer startTime;
-};
+// Logged entries are kept in a ring over the big buffer, readers stream them out in chunks of any size:
+// get the oldest unread entries, send/write them, then consume as many as were actually used.
 
-// Get a reference to the buffer
-// Returns nullptr if no buffer is available
-CompositeBuffer* GetToothLoggerBufferNonblocking();
-// Blocks until a buffer is available
-CompositeBuffer* GetToothLoggerBufferBlocking();
+// Returns number of unread entries in one contiguous run starting at *entries, at most maxCount
+// Returns zero if nothing was logged since last read
+size_t GetToothLoggerDataNonblocking(const composite_logger_s** entries, size_t maxCount);
+// Blocks until toothLogReady
+size_t GetToothLoggerDataBlocking(const composite_logger_s** entries, size_t maxCount);
 
-// Return a buffer to the pool once its contents have been read
-void ReturnToothLoggerBuffer(CompositeBuffer*);
+// Release entries once they have been read, every non-empty Get has to be followed by a Consume
+void ConsumeToothLoggerData(size_t count);
+
+// Number of entries dropped because the reader did not keep up, since the logger was enabled
+uint32_t GetToothLoggerOverrunCount();
 
 #include "big_buffer.h"
@@ -0,0 +1,106 @@
+/**
+ * @file ts_scatter_plan.cpp
+ */
+
+#include "pch.h"
+
+#include "ts_scatter_plan.h"
+
+void TsScatterPlan::build(const uint16_t* packedOffsets, size_t entryCount, FragmentList fragments) {
+	m_spanCount = 0;
+	m_totalSize = 0;
+
+	for (size_t i = 0; i < entryCount; i++) {
+		uint16_t packed = packedOffsets[i];
+		uint16_t type = packed >> 13;
+		uint16_t offset = packed & 0x1FFF;
+
+		if (type == 0)
+			continue;
+		size_t size = 1 << (type - 1);
+
+		addRange(offset, size, fragments);
+	}
+
+	m_isValid = true;
+}
+
+void TsScatterPlan::addRange(size_t offset, size_t size, FragmentList fragments) {
+	m_totalSize += size;
+
+	if (m_spanCount > 0 && offset == m_lastEnd) {
+		Span& last = m_spans[m_spanCount - 1];
+
+		// Previous span stays a plain copy only while still within the same fragment
+		bool canGrow = last.fragment == crossesFragments
+			|| last.offset + last.size + size <= fragments.fragments[last.fragment].size;
+
+		if (canGrow) {
+			last.size += size;
+			m_lastEnd += size;
+			return;
+		}
+	}
+
+	// Each scatter entry adds at most one span
+	criticalAssertVoid(m_spanCount < efi::size(m_spans), "scatter plan overflow");
+	Span& span = m_spans[m_spanCount++];
+	m_lastEnd = offset + size;
+
+	// Find the fragment holding the start of the range
+	size_t fragmentStart = 0;
+	for (size_t fragment = 0; fragment < fragments.count; fragment++) {
+		size_t fragmentSize = fragments.fragments[fragment].size;
+
+		if (offset < fragmentStart + fragmentSize) {
+			if (offset + size <= fragmentStart + fragmentSize && fragment < crossesFragments) {
+				span.fragment = fragment;
+				span.offset = offset - fragmentStart;
+				span.size = size;
+				return;
+			}
+
+			break;
+		}
+
+		fragmentStart += fragmentSize;
+	}
+
+	// Crosses fragments or past the end of live data
+	span.fragment = crossesFragments;
+	span.offset = offset;
+	span.size = size;
+}
+
+size_t TsScatterPlan::copy(uint8_t* destination, FragmentList fragments, size_t skip, size_t size) const {
+	size_t copied = 0;
+
+	for (size_t i = 0; i < m_spanCount && copied < size; i++) {
+		const Span& span = m_spans[i];
+
+		if (skip >= span.size) {
+			skip -= span.size;
+			continue;
+		}
+
+		size_t chunk = minI(span.size - skip, size - copied);
+
+		if (span.fragment == crossesFragments) {
+			copyRange(destination + copied, fragments, span.offset + skip, chunk);
+		} else {
+			const uint8_t* data = fragments.fragments[span.fragment].get();
+
+			if (data) {
+				memcpy(destination + copied, data + span.offset + skip, chunk);
+			} else {
+				// fragment not available right now, same as copyRange
+				memset(destination + copied, 0, chunk);
+			}
+		}
+
+		copied += chunk;
+		skip = 0;
+	}
+
+	return copied;
+}
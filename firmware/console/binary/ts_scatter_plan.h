@@ -0,0 +1,64 @@
+/**
+ * @file ts_scatter_plan.h
+ *
+ * TS scattered read ("high speed offsets") decoded once when the offsets change instead of on every read.
+ * Ranges which follow each other in live data are merged, each merged range is resolved to the
+ * live data fragment holding it so that it can be copied with a single memcpy.
+ */
+
+#pragma once
+
+#include <rusefi/fragments.h>
+
+class TsScatterPlan {
+public:
+	/**
+	 * @param packedOffsets TS scatter list: top 3 bits size code, low 13 bits offset within live data
+	 */
+	void build(const uint16_t* packedOffsets, size_t entryCount, FragmentList fragments);
+
+	// offsets have changed, build() is needed before next use
+	void invalidate() {
+		m_isValid = false;
+	}
+
+	bool isValid() const {
+		return m_isValid;
+	}
+
+	// total response payload size
+	size_t getTotalSize() const {
+		return m_totalSize;
+	}
+
+	size_t getSpanCount() const {
+		return m_spanCount;
+	}
+
+	/**
+	 * Copy `size` bytes of the response payload in to destination, skipping the first `skip` bytes
+	 * Same contract as copyRange, fragments have to be the ones the plan was built with.
+	 * @return number of bytes copied
+	 */
+	size_t copy(uint8_t* destination, FragmentList fragments, size_t skip, size_t size) const;
+
+private:
+	struct Span {
+		// offset within fragment, or within whole live data for spans crossing fragments
+		uint16_t offset;
+		uint16_t size;
+		uint8_t fragment;
+	};
+
+	// span is not within a single fragment, fall back to copyRange
+	static constexpr uint8_t crossesFragments = 0xFF;
+
+	void addRange(size_t offset, size_t size, FragmentList fragments);
+
+	Span m_spans[TS_SCATTER_OFFSETS_COUNT];
+	size_t m_spanCount = 0;
+	size_t m_totalSize = 0;
+	// last merged range, in whole live data offsets
+	size_t m_lastEnd = 0;
+	bool m_isValid = false;
+};
@@ -356,6 +356,17 @@ void TunerStudio::handleWriteChunkCommand(TsChannelBase* tsChannel, uint16_t pag
 		memcpy(addr, content, count);
 	}
 
+#if EFI_TS_SCATTER
+	if (page == TS_PAGE_SCATTER_OFFSETS) {
+		tsChannel->scatterPlan.invalidate();
+	}
+#endif // EFI_TS_SCATTER
+#if EFI_LTFT_CONTROL
+	if (page == TS_PAGE_LTFT_TRIMS) {
+		ltftOnTsWrite(offset, count);
+	}
+#endif // EFI_LTFT_CONTROL
+
 	sendOkResponse(tsChannel);
 }
 
@@ -385,46 +396,40 @@ void TunerStudio::handleCrc32Check(TsChannelBase *tsChannel, uint16_t page, uint
 void TunerStudio::handleScatteredReadCommand(TsChannelBase* tsChannel) {
 	tsState.readScatterCommandsCounter++;
 
-	int totalResponseSize = 0;
-	for (size_t i = 0; i < TS_SCATTER_OFFSETS_COUNT; i++) {
-		uint16_t packed = tsChannel->page1.highSpeedOffsets[i];
-		uint16_t type = packed >> 13;
+	FragmentList fragments = getLiveDataFragments();
 
-		size_t size = type == 0 ? 0 : 1 << (type - 1);
-#if EFI_SIMULATOR
-//		printf("handleScatteredReadCommand 0x%x %d %d\n", packed, size, offset);
-#endif /* EFI_SIMULATOR */
-		totalResponseSize += size;
+	TsScatterPlan& plan = tsChannel->scatterPlan;
+	if (!plan.isValid()) {
+		plan.build(tsChannel->page1.highSpeedOffsets, TS_SCATTER_OFFSETS_COUNT, fragments);
+	}
+
+	size_t totalResponseSize = plan.getTotalSize();
+	uint8_t* scratchBuffer = reinterpret_cast<uint8_t*>(tsChannel->scratchBuffer);
+
+	if (totalResponseSize + TS_PACKET_HEADER_SIZE + TS_PACKET_TAIL_SIZE <= sizeof(tsChannel->scratchBuffer)) {
+		// Snapshot the whole payload so that CRC matches what is sent even if live data
+		// changes meanwhile, then a single CRC pass and a single write for the whole packet
+		plan.copy(scratchBuffer + TS_PACKET_HEADER_SIZE, fragments, 0, totalResponseSize);
+		tsChannel->crcAndWriteBuffer(TS_RESPONSE_OK, totalResponseSize);
+		return;
 	}
-#if EFI_SIMULATOR
-//	printf("totalResponseSize %d\n", totalResponseSize);
-#endif /* EFI_SIMULATOR */
 
 	// Command part of CRC
 	uint32_t crc = tsChannel->writePacketHeader(TS_RESPONSE_OK, totalResponseSize);
 
-	uint8_t dataBuffer[8];
-	for (size_t i = 0; i < TS_SCATTER_OFFSETS_COUNT; i++) {
-		uint16_t packed = tsChannel->page1.highSpeedOffsets[i];
-		uint16_t type = packed >> 13;
-		uint16_t offset = packed & 0x1FFF;
+	size_t offset = 0;
+	while (offset < totalResponseSize) {
+		size_t chunkSize = minI(totalResponseSize - offset, sizeof(tsChannel->scratchBuffer));
 
-		if (type == 0)
-			continue;
-		size_t size = 1 << (type - 1);
+		// write each chunk and CRC incrementally
+		size_t actualSize = plan.copy(scratchBuffer, fragments, offset, chunkSize);
+		crc = tsChannel->writePacketBody(scratchBuffer, actualSize, crc);
 
-		// write each data point and CRC incrementally
-		copyRange(dataBuffer, getLiveDataFragments(), offset, size);
-		tsChannel->write(dataBuffer, size, false);
-		crc = crc32inc((void*)dataBuffer, crc, size);
+		offset += chunkSize;
 	}
-#if EFI_SIMULATOR
-//	printf("CRC %x\n", crc);
-#endif /* EFI_SIMULATOR */
+
 	// now write total CRC
-	*(uint32_t*)dataBuffer = SWAP_UINT32(crc);
-	tsChannel->write(dataBuffer, 4, true);
-	tsChannel->flush();
+	tsChannel->writeCrcPacketTail(crc);
 }
 #endif // EFI_TS_SCATTER
 
@@ -523,6 +528,7 @@ static bool isKnownCommand(char command) {
 			|| command == TS_GET_FIRMWARE_VERSION
 			|| command == TS_PERF_TRACE_BEGIN
 			|| command == TS_PERF_TRACE_GET_BUFFER
+			|| command == TS_PERF_STATS_GET_BUFFER
 			|| command == TS_GET_CONFIG_ERROR
 			|| command == TS_QUERY_BOOTLOADER;
 }
@@ -848,6 +854,24 @@ static void handleGetImageCommand(TsChannelBase* tsChannel, size_t offset32, int
 #endif // EFI_PROD_CODE
 }
 
+#if EFI_TOOTH_LOGGER
+static void sendToothLoggerData(TsChannelBase* tsChannel) {
+	const composite_logger_s* entries;
+	// Whatever was logged since last read, up to the ini blockingFactor per response: small transport
+	// buffers can't take more. The rest stays in the ring for the next poll
+	size_t count = GetToothLoggerDataNonblocking(&entries, BLOCKING_FACTOR / sizeof(composite_logger_s));
+
+	if (count) {
+		tsChannel->sendResponse(TS_CRC, reinterpret_cast<const uint8_t*>(entries), count * sizeof(composite_logger_s), true);
+
+		ConsumeToothLoggerData(count);
+	} else {
+		// TS asked for tooth logger data, but we don't have any to give it.
+		sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE, DO_NOT_LOG);
+	}
+}
+#endif // EFI_TOOTH_LOGGER
+
 int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int incomingPacketSize) {
 	ScopePerf perf(PE::TunerStudioHandleCrcCommand);
 
@@ -979,18 +1003,7 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 			DisableToothLogger();
 			break;
 		case TS_COMPOSITE_READ:
-			{
-				auto toothBuffer = GetToothLoggerBufferNonblocking();
-
-				if (toothBuffer) {
-					tsChannel->sendResponse(TS_CRC, reinterpret_cast<const uint8_t*>(toothBuffer->buffer), toothBuffer->nextIdx * sizeof(composite_logger_s), true);
-
-					ReturnToothLoggerBuffer(toothBuffer);
-				} else {
-					// TS asked for a tooth logger buffer, but we don't have one to give it.
-					sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE, DO_NOT_LOG);
-				}
-			}
+			sendToothLoggerData(tsChannel);
 			break;
 #ifdef TRIGGER_SCOPE
 		case TS_TRIGGER_SCOPE_ENABLE:
@@ -1024,16 +1037,7 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 		{
 			EnableToothLoggerIfNotEnabled();
 
-			auto toothBuffer = GetToothLoggerBufferNonblocking();
-
-			if (toothBuffer) {
-				tsChannel->sendResponse(TS_CRC, reinterpret_cast<const uint8_t*>(toothBuffer->buffer), toothBuffer->nextIdx * sizeof(composite_logger_s), true);
-
-				ReturnToothLoggerBuffer(toothBuffer);
-			} else {
-				// TS asked for a tooth logger buffer, but we don't have one to give it.
-				sendErrorCode(tsChannel, TS_RESPONSE_OUT_OF_RANGE, DO_NOT_LOG);
-			}
+			sendToothLoggerData(tsChannel);
 		}
 
 		break;
@@ -1053,6 +1057,12 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 			tsChannel->sendResponse(TS_CRC, trace.get<uint8_t>(), trace.size(), true);
 		}
 
+		break;
+	case TS_PERF_STATS_GET_BUFFER:
+		// Statistics since previous request. No snapshot copy: an entry updated while being sent
+		// could be off by one interval, that's cheaper than another copy of the whole table
+		tsChannel->sendResponse(TS_CRC, reinterpret_cast<const uint8_t*>(perfStatsGet()), sizeof(PerfStatsEntry) * static_cast<size_t>(PE::Count), true);
+		perfStatsReset();
 		break;
 #else
 	case TS_PERF_TRACE_BEGIN:
@@ -1061,6 +1071,9 @@ int TunerStudio::handleCrcCommand(TsChannelBase* tsChannel, char *data, int inco
 	case TS_PERF_TRACE_GET_BUFFER:
 		criticalError("TS_PERF_TRACE_GET_BUFFER not supported");
 		break;
+	case TS_PERF_STATS_GET_BUFFER:
+		criticalError("TS_PERF_STATS_GET_BUFFER not supported");
+		break;
 #endif /* ENABLE_PERF_TRACE */
 	case TS_QUERY_BOOTLOADER: {
 		uint8_t bldata = TS_QUERY_BOOTLOADER_NONE;
@@ -10,6 +10,7 @@
 #include "global.h"
 #include "tunerstudio_impl.h"
 #include "page_1_generated.h"
+#include "ts_scatter_plan.h"
 
 #if EFI_USB_SERIAL
 #include "usbconsole.h"
@@ -64,6 +65,8 @@ public:
 	char scratchBuffer[scratchBuffer_SIZE + 30];
 #if EFI_TS_SCATTER
 	page1_s page1;
+	// decoded page1.highSpeedOffsets
+	TsScatterPlan scatterPlan;
 #endif
 	const char *name;
 
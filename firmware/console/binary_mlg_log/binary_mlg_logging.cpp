@@ -17,6 +17,10 @@
 #include "tunerstudio.h"
 #include "board_lookup.h"
 
+#if EFI_MLG_DELTA_LOG
+#include "mlg_delta.h"
+#endif // EFI_MLG_DELTA_LOG
+
 #if EFI_FILE_LOGGING || EFI_UNIT_TEST
 
 #define TIME_PRECISION 1000
@@ -53,11 +57,37 @@ static uint64_t binaryLogCount = 0;
 
 static const uint16_t recordLength = computeFieldsRecordLength();
 
+#if EFI_MLG_DELTA_LOG
+// raw records are collected here before compression, bigger blocks compress better
+#ifndef MLG_DELTA_BLOCK_SIZE
+#define MLG_DELTA_BLOCK_SIZE 8192
+#endif
+
+#ifndef MLG_DELTA_MAX_RECORD_SIZE
+#define MLG_DELTA_MAX_RECORD_SIZE 2048
+#endif
+
+static uint8_t deltaBlock[MLG_DELTA_BLOCK_SIZE];
+static uint8_t deltaPrevious[MLG_DELTA_MAX_RECORD_SIZE];
+static Delta::Encoder deltaEncoder(deltaBlock, sizeof(deltaBlock), deltaPrevious, sizeof(deltaPrevious));
+static bool deltaEncoderReady = false;
+#endif // EFI_MLG_DELTA_LOG
+
 static size_t writeFileHeader(Writer& outBuffer) {
 	size_t writen = 0;
 	char buffer[Types::Header::Size];
+#if EFI_MLG_DELTA_LOG
+	// File format: MLVLD\0
+	strncpy(buffer, Delta::magic, 6);
+
+	deltaEncoderReady = deltaEncoder.reset(efi::size(fields), recordLength);
+	if (!deltaEncoderReady) {
+		criticalError("MLG delta log buffers too small for %d byte records", recordLength);
+	}
+#else
 	// File format: MLVLG\0
 	strncpy(buffer, "MLVLG", 6);
+#endif // EFI_MLG_DELTA_LOG
 
 	// Format version = 02
 	buffer[6] = 0;
@@ -109,28 +139,41 @@ static size_t writeSdBlock(Writer& outBuffer) {
 	size_t writen = 0;
 	static char buffer[16];
 
+	// Timestamp at 10us resolution
+	efitimeus_t nowUs = getTimeNowUs();
+	uint16_t timestamp = nowUs / 10;
+
+#if EFI_MLG_DELTA_LOG
+	if (!deltaEncoderReady) {
+		return 0;
+	}
+
+	// Block type, rolling counter and checksum are implied, see mlg_delta.h
+	writen += deltaEncoder.beginRecord(timestamp, outBuffer);
+#else
 	// Offset 0 = Block type, standard data block in this case
 	buffer[0] = 0;
 
 	// Offset 1 = rolling counter sequence number
 	buffer[1] = blockRollCounter++;
 
-	// Offset 2, size 2 = Timestamp at 10us resolution
-	efitimeus_t nowUs = getTimeNowUs();
-	uint16_t timestamp = nowUs / 10;
+	// Offset 2, size 2 = Timestamp
 	buffer[2] = timestamp >> 8;
 	buffer[3] = timestamp & 0xFF;
 
 	// TODO: check ret value!
 	outBuffer.write(buffer, 4);
 	writen += 4;
+#endif // EFI_MLG_DELTA_LOG
 
 	// todo: add a log field for SD card period
 	// revSdCardLineTime = nowUs;
 
 	packedTime = getTimeNowMs() * 1.0 / TIME_PRECISION;
 
+#if !EFI_MLG_DELTA_LOG
 	uint8_t sum = 0;
+#endif // EFI_MLG_DELTA_LOG
 	for (size_t fieldIndex = 0; fieldIndex < efi::size(fields); fieldIndex++) {
 		#if EFI_UNIT_TEST
 			if (engine == nullptr) {
@@ -161,6 +204,9 @@ static size_t writeSdBlock(Writer& outBuffer) {
 
 		size_t entrySize = fields[fieldIndex].writeData(buffer, offset);
 
+#if EFI_MLG_DELTA_LOG
+		deltaEncoder.addField(buffer, entrySize);
+#else
 		for (size_t byteIndex = 0; byteIndex < entrySize; byteIndex++) {
 			// "CRC" at the end is just the sum of all bytes
 			sum += buffer[byteIndex];
@@ -168,12 +214,15 @@ static size_t writeSdBlock(Writer& outBuffer) {
 		// TODO: check ret value!
 		outBuffer.write(buffer, entrySize);
 		writen += entrySize;
+#endif // EFI_MLG_DELTA_LOG
 	}
 
+#if !EFI_MLG_DELTA_LOG
 	buffer[0] = sum;
 	// 1 byte checksum footer
 	outBuffer.write(buffer, 1);
 	writen += 1;
+#endif // EFI_MLG_DELTA_LOG
 
 	return writen;
 }
@@ -196,6 +245,17 @@ size_t writeSdLogLine(Writer& bufferedWriter) {
 	}
 }
 
+size_t finishFileLogging(Writer& bufferedWriter) {
+#if EFI_MLG_DELTA_LOG
+	if (deltaEncoderReady) {
+		return deltaEncoder.flush(bufferedWriter);
+	}
+#else
+	UNUSED(bufferedWriter);
+#endif // EFI_MLG_DELTA_LOG
+	return 0;
+}
+
 void resetFileLogging() {
 	binaryLogCount = 0;
 	blockRollCounter = 0;
@@ -9,5 +9,7 @@
 namespace MLG{
     int getSdCardFieldsCount();
     size_t writeSdLogLine(Writer& buffer);
+    // Write out anything still held back before the file is closed
+    size_t finishFileLogging(Writer& buffer);
     void resetFileLogging();
 }
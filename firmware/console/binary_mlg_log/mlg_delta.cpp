@@ -0,0 +1,93 @@
+/**
+ * @file mlg_delta.cpp
+ */
+
+#include "pch.h"
+
+#include "mlg_delta.h"
+
+namespace MLG::Delta {
+
+Encoder::Encoder(uint8_t* block, size_t blockSize, uint8_t* previous, size_t previousSize)
+	: m_block(block)
+	, m_blockSize(blockSize < Lz::maxBlockSize ? blockSize : Lz::maxBlockSize)
+	, m_previous(previous)
+	, m_previousSize(previousSize)
+{
+}
+
+bool Encoder::reset(size_t fieldCount, size_t recordLength) {
+	m_maskSize = (fieldCount + 7) / 8;
+	m_recordLength = recordLength;
+	m_used = 0;
+	m_previousTimestamp = 0;
+
+	if (recordLength > m_previousSize || getWorstCaseRecordSize() > m_blockSize) {
+		m_recordLength = 0;
+		return false;
+	}
+
+	memset(m_previous, 0, recordLength);
+	return true;
+}
+
+size_t Encoder::beginRecord(uint16_t timestamp, Writer& out) {
+	size_t writen = 0;
+
+	if (m_used + getWorstCaseRecordSize() > m_blockSize) {
+		writen = flush(out);
+	}
+
+	uint16_t timestampDelta = timestamp - m_previousTimestamp;
+	m_previousTimestamp = timestamp;
+
+	m_block[m_used++] = timestampDelta >> 8;
+	m_block[m_used++] = timestampDelta & 0xFF;
+
+	m_maskOffset = m_used;
+	memset(m_block + m_maskOffset, 0, m_maskSize);
+	m_used += m_maskSize;
+
+	m_fieldIndex = 0;
+	m_fieldOffset = 0;
+
+	return writen;
+}
+
+void Encoder::addField(const char* data, size_t size) {
+	if (m_fieldOffset + size > m_recordLength) {
+		// more data than declared in the header
+		return;
+	}
+
+	uint8_t* previous = m_previous + m_fieldOffset;
+
+	if (memcmp(previous, data, size) != 0) {
+		m_block[m_maskOffset + m_fieldIndex / 8] |= 1 << (m_fieldIndex % 8);
+
+		for (size_t i = 0; i < size; i++) {
+			uint8_t value = data[i];
+			m_block[m_used++] = value ^ previous[i];
+			previous[i] = value;
+		}
+	}
+
+	m_fieldIndex++;
+	m_fieldOffset += size;
+}
+
+size_t Encoder::flush(Writer& out) {
+	if (m_used == 0) {
+		return 0;
+	}
+
+	char header[2] = { static_cast<char>(m_used >> 8), static_cast<char>(m_used & 0xFF) };
+	out.write(header, sizeof(header));
+
+	size_t writen = sizeof(header) + Lz::compress(m_block, m_used, out, m_hashTable);
+	m_used = 0;
+
+	return writen;
+}
+
+} // namespace MLG::Delta
@@ -0,0 +1,86 @@
+/**
+ * @file mlg_delta.h
+ *
+ * Delta compressed MLG log, see EFI_MLG_DELTA_LOG
+ *
+ * File header is the standard MLG header with a different format magic, so that regular MLG tools do not
+ * mistake it for a plain log. Data section is a sequence of blocks:
+ *     [raw size, uint16 big endian][records, compressed with MLG::Lz]
+ * Each record:
+ *     [timestamp minus previous record timestamp, uint16 big endian, same 10us units as MLG]
+ *     [change mask, one bit per field, LSB first]
+ *     [for each changed field: new value XOR previous value, same byte order as MLG]
+ * Previous values start at zero for each file. Rolling counter and checksum of the standard data block
+ * are not stored, the decoder recomputes them.
+ *
+ * See misc/mlg_delta_decoder for conversion back into standard MLG
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "mlg_lz.h"
+
+namespace MLG::Delta {
+
+// including terminating zero, same length as "MLVLG"
+constexpr char magic[] = "MLVLD";
+
+class Encoder {
+public:
+	/**
+	 * @param block raw records are collected here until compressed, should fit a good number of records
+	 * @param previous previous value of every field
+	 */
+	Encoder(uint8_t* block, size_t blockSize, uint8_t* previous, size_t previousSize);
+
+	/**
+	 * Start a new file
+	 * @return false if record does not fit the buffers
+	 */
+	bool reset(size_t fieldCount, size_t recordLength);
+
+	/**
+	 * Makes room for a worst case record, flushing the pending block if needed
+	 * @return number of bytes written
+	 */
+	size_t beginRecord(uint16_t timestamp, Writer& out);
+	// Fields have to be added in the same order as in the header, each one in MLG byte order
+	void addField(const char* data, size_t size);
+
+	/**
+	 * Compress and write pending records
+	 * @return number of bytes written
+	 */
+	size_t flush(Writer& out);
+
+	size_t getPendingSize() const {
+		return m_used;
+	}
+
+private:
+	size_t getWorstCaseRecordSize() const {
+		return 2 + m_maskSize + m_recordLength;
+	}
+
+	uint8_t* const m_block;
+	const size_t m_blockSize;
+	uint8_t* const m_previous;
+	const size_t m_previousSize;
+
+	size_t m_maskSize = 0;
+	size_t m_recordLength = 0;
+	size_t m_used = 0;
+	uint16_t m_previousTimestamp = 0;
+
+	// current record
+	size_t m_maskOffset = 0;
+	size_t m_fieldIndex = 0;
+	size_t m_fieldOffset = 0;
+
+	uint16_t m_hashTable[Lz::hashSize];
+};
+
+} // namespace MLG::Delta
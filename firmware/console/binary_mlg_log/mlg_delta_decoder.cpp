@@ -0,0 +1,144 @@
+/**
+ * @file mlg_delta_decoder.cpp
+ */
+
+#include <cstring>
+#include <vector>
+
+#include "mlg_delta_decoder.h"
+#include "mlg_delta.h"
+#include "mlg_types.h"
+
+namespace MLG::Delta {
+
+static size_t getFieldSize(uint8_t type) {
+	switch (static_cast<Types::Field::Scalar>(type)) {
+		using enum Types::Field::Scalar;
+		case U08: case S08: return 1;
+		case U16: case S16: return 2;
+		case U32: case S32: case F32: return 4;
+		case S64: return 8;
+		default: return 0;
+	}
+}
+
+static uint32_t readBigEndian(const uint8_t* p, size_t size) {
+	uint32_t value = 0;
+	for (size_t i = 0; i < size; i++) {
+		value = (value << 8) | p[i];
+	}
+	return value;
+}
+
+bool decode(const uint8_t* data, size_t size, Writer& out, size_t* recordCount) {
+	if (recordCount) {
+		*recordCount = 0;
+	}
+
+	if (size < Types::Header::Size || memcmp(data, magic, sizeof(magic)) != 0) {
+		return false;
+	}
+
+	size_t dataBegin = readBigEndian(data + 16, 4);
+	size_t recordLength = readBigEndian(data + 20, 2);
+	size_t fieldCount = readBigEndian(data + 22, 2);
+
+	if (dataBegin > size || Types::Header::Size + fieldCount * Types::Field::DescriptorSize > dataBegin) {
+		return false;
+	}
+
+	std::vector<size_t> fieldSizes(fieldCount);
+	size_t totalSize = 0;
+	for (size_t i = 0; i < fieldCount; i++) {
+		fieldSizes[i] = getFieldSize(data[Types::Header::Size + i * Types::Field::DescriptorSize]);
+		if (fieldSizes[i] == 0) {
+			return false;
+		}
+		totalSize += fieldSizes[i];
+	}
+
+	if (totalSize != recordLength) {
+		return false;
+	}
+
+	// Header is the same apart from the magic
+	out.write("MLVLG", sizeof(magic));
+	out.write(reinterpret_cast<const char*>(data) + sizeof(magic), dataBegin - sizeof(magic));
+
+	size_t maskSize = (fieldCount + 7) / 8;
+	std::vector<uint8_t> previous(recordLength, 0);
+	std::vector<uint8_t> block(Lz::maxBlockSize);
+	std::vector<char> line(4 + recordLength + 1);
+
+	uint16_t timestamp = 0;
+	uint8_t blockRollCounter = 0;
+
+	size_t pos = dataBegin;
+	while (pos < size) {
+		if (size - pos < 2) {
+			return false;
+		}
+
+		size_t rawSize = readBigEndian(data + pos, 2);
+		pos += 2;
+
+		size_t consumed;
+		if (rawSize > block.size() || !Lz::decompress(data + pos, size - pos, block.data(), rawSize, &consumed)) {
+			return false;
+		}
+		pos += consumed;
+
+		size_t in = 0;
+		while (in < rawSize) {
+			if (rawSize - in < 2 + maskSize) {
+				return false;
+			}
+
+			timestamp += readBigEndian(block.data() + in, 2);
+			in += 2;
+
+			const uint8_t* mask = block.data() + in;
+			in += maskSize;
+
+			size_t fieldOffset = 0;
+			for (size_t field = 0; field < fieldCount; field++) {
+				size_t fieldSize = fieldSizes[field];
+
+				if (mask[field / 8] & (1 << (field % 8))) {
+					if (rawSize - in < fieldSize) {
+						return false;
+					}
+
+					for (size_t i = 0; i < fieldSize; i++) {
+						previous[fieldOffset + i] ^= block[in++];
+					}
+				}
+
+				fieldOffset += fieldSize;
+			}
+
+			// Standard data block, see writeSdBlock
+			line[0] = 0;
+			line[1] = blockRollCounter++;
+			line[2] = timestamp >> 8;
+			line[3] = timestamp & 0xFF;
+
+			uint8_t sum = 0;
+			for (size_t i = 0; i < recordLength; i++) {
+				line[4 + i] = previous[i];
+				sum += previous[i];
+			}
+			line[4 + recordLength] = sum;
+
+			out.write(line.data(), line.size());
+
+			if (recordCount) {
+				(*recordCount)++;
+			}
+		}
+	}
+
+	return true;
+}
+
+} // namespace MLG::Delta
@@ -0,0 +1,25 @@
+/**
+ * @file mlg_delta_decoder.h
+ *
+ * Host side conversion of delta compressed logs (see mlg_delta.h) back into standard MLG
+ * Not part of firmware, used by unit tests and misc/mlg_delta_decoder
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "writer.h"
+
+namespace MLG::Delta {
+
+/**
+ * @param data whole delta log file
+ * @param out standard MLG is written here
+ * @param recordCount set to the number of decoded data records
+ * @return false if file is not a delta log or is damaged, records decoded before the damage are still written
+ */
+bool decode(const uint8_t* data, size_t size, Writer& out, size_t* recordCount = nullptr);
+
+} // namespace MLG::Delta
@@ -0,0 +1,190 @@
+/**
+ * @file mlg_lz.cpp
+ */
+
+#include <cstring>
+
+#include "mlg_lz.h"
+
+namespace MLG::Lz {
+
+// matches are not looked for in the last few bytes, block always ends with literals
+static constexpr size_t lastLiterals = 5;
+static constexpr size_t maxOffset = 65535;
+
+static uint32_t read32(const uint8_t* p) {
+	uint32_t value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+static size_t hash(uint32_t sequence) {
+	// Fibonacci hashing
+	return (sequence * 2654435761u) >> (32 - hashBits);
+}
+
+static size_t writeCount(Writer& out, size_t count) {
+	size_t writen = 0;
+	char byte = static_cast<char>(255);
+
+	while (count >= 255) {
+		out.write(&byte, 1);
+		writen++;
+		count -= 255;
+	}
+
+	byte = static_cast<char>(count);
+	out.write(&byte, 1);
+	return writen + 1;
+}
+
+static size_t writeSequence(Writer& out, const uint8_t* literals, size_t literalCount, size_t offset, size_t matchLength) {
+	size_t writen = 0;
+
+	size_t matchCode = matchLength ? matchLength - minMatch : 0;
+
+	char token = static_cast<char>(((literalCount < 15 ? literalCount : 15) << 4) | (matchCode < 15 ? matchCode : 15));
+	out.write(&token, 1);
+	writen++;
+
+	if (literalCount >= 15) {
+		writen += writeCount(out, literalCount - 15);
+	}
+
+	if (literalCount) {
+		out.write(reinterpret_cast<const char*>(literals), literalCount);
+		writen += literalCount;
+	}
+
+	if (matchLength == 0) {
+		// last sequence
+		return writen;
+	}
+
+	char offsetBytes[2] = { static_cast<char>(offset & 0xFF), static_cast<char>(offset >> 8) };
+	out.write(offsetBytes, 2);
+	writen += 2;
+
+	if (matchCode >= 15) {
+		writen += writeCount(out, matchCode - 15);
+	}
+
+	return writen;
+}
+
+size_t compress(const uint8_t* src, size_t size, Writer& out, uint16_t (&hashTable)[hashSize]) {
+	if (size == 0 || size > maxBlockSize) {
+		return 0;
+	}
+
+	// 0 is empty, otherwise position + 1
+	memset(hashTable, 0, sizeof(hashTable));
+
+	size_t writen = 0;
+	size_t anchor = 0;
+	size_t pos = 0;
+
+	if (size > lastLiterals + minMatch) {
+		size_t limit = size - lastLiterals;
+
+		while (pos + minMatch <= limit) {
+			uint32_t sequence = read32(src + pos);
+			size_t slot = hash(sequence);
+			size_t candidate = hashTable[slot];
+			hashTable[slot] = pos + 1;
+
+			if (candidate == 0 || pos - (candidate - 1) > maxOffset || read32(src + candidate - 1) != sequence) {
+				pos++;
+				continue;
+			}
+
+			size_t ref = candidate - 1;
+			size_t length = minMatch;
+			while (pos + length < limit && src[ref + length] == src[pos + length]) {
+				length++;
+			}
+
+			writen += writeSequence(out, src + anchor, pos - anchor, pos - ref, length);
+
+			pos += length;
+			anchor = pos;
+		}
+	}
+
+	writen += writeSequence(out, src + anchor, size - anchor, 0, 0);
+
+	return writen;
+}
+
+static bool readCount(const uint8_t* src, size_t srcSize, size_t& in, size_t& count) {
+	while (true) {
+		if (in >= srcSize) {
+			return false;
+		}
+
+		uint8_t byte = src[in++];
+		count += byte;
+
+		if (byte != 255) {
+			return true;
+		}
+	}
+}
+
+bool decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t rawSize, size_t* consumed) {
+	size_t in = 0;
+	size_t produced = 0;
+
+	while (produced < rawSize) {
+		if (in >= srcSize) {
+			return false;
+		}
+
+		uint8_t token = src[in++];
+
+		size_t literalCount = token >> 4;
+		if (literalCount == 15 && !readCount(src, srcSize, in, literalCount)) {
+			return false;
+		}
+
+		if (literalCount > srcSize - in || literalCount > rawSize - produced) {
+			return false;
+		}
+
+		memcpy(dst + produced, src + in, literalCount);
+		in += literalCount;
+		produced += literalCount;
+
+		if (produced == rawSize) {
+			break;
+		}
+
+		if (srcSize - in < 2) {
+			return false;
+		}
+
+		size_t offset = src[in] | (src[in + 1] << 8);
+		in += 2;
+
+		size_t matchLength = token & 0xF;
+		if (matchLength == 15 && !readCount(src, srcSize, in, matchLength)) {
+			return false;
+		}
+		matchLength += minMatch;
+
+		if (offset == 0 || offset > produced || matchLength > rawSize - produced) {
+			return false;
+		}
+
+		// byte by byte, match may overlap what it produces
+		for (size_t i = 0; i < matchLength; i++) {
+			dst[produced + i] = dst[produced - offset + i];
+		}
+		produced += matchLength;
+	}
+
+	*consumed = in;
+	return true;
+}
+
+} // namespace MLG::Lz
@@ -0,0 +1,41 @@
+/**
+ * @file mlg_lz.h
+ *
+ * Small LZ77 block codec in the spirit of LZ4 used by delta compressed MLG logs.
+ * Sequence: token (literal count << 4 | match length - 4), extra literal count bytes, literals,
+ * 16 bit little endian match offset, extra match length bytes. Counts of 15 and above continue
+ * in extra bytes, 255 meaning "add 255 and read another byte". Last sequence is literals only.
+ *
+ * No firmware dependencies, also built by misc/mlg_delta_decoder
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "writer.h"
+
+namespace MLG::Lz {
+
+constexpr size_t hashBits = 10;
+constexpr size_t hashSize = 1 << hashBits;
+constexpr size_t minMatch = 4;
+// positions are kept in 16 bits
+constexpr size_t maxBlockSize = 65534;
+
+/**
+ * Compress whole block to the writer
+ * @param hashTable scratch space, contents do not need to be preserved between calls
+ * @return number of bytes written
+ */
+size_t compress(const uint8_t* src, size_t size, Writer& out, uint16_t (&hashTable)[hashSize]);
+
+/**
+ * Decompress one block which is known to expand to exactly rawSize bytes
+ * @param consumed set to the number of compressed bytes the block took
+ * @return false if input is malformed or truncated
+ */
+bool decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t rawSize, size_t* consumed);
+
+} // namespace MLG::Lz
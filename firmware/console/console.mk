@@ -1,5 +1,7 @@
 CONSOLE_COMMON_SRC_CPP = 	$(PROJECT_DIR)/console/binary/tooth_logger.cpp \
 	                        $(PROJECT_DIR)/console/binary_mlg_log/binary_mlg_logging.cpp \
+	                        $(PROJECT_DIR)/console/binary_mlg_log/mlg_delta.cpp \
+	                        $(PROJECT_DIR)/console/binary_mlg_log/mlg_lz.cpp \
                          	$(PROJECT_DIR)/console/status_loop.cpp \
 
 
@@ -69,6 +69,7 @@ static Map3D<ETB2_TRIM_RPM_SIZE, ETB2_TRIM_SIZE, int8_t, uint8_t, uint8_t> throt
 static Map3D<TRACTION_CONTROL_ETB_DROP_SLIP_SIZE, TRACTION_CONTROL_ETB_DROP_SPEED_SIZE, int8_t, uint16_t, uint8_t> tcEtbDropTable{"tce"};
 
 constexpr float etbPeriodSeconds = 1.0f / ETB_LOOP_FREQUENCY;
+static_assert(hzForPeriod(ETB_UPDATE_RATE) == ETB_LOOP_FREQUENCY, "ETB is updated by MainLoop");
 
 //static bool startupPositionError = false;
 
@@ -727,24 +728,21 @@ void blinkEtbErrorCodes(bool blinkPhase) {
 	}
 }
 
-#if !EFI_UNIT_TEST
-
-struct DcThread final : public PeriodicController<512> {
-	DcThread() : PeriodicController("DC", PRIO_ETB, ETB_LOOP_FREQUENCY) {}
+// set once throttles are initialized, from then on MainLoop updates them at ETB_UPDATE_RATE
+static bool etbUpdatesStarted = false;
 
-	void PeriodicTask(efitick_t) override {
-		// Simply update all controllers
-		for (int i = 0 ; i < ETB_COUNT; i++) {
-			auto controller = engine->etbControllers[i];
-			assertNotNullVoid(controller);
-			etbControllers[i]->update();
-		}
+void updateElectronicThrottles() {
+	if (!etbUpdatesStarted) {
+		return;
 	}
-};
-
-static DcThread dcThread CCM_OPTIONAL;
 
-#endif // !EFI_UNIT_TEST
+	// Simply update all controllers
+	for (int i = 0 ; i < ETB_COUNT; i++) {
+		auto controller = engine->etbControllers[i];
+		assertNotNullVoid(controller);
+		etbControllers[i]->update();
+	}
+}
 
 #if EFI_UNIT_TEST
 void etbPidReset() {
@@ -939,11 +937,7 @@ void doInitElectronicThrottle(bool isStartupInit) {
 #endif /* EFI_UNIT_TEST */
 
 #if !EFI_UNIT_TEST
-	static bool started = false;
-	if (started == false) {
-		dcThread.start();
-		started = true;
-	}
+	etbUpdatesStarted = true;
 #endif
 }
 
@@ -13,6 +13,8 @@
 
 void initElectronicThrottle();
 void doInitElectronicThrottle(bool isStartupInit);
+// called by MainLoop at ETB_UPDATE_RATE, does nothing until throttles are initialized
+void updateElectronicThrottles();
 
 void setEtbIdlePosition(percent_t pos);
 void setEtbWastegatePosition(percent_t pos);
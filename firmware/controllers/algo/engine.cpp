@@ -181,7 +181,7 @@ void Engine::periodicSlowCallback() {
 
 	updateGppwm();
 
-	engine->engineModules.apply_all([](auto & m) { m.onSlowCallback(); });
+	engine->engineModules.apply_if<overrides_onSlowCallback>([](auto & m) { m.onSlowCallback(); });
 
 #if (BOARD_TLE8888_COUNT > 0)
 	tle8888startup();
@@ -557,6 +557,13 @@ injection_mode_e getCurrentInjectionMode() {
 void Engine::periodicFastCallback() {
 	ScopePerf pc(PE::EnginePeriodicFastCallback);
 
+#if !HAL_USE_ADC
+	// no ADC cycle to publish sensor snapshots, publish once per fast callback instead
+	Sensor::publishSnapshot();
+#endif // HAL_USE_ADC
+	// all sensors as of the same ADC cycle for the whole callback
+	Sensor::getSnapshot(sensorSnapshot);
+
 	boardPeriodicFastCallback();
 	call_board_override(custom_board_periodicFastCallback);
 
@@ -565,7 +572,7 @@ void Engine::periodicFastCallback() {
 
 	speedoUpdate();
 
-	engineModules.apply_all([](auto & m) { m.onFastCallback(); });
+	engineModules.apply_if<overrides_onFastCallback>([](auto & m) { m.onFastCallback(); });
 }
 
 void Engine::onEngineStopped() {
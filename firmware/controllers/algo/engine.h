@@ -50,6 +50,7 @@
 #include "advance_map.h"
 #include "ignition_state.h"
 #include "sensor_checker.h"
+#include "sensor.h"
 #include "fuel_schedule.h"
 #include "prime_injection.h"
 #include "throttle_model.h"
@@ -359,6 +360,11 @@ public:
 
     SensorsState sensors{};
 
+    /**
+     * Consistent copy of all sensor readings, refreshed at the start of periodicFastCallback
+     */
+    SensorSnapshot sensorSnapshot{};
+
     void preCalculate();
 
     void efiWatchdog();
@@ -161,7 +161,8 @@ void EngineState::periodicFastCallback() {
 
 	efitick_t nowNt = getTimeNowNt();
 	bool isCranking = engine->rpmCalculator.isCranking();
-	float rpm = Sensor::getOrZero(SensorType::Rpm);
+	const auto& sensors = engine->sensorSnapshot;
+	float rpm = sensors.getOrZero(SensorType::Rpm);
 
 	if (isCranking) {
 		crankingTimer.reset(nowNt);
@@ -188,7 +189,7 @@ void EngineState::periodicFastCallback() {
 
 	baroCorrection = getBaroCorrection();
 
-	auto tps = Sensor::get(SensorType::Tps1);
+	auto tps = sensors.get(SensorType::Tps1);
 	updateTChargeK(rpm, tps.value_or(0));
 
 	float untrimmedInjectionMass = getInjectionMass(rpm) * engine->engineState.lua.fuelMult + engine->engineState.lua.fuelAdd;
@@ -238,6 +239,12 @@ void EngineState::periodicFastCallback() {
 		engine->engineState.stftCorrection[bankIndex] = clResult.banks[bankIndex];
 	}
 
+	// pick up trim axis edits, then each axis is looked up once for all cylinders
+	fuelTrimLoadAxis.invalidate();
+	fuelTrimRpmAxis.invalidate();
+	ignTrimLoadAxis.invalidate();
+	ignTrimRpmAxis.invalidate();
+
 	// Now apply that to per-cylinder fueling and timing
 	for (size_t cylinderIndex = 0; cylinderIndex < engineConfiguration->cylindersCount; cylinderIndex++) {
 		uint8_t bankIndex = engineConfiguration->cylinderBankSelect[cylinderIndex];
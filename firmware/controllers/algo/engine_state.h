@@ -11,6 +11,7 @@
 #include "engine_parts.h"
 #include "engine_state_generated.h"
 #include "trigger_decoder.h"
+#include "axis_lookup.h"
 
 class EngineState : public engine_state_s {
 public:
@@ -80,6 +81,14 @@ public:
 	multispark_state multispark{};
 
 	bool shouldUpdateInjectionTiming = true;
+
+	/**
+	 * Per-cylinder trim tables share axes, look each axis up once per fast callback
+	 */
+	AxisLookupCache fuelTrimLoadAxis;
+	AxisLookupCache fuelTrimRpmAxis;
+	AxisLookupCache ignTrimLoadAxis;
+	AxisLookupCache ignTrimRpmAxis;
 };
 
 EngineState * getEngineState();
@@ -12,6 +12,7 @@
 #include "scheduler.h"
 #include "fl_stack.h"
 #include "trigger_structure.h"
+#include "phase_dispatch_table.h"
 
 struct AngleBasedEvent {
 	scheduling_s eventScheduling;
@@ -100,6 +101,10 @@ public:
 	 * ignition events, per cylinder
 	 */
 	IgnitionEvent elements[MAX_CYLINDER_COUNT];
+	/**
+	 * elements indexed by dwellAngle, so that each tooth only visits cylinders which start dwell soon
+	 */
+	PhaseDispatchTable<MAX_CYLINDER_COUNT> dwellDispatch;
 	bool isReady = false;
 };
 
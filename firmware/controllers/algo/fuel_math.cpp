@@ -491,8 +491,8 @@ PUBLIC_API_WEAK_SOMETHING_WEIRD
 float getCylinderFuelTrim(size_t cylinderNumber, float rpm, float fuelLoad) {
 	auto trimPercent = interpolate3d(
 		config->fuelTrims[cylinderNumber].table,
-		config->fuelTrimLoadBins, fuelLoad,
-		config->fuelTrimRpmBins, rpm
+		getEngineState()->fuelTrimLoadAxis.get(fuelLoad, config->fuelTrimLoadBins),
+		getEngineState()->fuelTrimRpmAxis.get(rpm, config->fuelTrimRpmBins)
 	);
 
 	// Convert from percent +- to multiplier
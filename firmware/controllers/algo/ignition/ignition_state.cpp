@@ -380,8 +380,8 @@ angle_t IgnitionState::getInterpolatedIgnitionTrim(
 ) {
 	return interpolate3d(
 		config->ignTrims[cylinderNumber].table,
-		config->ignTrimLoadBins, ignitionLoad,
-		config->ignTrimRpmBins, rpm
+		getEngineState()->ignTrimLoadAxis.get(ignitionLoad, config->ignTrimLoadBins),
+		getEngineState()->ignTrimRpmAxis.get(rpm, config->ignTrimRpmBins)
 	);
 }
 
@@ -62,6 +62,10 @@ void registerCanListener(CanListener& listener);
 void unregisterCanListener(CanListener& listener);
 
 void registerCanSensor(CanSensorBase& sensor);
+
+class CanHwFilterSet;
+// Collect IDs consumed by processCanRxMessage and all listeners, see can_hw_filter.h
+void collectCanHwFilters(CanHwFilterSet& filters);
 // TODO: unregisterCanSensor()?
 
 class CanWrite final : public PeriodicController</*TStackSize*/512> {
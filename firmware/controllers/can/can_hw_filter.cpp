@@ -0,0 +1,167 @@
+/**
+ * @file	can_hw_filter.cpp
+ */
+
+#include "pch.h"
+
+#include "can_hw_filter.h"
+
+bool CanHwFilter::matches(const CANRxFrame& frame) const {
+	if (static_cast<bool>(CAN_ISX(frame)) != isExtended) {
+		return false;
+	}
+
+	uint32_t frameId = isExtended ? CAN_EID(frame) : CAN_SID(frame);
+	return (frameId & mask) == id;
+}
+
+void CanHwFilterSet::reset(size_t busIndex) {
+	m_busIndex = busIndex;
+	m_acceptAll = false;
+	m_count = 0;
+	m_checksum = 0;
+}
+
+bool CanHwFilterSet::isForThisBus(int bus) const {
+	return bus == anyBus || bus == static_cast<int>(m_busIndex);
+}
+
+void CanHwFilterSet::addIdMask(int bus, uint32_t id, uint32_t mask) {
+	if (!isForThisBus(bus)) {
+		return;
+	}
+
+	mask &= CAN_EID_MASK;
+	id &= mask;
+
+	// standard frames can only match if none of the extended-only bits are required
+	if ((id & ~CAN_SID_MASK) == 0) {
+		add(id, mask & CAN_SID_MASK, false);
+	}
+	add(id, mask, true);
+}
+
+void CanHwFilterSet::addStandard(int bus, uint32_t id, uint32_t mask) {
+	if (isForThisBus(bus)) {
+		add(id, mask & CAN_SID_MASK, false);
+	}
+}
+
+void CanHwFilterSet::addExtended(int bus, uint32_t id, uint32_t mask) {
+	if (isForThisBus(bus)) {
+		add(id, mask & CAN_EID_MASK, true);
+	}
+}
+
+void CanHwFilterSet::acceptAll(int bus) {
+	if (!isForThisBus(bus) || m_acceptAll) {
+		return;
+	}
+
+	m_acceptAll = true;
+	m_checksum = ~m_checksum;
+
+	m_filters[0] = { 0, 0, false };
+	m_filters[1] = { 0, 0, true };
+	m_count = 2;
+}
+
+void CanHwFilterSet::add(uint32_t id, uint32_t mask, bool isExtended) {
+	if (m_acceptAll) {
+		return;
+	}
+
+	id &= mask;
+
+	// FNV-1a style mixing, only used to detect changes
+	m_checksum = (m_checksum ^ id) * 16777619;
+	m_checksum = (m_checksum ^ mask ^ (isExtended ? 0x80000000 : 0)) * 16777619;
+
+	for (size_t i = 0; i < m_count; i++) {
+		const CanHwFilter& existing = m_filters[i];
+		// already covered by an existing, possibly wider, filter
+		if (existing.isExtended == isExtended
+				&& (existing.mask & ~mask) == 0
+				&& (id & existing.mask) == existing.id) {
+			return;
+		}
+	}
+
+	if (m_count == efi::size(m_filters)) {
+		// make room at the price of accepting a few more IDs
+		reduce(m_count - 1);
+	}
+
+	m_filters[m_count++] = { id, mask, isExtended };
+	removeSubsumedBy(m_count - 1);
+}
+
+void CanHwFilterSet::removeAt(size_t index) {
+	m_filters[index] = m_filters[m_count - 1];
+	m_count--;
+}
+
+void CanHwFilterSet::removeSubsumedBy(size_t index) {
+	CanHwFilter wide = m_filters[index];
+
+	for (size_t i = 0; i < m_count; ) {
+		const CanHwFilter& narrow = m_filters[i];
+
+		if (i != index
+				&& narrow.isExtended == wide.isExtended
+				&& (wide.mask & ~narrow.mask) == 0
+				&& (narrow.id & wide.mask) == wide.id) {
+			removeAt(i);
+			// the filter we compare against could have been moved into the freed slot
+			if (index == m_count) {
+				index = i;
+			}
+		} else {
+			i++;
+		}
+	}
+}
+
+void CanHwFilterSet::reduce(size_t maxFilters) {
+	// accept all needs one filter per frame type
+	criticalAssertVoid(maxFilters >= 2, "need at least two CAN filters");
+
+	while (m_count > maxFilters) {
+		size_t bestI = 0;
+		size_t bestJ = 0;
+		int bestCareBits = -1;
+
+		// merge the pair which loses least mask bits
+		for (size_t i = 0; i < m_count; i++) {
+			for (size_t j = i + 1; j < m_count; j++) {
+				const CanHwFilter& a = m_filters[i];
+				const CanHwFilter& b = m_filters[j];
+				if (a.isExtended != b.isExtended) {
+					continue;
+				}
+
+				uint32_t mask = a.mask & b.mask & ~(a.id ^ b.id);
+				int careBits = __builtin_popcount(mask);
+				if (careBits > bestCareBits) {
+					bestCareBits = careBits;
+					bestI = i;
+					bestJ = j;
+				}
+			}
+		}
+
+		if (bestCareBits < 0) {
+			// more frame types than filters, can't happen with maxFilters >= 2
+			return;
+		}
+
+		CanHwFilter& a = m_filters[bestI];
+		const CanHwFilter& b = m_filters[bestJ];
+		a.mask = a.mask & b.mask & ~(a.id ^ b.id);
+		a.id &= a.mask;
+
+		// bestJ > bestI, so removing bestJ never moves bestI
+		removeAt(bestJ);
+		removeSubsumedBy(bestI);
+	}
+}
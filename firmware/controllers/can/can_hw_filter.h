@@ -0,0 +1,124 @@
+/**
+ * @file	can_hw_filter.h
+ *
+ * Hardware CAN acceptance filters derived from what the firmware actually consumes, so that
+ * unwanted frames on a busy bus are dropped by the peripheral instead of by software.
+ *
+ * Consumers add the IDs they want, the set is then merged down to the number of filters the
+ * peripheral has. Merged filters accept a superset of the requested IDs, software still runs
+ * its exact checks.
+ */
+
+#pragma once
+
+#include "can.h"
+
+#define CAN_SID_MASK 0x7FF
+#define CAN_EID_MASK 0x1FFFFFFF
+
+#ifndef CAN_HW_FILTER_REQUEST_MAX
+#define CAN_HW_FILTER_REQUEST_MAX 64
+#endif
+
+// one id/mask acceptance filter, frame is accepted if (id & mask) == this->id
+struct CanHwFilter {
+	uint32_t id;
+	uint32_t mask;
+	bool isExtended;
+
+	bool matches(const CANRxFrame& frame) const;
+
+	bool operator==(const CanHwFilter& other) const {
+		return id == other.id && mask == other.mask && isExtended == other.isExtended;
+	}
+};
+
+/**
+ * Filters wanted on one bus
+ */
+class CanHwFilterSet {
+public:
+	static constexpr int anyBus = -1;
+
+	// start collecting requests for given bus, requests for other buses are ignored
+	void reset(size_t busIndex);
+
+	// CAN_ID(frame) & mask == id for either frame type, same as CanListener::acceptFrame and Lua filters
+	void addIdMask(int bus, uint32_t id, uint32_t mask);
+	void addId(int bus, uint32_t id) {
+		addIdMask(bus, id, CAN_EID_MASK);
+	}
+
+	void addStandard(int bus, uint32_t id, uint32_t mask = CAN_SID_MASK);
+	void addExtended(int bus, uint32_t id, uint32_t mask = CAN_EID_MASK);
+
+	// a consumer wants every frame, for example the sniffer or a listener without known ID
+	void acceptAll(int bus);
+
+	/**
+	 * Merges filters which are closest to each other until at most maxFilters are left
+	 */
+	void reduce(size_t maxFilters);
+
+	size_t size() const {
+		return m_count;
+	}
+
+	const CanHwFilter* get() const {
+		return m_filters;
+	}
+
+	bool isAcceptAll() const {
+		return m_acceptAll;
+	}
+
+	// changes whenever collected requests change, so that unchanged sets do not have to be reduced again
+	uint32_t getChecksum() const {
+		return m_checksum;
+	}
+
+private:
+	bool isForThisBus(int bus) const;
+	void add(uint32_t id, uint32_t mask, bool isExtended);
+	void removeAt(size_t index);
+	void removeSubsumedBy(size_t index);
+
+	size_t m_busIndex = 0;
+	bool m_acceptAll = false;
+	size_t m_count = 0;
+	uint32_t m_checksum = 0;
+	CanHwFilter m_filters[CAN_HW_FILTER_REQUEST_MAX];
+};
+
+/**
+ * Filter bank which behaves like hardware acceptance filters, for unit tests and builds
+ * without hardware filter support
+ */
+template <size_t TCapacity>
+class SimulatedCanFilterBank {
+public:
+	static constexpr size_t capacity = TCapacity;
+
+	void program(const CanHwFilter* filters, size_t count) {
+		criticalAssertVoid(count <= TCapacity, "too many CAN filters");
+
+		for (size_t i = 0; i < count; i++) {
+			m_filters[i] = filters[i];
+		}
+		m_count = count;
+	}
+
+	bool accepts(const CANRxFrame& frame) const {
+		for (size_t i = 0; i < m_count; i++) {
+			if (m_filters[i].matches(frame)) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+private:
+	CanHwFilter m_filters[TCapacity];
+	size_t m_count = 0;
+};
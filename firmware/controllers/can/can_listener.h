@@ -8,9 +8,14 @@
 #pragma once
 
 #include "can.h"
+#include "can_hw_filter.h"
 
 class CanListener {
 public:
+	// Pass as ID for listeners which override acceptFrame with wider matching than a single ID,
+	// these are offered every frame instead of only frames with matching ID
+	static constexpr uint32_t anyId = UINT32_MAX;
+
 	CanListener(uint32_t id)
 		: m_id(id)
 	{
@@ -24,10 +29,14 @@ public:
 		return m_next;
 	}
 
-	uint32_t getId() {
+	uint32_t getId() const {
 		return m_id;
 	}
 
+	bool hasExactId() const {
+		return m_id != anyId;
+	}
+
 	void setNext(CanListener* next) {
 		m_next = next;
 	}
@@ -42,7 +51,8 @@ public:
 	}
 
 	// Return true if the provided frame should be accepted for processing by the listener.
-	// Override if you need more complex logic than comparing to a single ID.
+	// Override if you need more complex logic than comparing to a single ID, use anyId in that case
+	// unless the override only narrows the single ID match (for example by bus).
 	virtual bool acceptFrame(const size_t busIndex, const CANRxFrame& frame) const {
 		/* accept from all buses */
 		(void)busIndex;
@@ -50,11 +60,25 @@ public:
 		return CAN_ID(frame) == m_id;
 	}
 
+	// Add IDs which acceptFrame could accept to the hardware filter set.
+	// Override along with acceptFrame if using anyId, otherwise all frames are let through.
+	virtual void addHwFilters(CanHwFilterSet& filters) const {
+		if (hasExactId()) {
+			filters.addId(CanHwFilterSet::anyBus, m_id);
+		} else {
+			filters.acceptAll(CanHwFilterSet::anyBus);
+		}
+	}
+
 protected:
 	virtual void decodeFrame(const CANRxFrame& frame, efitick_t nowNt) = 0;
 
 private:
+	friend class CanListenerIndex;
+
 	CanListener* m_next = nullptr;
+	// next listener with the same ID, or next anyId listener, see CanListenerIndex
+	CanListener* m_nextDispatch = nullptr;
 
 	const uint32_t m_id;
 };
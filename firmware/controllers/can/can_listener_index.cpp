@@ -0,0 +1,96 @@
+/**
+ * @file	can_listener_index.cpp
+ */
+
+#include "pch.h"
+
+#include "can_listener_index.h"
+
+size_t CanListenerIndex::getSlot(uint32_t id) {
+	// Fibonacci hashing, upper bits of the product are the well mixed ones
+	return (id * 2654435761u) >> (32 - CAN_LISTENER_INDEX_BITS);
+}
+
+void CanListenerIndex::rebuild(CanListener* head, const CanListener* end) {
+	chibios_rt::CriticalSectionLocker csl;
+
+	for (size_t i = 0; i < efi::size(m_slots); i++) {
+		m_slots[i].first = nullptr;
+	}
+	m_residual = nullptr;
+
+	CanListener** residualTail = &m_residual;
+	size_t usedSlots = 0;
+	size_t iterationValidationCounter = 0;
+
+	for (CanListener* current = head; current && current != end; current = current->getNext()) {
+		if (iterationValidationCounter++ > 239) {
+			criticalError("forever loop canListeners_head");
+			return;
+		}
+
+		current->m_nextDispatch = nullptr;
+
+		if (current->hasExactId() && insert(current, usedSlots)) {
+			continue;
+		}
+
+		*residualTail = current;
+		residualTail = &current->m_nextDispatch;
+	}
+}
+
+bool CanListenerIndex::insert(CanListener* listener, size_t& usedSlots) {
+	uint32_t id = listener->getId();
+
+	// terminates since at least half of slots are always empty
+	for (size_t i = getSlot(id); ; i = (i + 1) % CAN_LISTENER_INDEX_SIZE) {
+		Slot& slot = m_slots[i];
+
+		if (!slot.first) {
+			if (usedSlots >= CAN_LISTENER_INDEX_SIZE / 2) {
+				return false;
+			}
+
+			usedSlots++;
+			slot.id = id;
+			slot.first = listener;
+			return true;
+		}
+
+		if (slot.id == id) {
+			// append to keep list order
+			CanListener* last = slot.first;
+			while (last->m_nextDispatch) {
+				last = last->m_nextDispatch;
+			}
+			last->m_nextDispatch = listener;
+			return true;
+		}
+	}
+}
+
+void CanListenerIndex::processFrame(const size_t busIndex, const CANRxFrame& frame, efitick_t nowNt) const {
+	uint32_t id = CAN_ID(frame);
+
+	for (size_t i = getSlot(id); m_slots[i].first; i = (i + 1) % CAN_LISTENER_INDEX_SIZE) {
+		if (m_slots[i].id == id) {
+			for (CanListener* current = m_slots[i].first; current; current = current->m_nextDispatch) {
+				current->processFrame(busIndex, frame, nowNt);
+			}
+			break;
+		}
+	}
+
+	for (CanListener* current = m_residual; current; current = current->m_nextDispatch) {
+		current->processFrame(busIndex, frame, nowNt);
+	}
+}
+
+size_t CanListenerIndex::getResidualCount() const {
+	size_t count = 0;
+	for (CanListener* current = m_residual; current; current = current->m_nextDispatch) {
+		count++;
+	}
+	return count;
+}
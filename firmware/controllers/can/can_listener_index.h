@@ -0,0 +1,45 @@
+/**
+ * @file	can_listener_index.h
+ *
+ * Listeners indexed by CAN ID so that each received frame is only offered to listeners
+ * which could accept it, instead of every registered listener.
+ */
+
+#pragma once
+
+#include "can_listener.h"
+
+// at most half of slots are used so that probe sequences stay short
+#define CAN_LISTENER_INDEX_BITS 6
+#define CAN_LISTENER_INDEX_SIZE (1 << CAN_LISTENER_INDEX_BITS)
+
+class CanListenerIndex {
+public:
+	/**
+	 * Re-index all listeners of given list, call after each register/unregister.
+	 * Listeners with anyId, or which did not fit into the index, go into the residual list.
+	 * @param end first listener not to index, nullptr for whole list
+	 */
+	void rebuild(CanListener* head, const CanListener* end = nullptr);
+
+	/**
+	 * Offers the frame to listeners with matching ID, then to the residual list.
+	 * Among listeners of the same ID, and within the residual list, list order is kept.
+	 */
+	void processFrame(const size_t busIndex, const CANRxFrame& frame, efitick_t nowNt) const;
+
+	// number of listeners which are offered every frame
+	size_t getResidualCount() const;
+
+private:
+	struct Slot {
+		uint32_t id;
+		CanListener* first;
+	};
+
+	static size_t getSlot(uint32_t id);
+	bool insert(CanListener* listener, size_t& usedSlots);
+
+	Slot m_slots[CAN_LISTENER_INDEX_SIZE] = {};
+	CanListener* m_residual = nullptr;
+};
@@ -18,6 +18,10 @@
 #include "can_common.h"
 
 #include "can_rx.h"
+#include "can_listener_index.h"
+#include "can_hw.h"
+#include "can_hw_filter.h"
+#include "can_filter.h"
 #include "obd2.h"
 #include "can_sensor.h"
 #include "can_vss.h"
@@ -52,7 +56,7 @@ void printCANRxFrame(const size_t busIndex, const CANRxFrame &rx) {
 
 struct CanListenerTailSentinel : public CanListener {
 	CanListenerTailSentinel()
-		: CanListener(0)
+		: CanListener(anyId)
 	{
 	}
 
@@ -68,17 +72,11 @@ struct CanListenerTailSentinel : public CanListener {
 static CanListenerTailSentinel tailSentinel;
 CanListener *canListeners_head = &tailSentinel;
 
+// dispatch index over canListeners_head so that frames are not offered to every listener
+static CanListenerIndex canListenersIndex;
+
 void serviceCanSubscribers(const size_t busIndex, const CANRxFrame &frame, efitick_t nowNt) {
-	CanListener *current = canListeners_head;
-	size_t iterationValidationCounter = 0;
-
-	while (current) {
-		current = current->processFrame(busIndex, frame, nowNt);
-		if (iterationValidationCounter++ > 239) {
-		  criticalError("forever loop canListeners_head");
-		  return;
-		}
-	}
+	canListenersIndex.processFrame(busIndex, frame, nowNt);
 }
 
 // TODO: rework to use utlist.h helpers
@@ -90,6 +88,8 @@ void registerCanListener(CanListener& listener) {
 	if (!listener.getNext()) {
 		listener.setNext(canListeners_head);
 		canListeners_head = &listener;
+		canListenersIndex.rebuild(canListeners_head, &tailSentinel);
+		canHwFiltersChanged();
 	}
 }
 
@@ -111,6 +111,8 @@ void unregisterCanListener(CanListener& listener) {
 	}
 
 	listener.setNext(nullptr);
+	canListenersIndex.rebuild(canListeners_head, &tailSentinel);
+	canHwFiltersChanged();
 }
 
 void registerCanSensor(CanSensorBase& sensor) {
@@ -224,33 +226,191 @@ void boardProcessCanRxMessage(const size_t, const CANRxFrame &, efitick_t) {
 
 std::optional<board_can_rx_type> custom_board_can_rx;
 
-void processCanRxMessage(const size_t busIndex, const CANRxFrame &frame, efitick_t nowNt) {
-	if (verboseRxCan ||
+#if EFI_USE_OPENBLT
+#include "openblt/efi_blt_ids.h"
+#endif
+
+static bool isCanSnifferEnabled(const size_t busIndex) {
+	return verboseRxCan ||
 		(engineConfiguration->verboseCan && busIndex == 0) ||
 		(engineConfiguration->verboseCan2 && busIndex == 1) ||
 #if (EFI_CAN_BUS_COUNT >= 3)
 		(engineConfiguration->verboseCan3 && busIndex == 2) ||
 #endif
-		0) {
-		printCANRxFrame(busIndex, frame);
-	}
-
-	// TODO use call_board_override
-	if (custom_board_can_rx.has_value()) {
-		custom_board_can_rx.value()(busIndex, frame, nowNt);
-	}
+		0;
+}
 
-    // see AemXSeriesWideband as an example of CanSensorBase/CanListener
-	serviceCanSubscribers(busIndex, frame, nowNt);
+namespace {
+/**
+ * Everything processCanRxMessage hands frames to, along with the frames it is after so that
+ * hardware acceptance filters are derived from the same list
+ */
+struct CanRxConsumer {
+	void (*process)(const size_t busIndex, const CANRxFrame& frame, efitick_t nowNt);
+	// IDs 'process' may act on, nullptr: consumer wants every frame
+	void (*addHwFilters)(CanHwFilterSet& filters);
+};
+}
 
+static const CanRxConsumer canRxConsumers[] = {
+	// this build-in sniffer wants to see everything
+	{
+		[](const size_t busIndex, const CANRxFrame& frame, efitick_t) {
+			if (isCanSnifferEnabled(busIndex)) {
+				printCANRxFrame(busIndex, frame);
+			}
+		},
+		[](CanHwFilterSet& filters) {
+			for (size_t busIndex = 0; busIndex < EFI_CAN_BUS_COUNT; busIndex++) {
+				if (isCanSnifferEnabled(busIndex)) {
+					filters.acceptAll(busIndex);
+				}
+			}
+		}
+	},
+	// TODO use call_board_override
+	{
+		[](const size_t busIndex, const CANRxFrame& frame, efitick_t nowNt) {
+			if (custom_board_can_rx.has_value()) {
+				custom_board_can_rx.value()(busIndex, frame, nowNt);
+			}
+		},
+		[](CanHwFilterSet& filters) {
+			// no idea what board code is interested in
+			if (custom_board_can_rx.has_value()) {
+				filters.acceptAll(CanHwFilterSet::anyBus);
+			}
+		}
+	},
+	// see AemXSeriesWideband as an example of CanSensorBase/CanListener
+	{
+		serviceCanSubscribers,
+		[](CanHwFilterSet& filters) {
+			CanListener *current = canListeners_head;
+			size_t iterationValidationCounter = 0;
+			while (current && current != &tailSentinel) {
+				current->addHwFilters(filters);
+				current = current->getNext();
+				if (iterationValidationCounter++ > 239) {
+					criticalError("forever loop canListeners_head");
+					return;
+				}
+			}
+		}
+	},
 	// todo: convert to CanListener or not?
-	//Vss is configurable, should we handle it here:
-	processCanRxVss(frame, nowNt);
-
-	if (!engineConfiguration->useSpiImu) {
-		// todo: convert to CanListener or not?
-		processCanRxImu(frame);
-	}
+	// Vss is configurable, should we handle it here:
+	{
+		[](const size_t, const CANRxFrame& frame, efitick_t nowNt) {
+			processCanRxVss(frame, nowNt);
+		},
+		addCanVssHwFilters
+	},
+	// todo: convert to CanListener or not?
+	{
+		[](const size_t, const CANRxFrame& frame, efitick_t) {
+			if (!engineConfiguration->useSpiImu) {
+				processCanRxImu(frame);
+			}
+		},
+		[](CanHwFilterSet& filters) {
+			if (engineConfiguration->useSpiImu) {
+				return;
+			}
+			if (engineConfiguration->imuType == IMU_MM5_10) {
+				filters.addStandard(CanHwFilterSet::anyBus, MM5_10_YAW_Y);
+				filters.addStandard(CanHwFilterSet::anyBus, MM5_10_ROLL_X);
+				filters.addStandard(CanHwFilterSet::anyBus, MM5_10_Z);
+			} else if (engineConfiguration->imuType == IMU_TYPE_MB_A0065422618) {
+				filters.addStandard(CanHwFilterSet::anyBus, MM5_10_MB_YAW_Y_CANID);
+				filters.addStandard(CanHwFilterSet::anyBus, MM5_10_MB_ROLL_X_CANID);
+			}
+		}
+	},
+	{
+		[](const size_t, const CANRxFrame& frame, efitick_t) {
+			processCanQcBenchTest(frame);
+		},
+		[](CanHwFilterSet& filters) {
+			filters.addExtended(CanHwFilterSet::anyBus, (int)bench_test_packet_ids_e::HW_QC_IO_CONTROL);
+		}
+	},
+	{
+		[](const size_t, const CANRxFrame& frame, efitick_t) {
+			processCanEcuControl(frame);
+		},
+		[](CanHwFilterSet& filters) {
+			filters.addExtended(CanHwFilterSet::anyBus, (int)bench_test_packet_ids_e::ECU_SET_CALIBRATION);
+			filters.addExtended(CanHwFilterSet::anyBus, (int)bench_test_packet_ids_e::ECU_REQ_CALIBRATION);
+			filters.addExtended(CanHwFilterSet::anyBus, (int)bench_test_packet_ids_e::DASH_ALIVE);
+			filters.addExtended(CanHwFilterSet::anyBus, (int)bench_test_packet_ids_e::ECU_CAN_BUS_USER_CONTROL);
+		}
+	},
+	{
+		[](const size_t busIndex, const CANRxFrame& frame, efitick_t) {
+			processLuaCan(busIndex, frame);
+		},
+		addLuaCanHwFilters
+	},
+	{
+		[](const size_t busIndex, const CANRxFrame& frame, efitick_t) {
+			obdOnCanPacketRx(frame, busIndex);
+		},
+		[](CanHwFilterSet& filters) {
+			filters.addStandard(CanHwFilterSet::anyBus, OBD_TEST_REQUEST);
+		}
+	},
+#if EFI_ENGINE_CONTROL
+	{
+		[](const size_t, const CANRxFrame& frame, efitick_t) {
+			if (CAN_EID(frame) == GDI4_BASE_ADDRESS && frame.data8[7] == GDI4_MAGIC) {
+//				efiPrintf("CAN GDI4 says hi");
+				getLimpManager()->externalGdiCanBusComms.reset();
+			}
+		},
+		[](CanHwFilterSet& filters) {
+			filters.addExtended(CanHwFilterSet::anyBus, GDI4_BASE_ADDRESS);
+		}
+	},
+#endif // EFI_ENGINE_CONTROL
+	{
+		[](const size_t busIndex, const CANRxFrame& frame, efitick_t) {
+			handleWidebandCan(busIndex, frame);
+		},
+		[](CanHwFilterSet& filters) {
+			filters.addExtended(getWidebandBus(), WB_ACK);
+		}
+	},
+#if EFI_USE_OPENBLT
+	{
+		[](const size_t busIndex, const CANRxFrame& frame, efitick_t) {
+			if ((CAN_SID(frame) == BOOT_COM_CAN_RX_MSG_ID) && (frame.DLC == 2)) {
+				/* TODO: gracefull shutdown? */
+				if (((busIndex == 0) && (engineConfiguration->canOpenBLT)) ||
+					((busIndex == 1) && (engineConfiguration->can2OpenBLT))) {
+					jump_to_openblt();
+				}
+			}
+		},
+		[](CanHwFilterSet& filters) {
+			// bit 31 marks extended ID, see efi_blt_ids.h
+			uint32_t bltId = BOOT_COM_CAN_RX_MSG_ID;
+			bool bltIsExtended = bltId & 0x80000000;
+			for (int bus = 0; bus < 2; bus++) {
+				bool enabled = bus == 0 ? engineConfiguration->canOpenBLT : engineConfiguration->can2OpenBLT;
+				if (!enabled) {
+					continue;
+				}
+				if (bltIsExtended) {
+					filters.addExtended(bus, bltId);
+				} else {
+					filters.addStandard(bus, bltId);
+				}
+			}
+		}
+	},
+#endif // EFI_USE_OPENBLT
+};
 
 /*
 static Timer dashAliveTimer;
@@ -261,33 +421,20 @@ static Timer dashAliveTimer;
   }
 */
 
-	processCanQcBenchTest(frame);
-	processCanEcuControl(frame);
-
-	processLuaCan(busIndex, frame);
-
-	{
-		obdOnCanPacketRx(frame, busIndex);
-	}
-
-#if EFI_ENGINE_CONTROL
-	if (CAN_EID(frame) == GDI4_BASE_ADDRESS && frame.data8[7] == GDI4_MAGIC) {
-//	    efiPrintf("CAN GDI4 says hi");
-	    getLimpManager()->externalGdiCanBusComms.reset();
+void processCanRxMessage(const size_t busIndex, const CANRxFrame &frame, efitick_t nowNt) {
+	for (const auto& consumer : canRxConsumers) {
+		consumer.process(busIndex, frame, nowNt);
 	}
-#endif // EFI_ENGINE_CONTROL
+}
 
-	handleWidebandCan(busIndex, frame);
-#if EFI_USE_OPENBLT
-#include "openblt/efi_blt_ids.h"
-	if ((CAN_SID(frame) == BOOT_COM_CAN_RX_MSG_ID) && (frame.DLC == 2)) {
-		/* TODO: gracefull shutdown? */
-		if (((busIndex == 0) && (engineConfiguration->canOpenBLT)) ||
-			((busIndex == 1) && (engineConfiguration->can2OpenBLT))) {
-			jump_to_openblt();
+void collectCanHwFilters(CanHwFilterSet& filters) {
+	for (const auto& consumer : canRxConsumers) {
+		if (consumer.addHwFilters) {
+			consumer.addHwFilters(filters);
+		} else {
+			filters.acceptAll(CanHwFilterSet::anyBus);
 		}
 	}
-#endif
 }
 
 #endif // EFI_CAN_SUPPORT
@@ -11,6 +11,7 @@
 
 #if EFI_CAN_SUPPORT
 #include "can_rx.h"
+#include "can_hw_filter.h"
 #include "dynoview.h"
 #include "stored_value_sensor.h"
 
@@ -196,6 +197,20 @@ void processCanRxVss(const CANRxFrame& frame, efitick_t nowNt) {
 
 }
 
+void addCanVssHwFilters(CanHwFilterSet& filters) {
+	if ((!engineConfiguration->enableCanVss) || (!isInit)) {
+		return;
+	}
+
+	filters.addStandard(CanHwFilterSet::anyBus, filterVssCanID);
+	if (filterSecondVssCanID) {
+		filters.addStandard(CanHwFilterSet::anyBus, filterSecondVssCanID);
+	}
+	if (filterRpmCanID) {
+		filters.addStandard(CanHwFilterSet::anyBus, filterRpmCanID);
+	}
+}
+
 void initCanVssSupport() {
 	if (engineConfiguration->enableCanVss) {
 		if (auto canId = look_up_vss_can_id(engineConfiguration->canVssNbcType)) {
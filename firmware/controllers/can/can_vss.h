@@ -11,5 +11,8 @@ void initCanVssSupport();
 void setCanVss(int type);
 
 #if EFI_CAN_SUPPORT
+class CanHwFilterSet;
+
 void processCanRxVss(const CANRxFrame& frame, efitick_t nowNt);
+void addCanVssHwFilters(CanHwFilterSet& filters);
 #endif
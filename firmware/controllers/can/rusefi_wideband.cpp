@@ -9,20 +9,21 @@
 // do we use some sort of a custom bootloader protocol in rusEFI WBO?
 // todo: should we move to any widely used protocol like OpenBLT or else?
 
+#include "rusefi_wideband.h"
+
+size_t getWidebandBus() {
+	return engineConfiguration->widebandOnSecondBus ? 1 : 0;
+}
+
 #if EFI_CAN_SUPPORT
 
 #include "ch.h"
 #include "can_msg_tx.h"
-#include "rusefi_wideband.h"
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-function"
 #include "wideband_firmware/for_rusefi/wideband_can.h"
 #pragma GCC diagnostic pop
 
-size_t getWidebandBus() {
-	return engineConfiguration->widebandOnSecondBus ? 1 : 0;
-}
-
 #define EVT_BOOTLOADER_ACK EVENT_MASK(0)
 
 static thread_t* waitingBootloaderThread = nullptr;
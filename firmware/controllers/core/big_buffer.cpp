@@ -4,7 +4,7 @@
 
 static BigBufferUser s_currentUser;
 // uint32_t type to get 4-byte alignment
-// alignment is required since we sometimes allocate objects in the buffer (like Timer of CompositeBuffer)
+// alignment is required since users place their own structs in the buffer (perf trace entries, tooth logger ring)
 // we've only observed issue on F7 in -Os compiler configuration but technically all processors care
 static uint32_t s_bigBuffer[BIG_BUFFER_SIZE / sizeof(uint32_t)];
 
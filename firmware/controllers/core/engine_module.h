@@ -6,6 +6,8 @@
 
 #include "engine_configuration.h"
 
+#include <type_traits>
+
 class EngineModule {
 public:
 	// Called exactly once during boot, before configuration is loaded
@@ -38,3 +40,21 @@ public:
 								angle_t /*nextPhase*/)
 								{ }
 };
+
+/*
+ * Compile time check whether module_t overrides given EngineModule hook, for use with
+ * type_list::apply_if on hot paths. Address of a member function has the type of the class which
+ * declared it, so a module which inherits the empty default gets EngineModule's type.
+ */
+#define ENGINE_MODULE_HOOK_FILTER(hook) \
+	template<typename module_t> \
+	struct overrides_##hook { \
+		static constexpr bool value = \
+			!std::is_same_v<decltype(&module_t::hook), decltype(&EngineModule::hook)>; \
+	};
+
+// Called per trigger tooth
+ENGINE_MODULE_HOOK_FILTER(onEnginePhase)
+// Called per fast/slow tick
+ENGINE_MODULE_HOOK_FILTER(onFastCallback)
+ENGINE_MODULE_HOOK_FILTER(onSlowCallback)
@@ -6,6 +6,7 @@
 #include "thread_priority.h"
 #include "main_loop.h"
 #include "main_loop_controller.h"
+#include "electronic_throttle.h"
 
 MainLoop::MainLoop()
 	: PeriodicController("MainLoop", PRIO_MAIN_LOOP, MAIN_LOOP_RATE)
@@ -38,37 +39,81 @@ LoopPeriod MainLoop::makePeriodFlags() {
 	return lp;
 }
 
+void MainLoop::setTasks(MainLoopTask* tasks, size_t count) {
+	for (size_t i = 0; i < count; i++) {
+		// a longer run holds off the next cycle, faster tasks would be late without any overrun reported
+		efiAssertVoid(ObdCode::OBD_PCM_Processor_Fault, tasks[i].budgetUs <= MAIN_LOOP_PERIOD_US, "main loop task budget");
+	}
+
+	m_tasks = tasks;
+	m_taskCount = count;
+}
+
+void MainLoop::runTasks(LoopPeriod currentLoopPeriod, efitick_t nowNt) {
+	for (size_t i = 0; i < m_taskCount; i++) {
+		MainLoopTask& task = m_tasks[i];
+
+		if (!(currentLoopPeriod & task.period)) {
+			continue;
+		}
+
+		efitick_t startNt = getTimeNowNt();
+		task.run(nowNt);
+		uint32_t durationUs = NT2US(getTimeNowNt() - startNt);
+
+		task.lastUs = durationUs;
+		if (durationUs > task.budgetUs) {
+			task.overrunCount++;
+
+			// report each new worst case, not every overrun
+			if (durationUs > task.maxUs) {
+				efiPrintf("MainLoop: %s took %luus, budget %luus", task.name, durationUs, task.budgetUs);
+			}
+		}
+		if (durationUs > task.maxUs) {
+			task.maxUs = durationUs;
+		}
+	}
+}
+
+void MainLoop::printTaskInfo() const {
+	for (size_t i = 0; i < m_taskCount; i++) {
+		const MainLoopTask& task = m_tasks[i];
+		efiPrintf("MainLoop %s %dhz: last %luus max %luus budget %luus overruns %lu",
+			task.name, hzForPeriod(task.period), task.lastUs, task.maxUs, task.budgetUs, task.overrunCount);
+	}
+}
+
 void MainLoop::PeriodicTask(efitick_t nowNt) {
 	ScopePerf perf(PE::MainLoop);
 
 	LoopPeriod currentLoopPeriod = makePeriodFlags();
 
+	runTasks(currentLoopPeriod, nowNt);
+}
+
+#if ! EFI_UNIT_TEST
+// Tasks run cooperatively on this one thread, in this order, and are never preempted: a task which runs
+// long delays every task due in the next cycles. That's why no budget is above one main loop period.
+static MainLoopTask mainLoopTasks[] = {
 #if HAL_USE_ADC
-	if (currentLoopPeriod & ADC_UPDATE_RATE) {
-		adcInputsUpdateSubscribers(nowNt);
-	}
-#else
- UNUSED(nowNt);
+	{ "ADC", ADC_UPDATE_RATE, 150, adcInputsUpdateSubscribers },
 #endif // HAL_USE_ADC
-
 #if EFI_ELECTRONIC_THROTTLE_BODY
-	if (currentLoopPeriod & ETB_UPDATE_RATE) {
-		// TODO: main_loop etb callback
-	}
+	{ "ETB", ETB_UPDATE_RATE, 150, [](efitick_t) { updateElectronicThrottles(); } },
 #endif // EFI_ELECTRONIC_THROTTLE_BODY
-
-	if (currentLoopPeriod & SLOW_CALLBACK_RATE) {
-		//TODO: main_loop slow callback
-	}
-
-	if (currentLoopPeriod & FAST_CALLBACK_RATE) {
-	   //TODO: main_loop fast callback
-	}
-}
+	{ "fast", FAST_CALLBACK_RATE, 500, [](efitick_t) { engine->periodicFastCallback(); } },
+	{ "slow", SLOW_CALLBACK_RATE, MAIN_LOOP_PERIOD_US, [](efitick_t) { doPeriodicSlowCallback(); } },
+};
+#endif // EFI_UNIT_TEST
 
 void initMainLoop() {
 	// see test_periodic_thread_controller.cpp for explanation
 #if ! EFI_UNIT_TEST
+	mainLoop.setTasks(mainLoopTasks, efi::size(mainLoopTasks));
+	addConsoleAction("mainloopinfo", [](){
+		mainLoop.printTaskInfo();
+	});
 	mainLoop.start();
 #endif
 }
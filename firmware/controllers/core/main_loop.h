@@ -1,6 +1,7 @@
 #pragma once
 
 #define MAIN_LOOP_RATE 1000
+#define MAIN_LOOP_PERIOD_US (1000000 / MAIN_LOOP_RATE)
 
 void initMainLoop();
 
@@ -18,11 +18,38 @@ static constexpr int loopCounts() {
     return MAIN_LOOP_RATE / hz;
 }
 
-class MainLoop : public PeriodicController<1024> {
+/**
+ * One piece of work run by MainLoop at a fixed rate, with execution time accounting.
+ * Budget is soft: longer runs are counted and reported but never interrupted.
+ */
+struct MainLoopTask {
+    const char* name;
+    LoopPeriod period;
+    uint32_t budgetUs;
+    void (*run)(efitick_t nowNt);
+
+    uint32_t lastUs = 0;
+    uint32_t maxUs = 0;
+    uint32_t overrunCount = 0;
+};
+
+#ifndef MAIN_LOOP_STACK_SIZE
+// fast and slow callbacks run on this stack
+#define MAIN_LOOP_STACK_SIZE 2048
+#endif
+
+class MainLoop : public PeriodicController<MAIN_LOOP_STACK_SIZE> {
 public:
     MainLoop();
     void PeriodicTask(efitick_t nowNt) override;
 
+    /**
+     * Tasks run in array order whenever their period is due, so faster tasks should come first
+     */
+    void setTasks(MainLoopTask* tasks, size_t count);
+
+    void printTaskInfo() const;
+
 #if ! EFI_UNIT_TEST
 private:
 #endif
@@ -32,7 +59,12 @@ private:
 
     LoopPeriod makePeriodFlags();
 
+    void runTasks(LoopPeriod currentLoopPeriod, efitick_t nowNt);
+
     int m_cycleCounter = 0;
+
+    MainLoopTask* m_tasks = nullptr;
+    size_t m_taskCount = 0;
 };
 
 static MainLoop mainLoop CCM_OPTIONAL;
\ No newline at end of file
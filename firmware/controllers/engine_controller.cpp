@@ -115,32 +115,6 @@ void initDataStructures() {
 
 #if !EFI_UNIT_TEST
 
-static void doPeriodicSlowCallback();
-
-class PeriodicFastController : public PeriodicTimerController {
-	void PeriodicTask() override {
-		engine->periodicFastCallback();
-	}
-
-	int getPeriodMs() override {
-		return FAST_CALLBACK_PERIOD_MS;
-	}
-};
-
-class PeriodicSlowController : public PeriodicTimerController {
-	void PeriodicTask() override {
-		doPeriodicSlowCallback();
-	}
-
-	int getPeriodMs() override {
-		// no reason to have this configurable, looks like everyone is happy with 20Hz
-		return SLOW_CALLBACK_PERIOD_MS;
-	}
-};
-
-static PeriodicFastController fastController;
-static PeriodicSlowController slowController;
-
 class EngineStateBlinkingTask : public PeriodicTimerController {
 	int getPeriodMs() override {
 		return 50;
@@ -176,7 +150,7 @@ static void resetAccel() {
 #endif // EFI_ENGINE_CONTROL
 }
 
-static void doPeriodicSlowCallback() {
+void doPeriodicSlowCallback() {
 #if EFI_SHAFT_POSITION_INPUT
 	efiAssertVoid(ObdCode::CUSTOM_ERR_6661, getCurrentRemainingStack() > 64, "lowStckOnEv");
 
@@ -205,8 +179,9 @@ static void doPeriodicSlowCallback() {
 }
 
 void initPeriodicEvents() {
-	slowController.start();
-	fastController.start();
+	// fast and slow callbacks are run by MainLoop, slow one goes first once so that
+	// the first fast callback already has slow state
+	doPeriodicSlowCallback();
 }
 
 char * getPinNameByAdcChannel(const char *msg, adc_channel_e hwChannel, char *buffer, size_t bufferSize) {
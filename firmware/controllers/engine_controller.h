@@ -13,6 +13,8 @@ bool validateConfigOnStartUpOrBurn();
 bool validateConfigOnStartUpOrBurn(bool isRunningOnBurn);
 char * getPinNameByAdcChannel(const char *msg, adc_channel_e hwChannel, char *buffer, size_t bufferSize);
 void initPeriodicEvents();
+// invoked by MainLoop at SLOW_CALLBACK_RATE
+void doPeriodicSlowCallback();
 // see also applyNewHardwareSettings
 void initRealHardwareEngineController();
 void commonEarlyInit();
@@ -33,6 +33,7 @@ void turnInjectionPinHigh(scheduler_arg_t const arg) {
 FuelSchedule::FuelSchedule() {
 	for (int cylinderIndex = 0; cylinderIndex < MAX_CYLINDER_COUNT; cylinderIndex++) {
 		elements[cylinderIndex].setIndex(cylinderIndex);
+		elements[cylinderIndex].setDispatchTable(&dispatch);
 	}
 }
 
@@ -130,6 +131,11 @@ bool InjectionEvent::updateInjectionAngle() {
 			injectionStartAngle = result.Value;
 		}
 
+		// locked timing still has to be dispatched, even if that is the default angle
+		if (dispatchTable) {
+			dispatchTable->setAngle(ownIndex, injectionStartAngle);
+		}
+
 		return true;
 	} else {
 		return false;
@@ -209,6 +215,11 @@ void FuelSchedule::addFuelEvents() {
 		}
 	}
 
+	// cylinder count could have been reduced
+	for (size_t cylinderIndex = engineConfiguration->cylindersCount; cylinderIndex < MAX_CYLINDER_COUNT; cylinderIndex++) {
+		dispatch.remove(cylinderIndex);
+	}
+
 	// We made it through all cylinders, mark the schedule as ready so it can be used
 	isReady = true;
 }
@@ -219,9 +230,13 @@ void FuelSchedule::onTriggerTooth(efitick_t nowNt, float currentPhase, float nex
 		return;
 	}
 
-	for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
+	// only cylinders with injection start near this tooth, exact check is in InjectionEvent::onTriggerTooth
+	auto candidates = dispatch.getCandidates(currentPhase, nextPhase);
+	candidates &= (1u << engineConfiguration->cylindersCount) - 1;
+
+	dispatch.forEach(candidates, [&](size_t i) {
 		elements[i].onTriggerTooth(nowNt, currentPhase, nextPhase);
-	}
+	});
 }
 
 #endif // EFI_ENGINE_CONTROL
@@ -10,9 +10,12 @@
 #include "fl_stack.h"
 #include "trigger_structure.h"
 #include "wall_fuel.h"
+#include "phase_dispatch_table.h"
 
 #define MAX_WIRES_COUNT 2
 
+using InjectionDispatchTable = PhaseDispatchTable<MAX_CYLINDER_COUNT>;
+
 class InjectionEvent {
 public:
 	InjectionEvent() = default;
@@ -28,6 +31,11 @@ public:
 		ownIndex = index;
 	}
 
+	// injection start angle changes are reported into this table, if any
+	void setDispatchTable(InjectionDispatchTable *table) {
+		dispatchTable = table;
+	}
+
 private:
 	// Update the injection start angle
 	bool updateInjectionAngle();
@@ -45,6 +53,8 @@ private:
 
 	WallFuel wallFuel{};
 
+	InjectionDispatchTable *dispatchTable = nullptr;
+
 public:
 	// TODO: this should be private
 	InjectorOutputPin *outputs[MAX_WIRES_COUNT]{};
@@ -80,6 +90,10 @@ public:
 	 * injection events, per cylinder
 	 */
 	InjectionEvent elements[MAX_CYLINDER_COUNT];
+	/**
+	 * elements indexed by injectionStartAngle, so that each tooth only visits cylinders which inject soon
+	 */
+	InjectionDispatchTable dispatch;
 	bool isReady = false;
 };
 
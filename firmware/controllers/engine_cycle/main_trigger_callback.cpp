@@ -292,7 +292,7 @@ void mainTriggerCallback(uint32_t trgEventIndex, efitick_t edgeTimestamp, angle_
 		}
 	}
 
-	engine->engineModules.apply_all([=](auto & m) {
+	engine->engineModules.apply_if<overrides_onEnginePhase>([=](auto & m) {
 		m.onEnginePhase(rpm, edgeTimestamp, currentPhase, nextPhase);
 	});
 
@@ -160,6 +160,7 @@ static void prepareCylinderIgnitionSchedule(angle_t dwellAngleDuration, floatms_
 	assertAngleRange(dwellStartAngle, "findAngle dwellStartAngle", ObdCode::CUSTOM_ERR_6550);
 	wrapAngle(dwellStartAngle, "findAngle#7", ObdCode::CUSTOM_ERR_6550);
 	event->dwellAngle = dwellStartAngle;
+	engine->ignitionEvents.dwellDispatch.setAngle(event->cylinderIndex, dwellStartAngle);
 
 #if FUEL_MATH_EXTREME_LOGGING
 	if (printFuelDebug) {
@@ -526,6 +527,10 @@ void initializeIgnitionActions() {
 		list->elements[cylinderIndex].cylinderIndex = cylinderIndex;
 		prepareCylinderIgnitionSchedule(dwellAngle, sparkDwell, &list->elements[cylinderIndex]);
 	}
+	// cylinder count could have been reduced
+	for (size_t cylinderIndex = engineConfiguration->cylindersCount; cylinderIndex < MAX_CYLINDER_COUNT; cylinderIndex++) {
+		list->dwellDispatch.remove(cylinderIndex);
+	}
 	list->isReady = true;
 }
 
@@ -592,7 +597,15 @@ void onTriggerEventSparkLogic(float rpm, efitick_t edgeTimestamp, float currentP
 		&& getCurrentIgnitionMode() == IM_WASTED_SPARK;
 
 	if (engine->ignitionEvents.isReady) {
-		for (size_t i = 0; i < engineConfiguration->cylindersCount; i++) {
+		auto& dispatch = engine->ignitionEvents.dwellDispatch;
+		// only cylinders with dwell start near this tooth, exact check is below
+		auto candidates = dispatch.getCandidates(currentPhase, nextPhase);
+		if (enableOddCylinderWastedSpark) {
+			candidates |= dispatch.getCandidatesShifted360(currentPhase, nextPhase);
+		}
+		candidates &= (1u << engineConfiguration->cylindersCount) - 1;
+
+		dispatch.forEach(candidates, [&](size_t i) {
 			IgnitionEvent *event = &engine->ignitionEvents.elements[i];
 
 			angle_t dwellAngle = event->dwellAngle;
@@ -600,7 +613,7 @@ void onTriggerEventSparkLogic(float rpm, efitick_t edgeTimestamp, float currentP
 			angle_t sparkAngle = event->sparkAngle;
 			if (std::isnan(sparkAngle)) {
 				warning(ObdCode::CUSTOM_ADVANCE_SPARK, "NaN advance");
-				continue;
+				return;
 			}
 
 			bool isOddCylWastedEvent = false;
@@ -625,18 +638,18 @@ void onTriggerEventSparkLogic(float rpm, efitick_t edgeTimestamp, float currentP
 			}
 
 			if (!isOddCylWastedEvent && !isPhaseInRange(dwellAngle, currentPhase, nextPhase)) {
-				continue;
+				return;
 			}
 
 			if (i == 0 && engineConfiguration->artificialTestMisfire && (getRevolutionCounter() % ((int)engineConfiguration->scriptSetting[5]) == 0)) {
 				// artificial misfire on cylinder #1 for testing purposes
 				// enable artificialMisfire
 				warning(ObdCode::CUSTOM_ARTIFICIAL_MISFIRE, "artificial misfire on cylinder #1 for testing purposes %d", engine->engineState.globalSparkCounter);
-				continue;
+				return;
 			}
 #if ROTATIONAL_IDLE_CONTROLLER
 		if (engine->rotationalIdleController.shouldSkipSparkRotationalIdle()) {
-			continue;
+			return;
 		}
 #endif // ROTATIONAL_IDLE_CONTROLLER
 
@@ -644,7 +657,7 @@ void onTriggerEventSparkLogic(float rpm, efitick_t edgeTimestamp, float currentP
             bool sparkLimited = engine->softSparkLimiter.shouldSkip() || engine->hardSparkLimiter.shouldSkip();
             engine->ignitionState.luaIgnitionSkip = sparkLimited;
 			if (sparkLimited) {
-				continue;
+				return;
 			}
 #endif // EFI_LAUNCH_CONTROL
 
@@ -652,7 +665,7 @@ void onTriggerEventSparkLogic(float rpm, efitick_t edgeTimestamp, float currentP
 /*
        if (engine->antilagController.isAntilagCondition) {
 			if (engine->ALSsoftSparkLimiter.shouldSkip()) {
-				continue;
+				return;
 			}
 		}
 		float throttleIntent = Sensor::getOrZero(SensorType::DriverThrottleIntent);
@@ -668,7 +681,7 @@ void onTriggerEventSparkLogic(float rpm, efitick_t edgeTimestamp, float currentP
 #endif // EFI_ANTILAG_SYSTEM
 
 			scheduleSparkEvent(limitedSpark, event, rpm, dwellMs, dwellAngle, sparkAngle, edgeTimestamp, currentPhase, nextPhase);
-		}
+		});
 	}
 }
 
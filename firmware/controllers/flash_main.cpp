@@ -163,7 +163,9 @@ static void doRewriteConfig() {
 }
 
 static void doWriteLTFT() {
-	settingsLtftRequestWriteToFlash();
+#if EFI_LTFT_CONTROL
+	requestLongTermFuelTrimStore();
+#endif // EFI_LTFT_CONTROL
 }
 
 void initFlash() {
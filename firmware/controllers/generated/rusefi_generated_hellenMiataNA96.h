@@ -1451,6 +1451,8 @@
 #define TS_OUTPUT_COMMAND_char O
 #define TS_PAGE_COMMAND 'P'
 #define TS_PAGE_COMMAND_char P
+#define TS_PERF_STATS_GET_BUFFER 'j'
+#define TS_PERF_STATS_GET_BUFFER_char j
 #define TS_PERF_TRACE_BEGIN '_'
 #define TS_PERF_TRACE_BEGIN_char _
 #define TS_PERF_TRACE_GET_BUFFER 'b'
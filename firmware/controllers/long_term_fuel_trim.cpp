@@ -11,7 +11,10 @@
 // +/-25% maximum
 #define MAX_ADJ (0.25f)
 
-#define SAVE_AFTER_HITS	1000
+// how often learned cells are appended to the storage journal
+#define JOURNAL_PERIOD_SEC	10
+// give up on storing trims if storage does not respond after ignition off
+#define SHUTOFF_TIMEOUT_SEC	5
 
 constexpr float integrator_dt = FAST_CALLBACK_PERIOD_MS * 0.001f;
 
@@ -21,9 +24,32 @@ static LtftState ltftState;
 // LTFT to VE table custom apply algo
 std::optional<setup_custom_board_overrides_type> custom_board_LtftTrimToVeApply;
 
+// Trims as written by save(): learning, TS writes and console commands keep changing trims
+// during the milliseconds storage takes to write them, while CRC has to match what was stored
+static decltype(LtftState::trims) trimsSnapshot;
+
 void LtftState::save() {
+	{
+		// everything learned so far goes into the snapshot, journal starts over on top of it:
+		// flushDirty() must not see cleared dirty cells together with the old journal entries
+		chibios_rt::CriticalSectionLocker csl;
+		dirty.clear();
+		memcpy(trimsSnapshot, trims, sizeof(trimsSnapshot));
+		journal.count = 0;
+	}
+	// CRC is too slow to compute with interrupts off. Base is only read by saveJournal() and
+	// replayJournal(), both on the storage thread as save() itself
+	journal.baseCrc = crc32(trimsSnapshot, sizeof(trimsSnapshot));
+
+#if EFI_PROD_CODE
+	storageWrite(EFI_LTFT_RECORD_ID, (const uint8_t *)trimsSnapshot, sizeof(trimsSnapshot));
+#endif //EFI_PROD_CODE
+	saveJournal();
+}
+
+void LtftState::saveJournal() {
 #if EFI_PROD_CODE
-	storageWrite(EFI_LTFT_RECORD_ID, (const uint8_t *)trims, sizeof(trims));
+	storageWrite(EFI_LTFT_JOURNAL_RECORD_ID, (const uint8_t *)&journal, sizeof(journal));
 #endif //EFI_PROD_CODE
 }
 
@@ -35,20 +61,123 @@ void LtftState::load() {
 #endif
 		//Reset to some defaules
 		reset();
+		dirty.clear();
+		journal.baseCrc = crc32(trims, sizeof(trims));
+		journal.count = 0;
+		return;
+	}
+
+#if EFI_PROD_CODE
+	bool hasJournal = storageRead(EFI_LTFT_JOURNAL_RECORD_ID, (uint8_t *)&journal, sizeof(journal)) == StorageStatus::Ok;
+#else
+	bool hasJournal = true;
+#endif //EFI_PROD_CODE
+	if (!hasJournal || !replayJournal()) {
+		// journal from other trims or none at all
+		journal.baseCrc = crc32(trims, sizeof(trims));
+		journal.count = 0;
 	}
+	onTrimsReplaced();
 }
 
 void LtftState::reset() {
+	// cleared cells have to reach storage as well
+	for (size_t cell = 0; cell < LTFT_CELL_COUNT; cell++) {
+		if (learned.get(cell)) {
+			for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
+				dirty.set(bank * LTFT_CELL_COUNT + cell);
+			}
+		}
+	}
+
 	for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
 		setTable(trims[bank], 0.0f);
 	}
+	learned.clear();
+}
+
+void LtftState::setTrim(size_t bank, size_t loadIndex, size_t rpmIndex, float trim) {
+	trims[bank][loadIndex][rpmIndex] = trim;
+
+	size_t cell = loadIndex * VE_RPM_COUNT + rpmIndex;
+	dirty.set(bank * LTFT_CELL_COUNT + cell);
+	learned.set(cell);
+}
+
+bool LtftState::flushDirty() {
+	for (size_t index = 0; index < FT_BANK_COUNT * LTFT_CELL_COUNT; index++) {
+		if (!dirty.get(index)) {
+			continue;
+		}
+
+		float trim = (&trims[0][0][0])[index];
+		int16_t packed = clampF(INT16_MIN, efiRound(trim * LTFT_JOURNAL_SCALE, 1), INT16_MAX);
+
+		// cell already journaled since last full save: update in place
+		size_t entry = 0;
+		while (entry < journal.count && journal.entries[entry].cell != index) {
+			entry++;
+		}
+
+		if (entry == LTFT_JOURNAL_SIZE) {
+			return false;
+		}
+
+		journal.entries[entry] = { (uint16_t)index, packed };
+		if (entry == journal.count) {
+			journal.count++;
+		}
+	}
+
+	dirty.clear();
+	return true;
+}
+
+bool LtftState::replayJournal() {
+	if (journal.baseCrc != crc32(trims, sizeof(trims)) || journal.count > LTFT_JOURNAL_SIZE) {
+		return false;
+	}
+
+	for (size_t entry = 0; entry < journal.count; entry++) {
+		auto& record = journal.entries[entry];
+		if (record.cell < FT_BANK_COUNT * LTFT_CELL_COUNT) {
+			(&trims[0][0][0])[record.cell] = (float)record.trim / LTFT_JOURNAL_SCALE;
+		}
+	}
+
+	return true;
+}
+
+void LtftState::onTrimsReplaced() {
+	dirty.clear();
+	learned.clear();
+
+	for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
+		for (size_t cell = 0; cell < LTFT_CELL_COUNT; cell++) {
+			if ((&trims[bank][0][0])[cell] != 0) {
+				learned.set(cell);
+			}
+		}
+	}
+}
+
+void LtftState::onRawWrite(size_t offset, size_t count) {
+	if (count == 0) {
+		return;
+	}
+
+	size_t last = std::min<size_t>((offset + count - 1) / sizeof(float), FT_BANK_COUNT * LTFT_CELL_COUNT - 1);
+	for (size_t index = offset / sizeof(float); index <= last; index++) {
+		dirty.set(index);
+		learned.set(index % LTFT_CELL_COUNT);
+	}
 }
 
 void LtftState::fillRandom() {
 	for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
 		for (size_t loadIndex = 0; loadIndex < VE_LOAD_COUNT; loadIndex++) {
 			for (size_t rpmIndex = 0; rpmIndex < VE_RPM_COUNT; rpmIndex++) {
-				trims[bank][loadIndex][rpmIndex] = PERCENT_DIV * (loadIndex + rpmIndex * 0.1);
+				setTrim(bank, loadIndex, rpmIndex, PERCENT_DIV * (loadIndex + rpmIndex * 0.1));
 			}
 		}
 	}
@@ -60,8 +189,13 @@ void LtftState::applyToVe() {
 		return;
 	}
 
+	// only cells which learned something, trim of all other cells is zero
 	for (size_t loadIndex = 0; loadIndex < VE_LOAD_COUNT; loadIndex++) {
 		for (size_t rpmIndex = 0; rpmIndex < VE_RPM_COUNT; rpmIndex++) {
+			if (!learned.get(loadIndex * VE_RPM_COUNT + rpmIndex)) {
+				continue;
+			}
+
 			float k = 0;
 
 			/* We have single VE table, but FT_BANK_COUNT banks of trims */
@@ -77,6 +211,7 @@ void LtftState::applyToVe() {
 
 void LongTermFuelTrim::init(LtftState *state) {
 	m_state = state;
+	journalTimer.reset();
 
 #if EFI_PROD_CODE
 	ltftLoadPending = storageReqestReadID(EFI_LTFT_RECORD_ID);
@@ -155,8 +290,8 @@ void LongTermFuelTrim::learn(ClosedLoopFuelResult clResult, float rpm, float fue
 		// accumulate
 		ltftAccummulatedCorrection[bank] += newTrim - trim;
 
-		// store
-		m_state->trims[bank][x.Idx][y.Idx] = newTrim;
+		// store, cell is journaled by onSlowCallback
+		m_state->setTrim(bank, x.Idx, y.Idx, newTrim);
 
 		adjusted = true;
 	}
@@ -165,12 +300,6 @@ void LongTermFuelTrim::learn(ClosedLoopFuelResult clResult, float rpm, float fue
 	if (adjusted) {
 		ltftCntHit++;
 		showUpdateToUser = true;
-		if ((ltftCntHit % SAVE_AFTER_HITS) == 0) {
-			// request save
-#if EFI_PROD_CODE
-			settingsLtftRequestWriteToFlash();
-#endif
-		}
 	} else {
 		ltftCntDeadband++;
 	}
@@ -229,15 +358,24 @@ void LongTermFuelTrim::load() {
 }
 
 void LongTermFuelTrim::store() {
-	// TODO: lock to avoid modification while writing
+	// trims may keep changing, save() writes a snapshot
 	ltftSavePending = true;
 
 	if (m_state) {
 		m_state->save();
 	}
 
-	// TODO: unlock
 	ltftSavePending = false;
+	journalWritePending = false;
+}
+
+// Called from storage manager thread when journal write was requested
+void LongTermFuelTrim::storeJournal() {
+	if (m_state) {
+		m_state->saveJournal();
+	}
+
+	journalWritePending = false;
 }
 
 void LongTermFuelTrim::reset() {
@@ -298,11 +436,69 @@ void LongTermFuelTrim::onSlowCallback() {
 	// Do some magic math here?
 
 	/* ... */
+
+	if (engine->module<MainRelayController>()->hasIgnitionVoltage) {
+		ignitionOffTimer.reset();
+	}
+
+	if (!m_state || ltftLoadPending || ltftSavePending || journalWritePending) {
+		return;
+	}
+
+	if (storeRequested) {
+		// requested from here so that save() never overlaps flushDirty()
+		storeRequested = false;
+		journalWritePending = true;
+#if EFI_PROD_CODE
+		if (!settingsLtftRequestWriteToFlash()) {
+			journalWritePending = false;
+		}
+#else
+		store();
+#endif
+		return;
+	}
+
+	if (!m_state->dirty.any()) {
+		return;
+	}
+
+	if (!journalFlushRequested && !journalTimer.hasElapsedSec(JOURNAL_PERIOD_SEC)) {
+		return;
+	}
+	journalTimer.reset();
+	journalFlushRequested = false;
+
+	// learn() runs on the same thread, dirty cells do not change under our feet
+	bool compact = !m_state->flushDirty();
+
+	// write from storage manager thread, journal is not touched until the write is done
+	journalWritePending = true;
+#if EFI_PROD_CODE
+	// journal is full: write whole trims and start empty journal
+	bool requested = compact ? settingsLtftRequestWriteToFlash() : storageRequestWriteID(EFI_LTFT_JOURNAL_RECORD_ID, false);
+	if (!requested) {
+		journalWritePending = false;
+	}
+#else
+	if (compact) {
+		store();
+	} else {
+		storeJournal();
+	}
+#endif
+}
+
+void LongTermFuelTrim::requestStore() {
+	storeRequested = true;
 }
 
 bool LongTermFuelTrim::needsDelayedShutoff() {
-	// TODO: We should delay power off until we store LTFT
-	return false;
+	bool hasUnsaved = m_state && (m_state->dirty.any() || journalWritePending);
+	// ignition is off, do not wait for the journal period
+	journalFlushRequested = hasUnsaved;
+	// storage could be missing or stuck, do not keep main relay on forever
+	return hasUnsaved && !ignitionOffTimer.hasElapsedSec(SHUTOFF_TIMEOUT_SEC);
 }
 
 void initLtft(void)
@@ -314,6 +510,10 @@ void resetLongTermFuelTrim() {
 	engine->module<LongTermFuelTrim>()->reset();
 }
 
+void requestLongTermFuelTrimStore() {
+	engine->module<LongTermFuelTrim>()->requestStore();
+}
+
 void applyLongTermFuelTrimToVe() {
 	engine->module<LongTermFuelTrim>()->applyTrimsToVe();
 }
@@ -338,4 +538,8 @@ size_t ltftGetTsPageSize() {
 	return sizeof(ltftState.trims);
 }
 
+void ltftOnTsWrite(size_t offset, size_t count) {
+	ltftState.onRawWrite(offset, count);
+}
+
 #endif // EFI_LTFT_CONTROL
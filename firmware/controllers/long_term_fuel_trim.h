@@ -5,16 +5,94 @@
 #include "closed_loop_fuel.h"
 #include "long_term_fuel_trim_state_generated.h"
 
+#define LTFT_CELL_COUNT (VE_LOAD_COUNT * VE_RPM_COUNT)
+// journal records between full trims writes, whole journal is a 256 byte storage record
+#define LTFT_JOURNAL_SIZE 62
+// journal trim resolution: 0.001%, enough for +/-25% in int16_t
+#define LTFT_JOURNAL_SCALE 100000
+
+/**
+ * One learned cell. Holds absolute trim, not delta, so replaying a record twice is harmless
+ * and a cell learned again between flushes takes a single record.
+ */
+struct LtftJournalEntry {
+	// bank * LTFT_CELL_COUNT + loadIndex * VE_RPM_COUNT + rpmIndex
+	uint16_t cell;
+	// in 1 / LTFT_JOURNAL_SCALE units
+	int16_t trim;
+};
+
+/**
+ * Small storage record appended with learned cells between full trims writes
+ */
+struct LtftJournal {
+	// crc32 of stored trims this journal applies on top of
+	uint32_t baseCrc;
+	uint16_t count;
+	uint16_t pad;
+	LtftJournalEntry entries[LTFT_JOURNAL_SIZE];
+};
+
+template <size_t TBits>
+struct LtftCellMask {
+	void set(size_t index) {
+		bits[index / 32] |= 1u << (index % 32);
+	}
+
+	bool get(size_t index) const {
+		return bits[index / 32] & (1u << (index % 32));
+	}
+
+	void clear() {
+		memset(bits, 0, sizeof(bits));
+	}
+
+	bool any() const {
+		for (auto word : bits) {
+			if (word) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	uint32_t bits[(TBits + 31) / 32] = {};
+};
+
 struct LtftState {
   // todo: probably reuse page_2_generated.h?
 	float trims[FT_BANK_COUNT][VE_LOAD_COUNT][VE_RPM_COUNT];
 
+	LtftJournal journal;
+	// cells changed since last journal flush, per bank
+	LtftCellMask<FT_BANK_COUNT * LTFT_CELL_COUNT> dirty;
+	// cells with non-zero trim in any bank, the only ones applyToVe() has to touch
+	LtftCellMask<LTFT_CELL_COUNT> learned;
+
+	// full trims write, also starts an empty journal
 	void save();
+	void saveJournal();
 	void load();
 	void reset();
 	void applyToVe();
 	// Development only, to be removed
 	void fillRandom();
+
+	void setTrim(size_t bank, size_t loadIndex, size_t rpmIndex, float trim);
+	/**
+	 * Moves dirty cells into the journal
+	 * @return false if the journal is full and a full save() is needed
+	 */
+	bool flushDirty();
+	/**
+	 * Applies journal on top of trims if it was written for them
+	 * @return false if journal does not match trims
+	 */
+	bool replayJournal();
+	// rebuild masks after trims were changed in bulk
+	void onTrimsReplaced();
+	// trims were written as raw bytes
+	void onRawWrite(size_t offset, size_t count);
 };
 
 class LongTermFuelTrim : public EngineModule, public long_term_fuel_trim_state_s {
@@ -28,6 +106,9 @@ public:
 	ClosedLoopFuelResult getTrims(float rpm, float fuelLoad);
 	void load();
 	void store();
+	void storeJournal();
+	// full save on next slow callback
+	void requestStore();
 	void reset();
 	void applyTrimsToVe();
 	bool isVeUpdated();
@@ -46,10 +127,18 @@ private:
 	float getMinAdjustment(const ltft_s& cfg) const;
 
 	Timer pageRefreshTimer{};
+
+	// dirty cells are journaled this often, and right away once ignition is off
+	Timer journalTimer{};
+	Timer ignitionOffTimer{};
+	bool journalFlushRequested = false;
+	bool journalWritePending = false;
+	bool storeRequested = false;
 };
 
 void initLtft();
 void resetLongTermFuelTrim();
+void requestLongTermFuelTrimStore();
 void applyLongTermFuelTrimToVe();
 bool ltftNeedVeRefresh();
 void devPokeLongTermFuelTrim();
@@ -57,3 +146,4 @@ void devPokeLongTermFuelTrim();
 void *ltftGetTsPage();
 LtftState *ltftGetState();
 size_t ltftGetTsPageSize();
+void ltftOnTsWrite(size_t offset, size_t count);
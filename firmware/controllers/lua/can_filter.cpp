@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "can_filter.h"
 #include "can_hw.h"
+#include "can_hw_filter.h"
 
 #ifndef LUA_RX_MAX_FILTER_COUNT
 #define LUA_RX_MAX_FILTER_COUNT 48
@@ -41,4 +42,15 @@ void addLuaCanRxFilter(int32_t eid, uint32_t mask, int bus, int callback) {
 	filters[filterCount].Callback = callback;
 
 	filterCount++;
+
+#if EFI_CAN_SUPPORT
+	canHwFiltersChanged();
+#endif // EFI_CAN_SUPPORT
+}
+
+void addLuaCanHwFilters(CanHwFilterSet& hwFilters) {
+	for (size_t i = 0; i < filterCount; i++) {
+		auto& filter = filters[i];
+		hwFilters.addIdMask(filter.Bus == ANY_BUS ? CanHwFilterSet::anyBus : filter.Bus, filter.Id, filter.Mask);
+	}
 }
@@ -24,3 +24,6 @@ void resetLuaCanRx();
 void addLuaCanRxFilter(int32_t eid, uint32_t mask, int bus, int callback);
 
 CanFilter* getFilterForId(size_t busIndex, int Id);
+
+class CanHwFilterSet;
+void addLuaCanHwFilters(CanHwFilterSet& hwFilters);
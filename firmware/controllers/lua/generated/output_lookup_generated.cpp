@@ -5,1900 +5,2011 @@
 #if EFI_PROD_CODE && EFI_ELECTRONIC_THROTTLE_BODY && FULL_SD_LOGS
 #include <electronic_throttle_impl.h>
 #endif
-float getOutputValueByHash(const int hash) {
-	switch(hash) {
+static const int outputHashBySlot[623] = {
+	98140609, 308336833, 1272048601, -1626770351, -614909137, 1400235571, 864210494, 493641747,
+	-978523544, 731084614, -592323161, -1117430949, 1933507837, -84435626, 1574758390, 767689023,
+	417956611, -347083354, 98140611, 86860621, 1554961855, 595683774, 526786951, 512655621,
+	-1225000603, 823476017, 724244513, 752161333, -113087656, 756216589, -1560670902, -797965330,
+	1886060228, -734820550, -1007205736, -774592003, -628741220, -1124698524, 1649801578, 781025153,
+	-1813050607, 1240443772, 1108896195, 404628421, 1417905588, 1192769173, -1605036797, -746111499,
+	-148455898, 1539654224, -700740893, -183564272, 417943720, 347493808, -1206067863, 927388609,
+	-410785646, 190585324, 1240443769, -1124698522, 1841224793, -404295156, -1055526802, -1684644880,
+	-1236599226, 70357120, -1889531804, 1568071542, 1944984220, -1997175144, 417952269, 553570450,
+	-1802940455, -94443575, -1097329029, 86008152, 1109228234, -662113279, -791147982, -384925312,
+	-960645892, 967311941, -1238909045, 2039421097, -794283008, -677561380, 1221247747, -1434098660,
+	-1241725607, -679828715, -818268726, -1051397637, -2066867294, -1582096144, 583799407, -2073424832,
+	1384666002, -1662199734, 1774505810, -1110431971, 1628523935, -1983023250, -1221832529, -1872098102,
+	859283926, -208884349, 98140608, -580955469, -735105365, -295556270, -575702922, -734904659,
+	-1149240133, 1301677708, 249515182, -183564275, -1498397570, 114836583, -1429286498, 823985075,
+	392899738, 1637661099, -1724101868, 164334513, 2070002124, 206346164, 477303734, -1288205717,
+	283558758, 417946098, -52473827, -1777838088, 704910935, -43142203, 890832495, 1822238385,
+	256951528, 268704037, -304304077, -968092482, 5863453, 799075048, -513494613, -1167844818,
+	-1642402810, 352421907, 1286045659, 1163075685, 2122891301, -2011570052, -309610760, -376325528,
+	1539654222, 2018173863, -1717833001, 1492724763, 99356871, 356548450, -1764857646, -1548941801,
+	-1357387481, -280624712, -782567504, -1916613921, 957036309, 995190836, -558968637, 2055342630,
+	149945022, 782384530, 1749059722, 1281101952, -1162308767, 2079600300, -1634779035, -608535663,
+	309572379, -1165835361, 156247622, 2135736269, 1849938842, -1595596945, -1779658835, 1533250027,
+	1240443767, -1105630476, 707453027, -359858019, -2124102606, -1973799222, -1778606949, 398829343,
+	-806484581, 1072636768, -448033693, 1240443773, 957036310, 206956368, 1016529812, 803810402,
+	-1006487219, 1699696209, 53406649, 1928406809, -1126009613, -80612537, -454003684, -801974332,
+	1016089632, -213258422, 2127645162, 1502782136, -362320880, 659064164, -1344436946, -192504649,
+	1021133095, 1413130003, -1383513733, 1384666006, -649083733, 681043126, -983339026, -513216302,
+	-1808516876, -575666209, -1811686395, -1124698529, -801974331, 827982787, -836653176, -937296564,
+	1630166812, -43142202, -2133047208, -1511514122, 540029591, 1663359009, 1240443771, 1805437050,
+	-1124698523, -1221814987, 892591242, -1237512821, -243031057, 1384666035, 769117654, -871891659,
+	669515138, -80687031, 115540725, 1569192907, -1732159411, 990714516, 1721400659, -1263258735,
+	518760558, 1505102185, -1683399313, -612624925, -504596140, -45862380, 1838047931, -2133047664,
+	-1798837954, 822501973, 1283556181, 1964920685, -1638166696, -319326974, 1136482406, -2132393748,
+	193830616, 352763970, 20251202, 365919991, -1119268893, -1390672637, 1718832245, -1935221780,
+	-893334680, -679828717, 1990697206, 248878000, -1124698527, 1183441554, 2029444810, 803810401,
+	-940825965, 1526237246, -1786409942, 2081101050, 468022861, -517673231, 407130790, -679828716,
+	-1661765918, -1124698525, 2014293065, 81034497, 1247316691, -1044288778, -1346040258, -50147853,
+	-2079775742, -1111560081, 519838295, -175046954, 1691876092, 1404346549, 2081101053, 1182962523,
+	-1595441102, -1270448973, 481450608, -43142201, -1002567773, -921867120, -1458054117, -1158359776,
+	-762743481, -1337459841, -1453554940, -917305595, 1419463927, 2081101052, 162105111, -1670732400,
+	1267620087, 2111912944, -1919072851, 98140610, 111403416, -807823931, 200047729, 686428810,
+	1629214715, 1156739423, -1368130286, -381519965, -1621551201, 43183663, 28274136, -899895696,
+	945288534, 680091441, 122475036, 2081101048, 1699495432, -1015278697, -1318050732, 385418550,
+	-850386982, 341978922, 1722712413, -2065814304, 543832183, 2081101045, 1466421764, -1438648277,
+	-226320012, -1158382750, 2555743, -2035612655, -1845821506, 1520918538, -2049691836, 1781305509,
+	1726931380, 1826317915, -654466797, 2071180270, -41846406, 2130850289, -1798819555, -1225980502,
+	686191307, -304796912, -1241003634, -230533156, 2098956565, 986597357, 398495089, -770506808,
+	-1746157889, 501156654, -183564276, 1560891460, 945288537, -1943574844, 642962903, 1569151513,
+	-374065485, -1502616231, -354325031, -1166766772, -308232520, 1193280444, -1063282840, 513859492,
+	-56077458, 958239307, 1393895570, 2008830549, -1478067590, -658597643, 2081101046, -1808022618,
+	708639006, -705383759, 945288536, 797862280, -1571781441, -1811922497, -371650253, 888763399,
+	997197711, -1807121002, 907263673, -860328524, -802271455, 1155330306, 1966562169, 1650433343,
+	1836976702, 1556089965, 1240443768, 1359980579, -1886479485, -493248738, 1570583513, 248437820,
+	-1943724937, -1256359963, -1208021110, -547107760, -54949348, -42886021, 274318471, 1417236183,
+	-1877053191, 1301677887, 1331305979, -1159462771, 541066842, 683172218, 347478025, 897099930,
+	-1062352104, -448033692, 1926227562, 2086676382, -427776066, -601476695, 438683128, -1327994008,
+	23640681, -183564273, -3603666, 14587330, -183564274, 394027848, 1368986296, -679828714,
+	-180401224, 277722310, 494714802, -1839290700, 1700636875, -184764139, -1764857648, 252935343,
+	1246430386, -1764857647, 803810399, -272579820, 974514969, -813957817, -1326404407, -1220300524,
+	1095642192, -1712045196, 1644550754, 1745186508, 310661471, -2032003569, -212260968, -1124698528,
+	644036825, -1959120957, -417653524, 839236273, 1092959609, 1242329357, -2112117188, 95716118,
+	-2109056235, 1265600943, -344048084, 989545496, -1124698530, -903101570, -707712709, -1925174695,
+	1474641640, 1378388905, 888773651, 598268994, -1093429509, 1680936043, 449790048, 907666325,
+	1741054027, 1467505752, -1124698526, -1374156957, -1945673215, -1296201087, 432464630, 1599780729,
+	1608791711, 795671090, -823915964, -424088744, 1240443770, -1190004798, -1476961259, -56739846,
+	-1382627620, -281693247, -1529936844, -791713926, -1555114948, 1766132801, 2081101047, 1922853657,
+	2069994349, 1331305978, 197173469, -1717868938, -1790051911, 319978869, 945288535, 350535927,
+	-1507281103, 2081101049, 1581624998, 1384666039, -622949795, -1809939546, 417956621, 769340240,
+	1313522810, -2850030, 1894184322, 1846215200, -1703719182, -1798336054, -855279955, 638039515,
+	168011889, -1481117304, 37467836, -854094034, 2031242236, 884518764, -666982725, 119157463,
+	-1626840525, 1921134430, -685727673, 705044501, -1585778708, 471298448, 513001967, -1033638560,
+	-1418343613, -1723435379, 1239062717, -734877977, 2141275671, -1254008074, -1555684830, 584726739,
+	459787871, -1902025276, 1973309843, -1970249707, -1432096142, -150769059, 481241435, -4187390,
+	1517904291, 714144074, 803810400, 705840892, 2090288615, 1539654223, 133427185, 1199244598,
+	1227553104, -1077373465, -2015383594, -1074908546, 1473688883, 1119735859, 2081101051, 31747807,
+	-2045040875, -1962923820, -1764857649, 1029096098, -1773414247, 206059088, 561614935, -1727829859,
+	-1708884225, -1208328954, 1055284435, -1422787851, -2054472109, -530001975, 1830486000,
+};
+static const uint16_t outputSeedByBucket[156] = {
+	80, 45, 36, 51, 9, 78, 20, 1,
+	40, 84, 10, 118, 61, 0, 5, 49,
+	0, 89, 413, 7, 11, 0, 34, 46,
+	92, 111, 0, 32, 25, 2, 213, 22,
+	10, 3, 5, 43, 20, 21, 88, 6,
+	19, 41, 5, 69, 469, 167, 73, 81,
+	201, 0, 37, 2, 124, 6, 0, 648,
+	96, 2, 502, 177, 107, 4, 63, 42,
+	249, 2, 10, 54, 20, 166, 88, 0,
+	1, 361, 19, 4, 152, 16, 71, 106,
+	112, 141, 10, 122, 284, 10, 1, 285,
+	125, 103, 7, 13, 204, 0, 17, 46,
+	16, 6, 110, 380, 182, 3, 904, 0,
+	4, 4, 0, 4, 19, 18, 2, 4,
+	8, 0, 49, 58, 2, 46, 477, 4,
+	5, 476, 7, 45, 0, 132, 1137, 8,
+	196, 1547, 26, 51, 10, 89, 19, 1324,
+	62, 0, 1299, 432, 54, 16, 3, 1041,
+	238, 9, 6842, 101, 16, 26, 795, 0,
+	92, 66, 17, 492,
+};
+int getOutputSlotByHash(const int hash) {
+	return perfectHashLookup(hash, outputHashBySlot, outputSeedByBucket);
+}
+float getOutputValueBySlot(const int slot) {
+	switch(slot) {
 // sd_present
-		case -230533156:
+		case 379:
 			return engine->outputChannels.sd_present;
 // sd_logging_internal
-		case 708639006:
+		case 408:
 			return engine->outputChannels.sd_logging_internal;
 // triggerScopeReady
-		case -770506808:
+		case 383:
 			return engine->outputChannels.triggerScopeReady;
 // antilagTriggered
-		case 1155330306:
+		case 421:
 			return engine->outputChannels.antilagTriggered;
 // isO2HeaterOn
-		case 438683128:
+		case 454:
 			return engine->outputChannels.isO2HeaterOn;
 // checkEngine
-		case -1790051911:
+		case 540:
 			return engine->outputChannels.checkEngine;
 // needBurn
-		case 1368986296:
+		case 462:
 			return engine->outputChannels.needBurn;
 // sd_msd
-		case 459787871:
+		case 584:
 			return engine->outputChannels.sd_msd;
 // toothLogReady
-		case -1662199734:
+		case 97:
 			return engine->outputChannels.toothLogReady;
 // isTpsError
-		case 14587330:
+		case 459:
 			return engine->outputChannels.isTpsError;
 // isCltError
-		case 518760558:
+		case 256:
 			return engine->outputChannels.isCltError;
 // isMapError
-		case 23640681:
+		case 456:
 			return engine->outputChannels.isMapError;
 // isIatError
-		case 1505102185:
+		case 257:
 			return engine->outputChannels.isIatError;
 // isTriggerError
-		case -1746157889:
+		case 384:
 			return engine->outputChannels.isTriggerError;
 // hasCriticalError
-		case -2015383594:
+		case 602:
 			return engine->outputChannels.hasCriticalError;
 // isWarnNow
-		case -1919072851:
+		case 330:
 			return engine->outputChannels.isWarnNow;
 // isPedalError
-		case -2035612655:
+		case 363:
 			return engine->outputChannels.isPedalError;
 // launchTriggered
-		case -52473827:
+		case 130:
 			return engine->outputChannels.launchTriggered;
 // isTps2Error
-		case -1529936844:
+		case 530:
 			return engine->outputChannels.isTps2Error;
 // injectorFault
-		case 1608791711:
+		case 520:
 			return engine->outputChannels.injectorFault;
 // ignitionFault
-		case -1158382750:
+		case 361:
 			return engine->outputChannels.ignitionFault;
 // isUsbConnected
-		case 1836976702:
+		case 424:
 			return engine->outputChannels.isUsbConnected;
 // dfcoActive
-		case -622949795:
+		case 548:
 			return engine->outputChannels.dfcoActive;
 // sd_active_wr
-		case 1301677887:
+		case 441:
 			return engine->outputChannels.sd_active_wr;
 // sd_active_rd
-		case 1301677708:
+		case 113:
 			return engine->outputChannels.sd_active_rd;
 // isMapValid
-		case 43183663:
+		case 341:
 			return engine->outputChannels.isMapValid;
 // triggerPageRefreshFlag
-		case -1708884225:
+		case 616:
 			return engine->outputChannels.triggerPageRefreshFlag;
 // hasFaultReportFile
-		case -1502616231:
+		case 393:
 			return engine->outputChannels.hasFaultReportFile;
 // isAnalogFailure
-		case -1383513733:
+		case 218:
 			return engine->outputChannels.isAnalogFailure;
 // isTuningNow
-		case 1109228234:
+		case 76:
 			return engine->outputChannels.isTuningNow;
 // sd_formating
-		case 352763970:
+		case 273:
 			return engine->outputChannels.sd_formating;
 // isMapAveraging
-		case -1626840525:
+		case 568:
 			return engine->outputChannels.isMapAveraging;
 // RPMValue
-		case 1699696209:
+		case 201:
 			return engine->outputChannels.RPMValue;
 // rpmAcceleration
-		case -968092482:
+		case 139:
 			return engine->outputChannels.rpmAcceleration;
 // speedToRpmRatio
-		case -685727673:
+		case 570:
 			return engine->outputChannels.speedToRpmRatio;
 // internalMcuTemperature
-		case -871891659:
+		case 247:
 			return engine->outputChannels.internalMcuTemperature;
 // internalVref
-		case -1221814987:
+		case 241:
 			return engine->outputChannels.internalVref;
 // internalVbat
-		case -1221832529:
+		case 102:
 			return engine->outputChannels.internalVbat;
 // coolant
-		case -746111499:
+		case 47:
 			return engine->outputChannels.coolant;
 // intake
-		case 81034497:
+		case 299:
 			return engine->outputChannels.intake;
 // auxTemp1
-		case 1331305978:
+		case 537:
 			return engine->outputChannels.auxTemp1;
 // auxTemp2
-		case 1331305979:
+		case 442:
 			return engine->outputChannels.auxTemp2;
 // TPSValue
-		case 1272048601:
+		case 2:
 			return engine->outputChannels.TPSValue;
 // throttlePedalPosition
-		case -84435626:
+		case 13:
 			return engine->outputChannels.throttlePedalPosition;
 // tpsADC
-		case 513859492:
+		case 399:
 			return engine->outputChannels.tpsADC;
 // rawMaf
-		case 417956611:
+		case 16:
 			return engine->outputChannels.rawMaf;
 // mafMeasured
-		case -2032003569:
+		case 485:
 			return engine->outputChannels.mafMeasured;
 // MAPValue
-		case 1281101952:
+		case 171:
 			return engine->outputChannels.MAPValue;
 // baroPressure
-		case -2066867294:
+		case 92:
 			return engine->outputChannels.baroPressure;
 // lambdaValue
-		case -1119268893:
+		case 276:
 			return engine->outputChannels.lambdaValue;
 // VBatt
-		case 277722310:
+		case 465:
 			return engine->outputChannels.VBatt;
 // oilPressure
-		case 598268994:
+		case 507:
 			return engine->outputChannels.oilPressure;
 // vvtPositionB1I
-		case 1384666006:
+		case 219:
 			return engine->outputChannels.vvtPositionB1I;
 // actualLastInjection
-		case 681043126:
+		case 221:
 			return engine->outputChannels.actualLastInjection;
 // actualLastInjectionRatio
-		case -1476961259:
+		case 526:
 			return engine->outputChannels.actualLastInjectionRatio;
 // stopEngineCode
-		case -2112117188:
+		case 494:
 			return engine->outputChannels.stopEngineCode;
 // injectorDutyCycle
-		case -354325031:
+		case 394:
 			return engine->outputChannels.injectorDutyCycle;
 // tempLogging1
-		case -679828717:
+		case 281:
 			return engine->outputChannels.tempLogging1;
 // injectionOffset
-		case -243031057:
+		case 244:
 			return engine->outputChannels.injectionOffset;
 // engineMakeCodeNameCrc16
-		case 1726931380:
+		case 368:
 			return engine->outputChannels.engineMakeCodeNameCrc16;
 // wallFuelAmount
-		case 115540725:
+		case 250:
 			return engine->outputChannels.wallFuelAmount;
 // wallFuelCorrectionValue
-		case -1511514122:
+		case 235:
 			return engine->outputChannels.wallFuelCorrectionValue;
 // revolutionCounterSinceStart
-		case -1555114948:
+		case 532:
 			return engine->outputChannels.revolutionCounterSinceStart;
 // canReadCounter
-		case 1247316691:
+		case 300:
 			return engine->outputChannels.canReadCounter;
 // tpsAccelFuel
-		case -384925312:
+		case 79:
 			return engine->outputChannels.tpsAccelFuel;
 // currentIgnitionMode
-		case -3603666:
+		case 458:
 			return engine->outputChannels.currentIgnitionMode;
 // currentInjectionMode
-		case -921867120:
+		case 317:
 			return engine->outputChannels.currentInjectionMode;
 // coilDutyCycle
-		case 1029096098:
+		case 611:
 			return engine->outputChannels.coilDutyCycle;
 // etb1DutyCycle
-		case 1021133095:
+		case 216:
 			return engine->outputChannels.etb1DutyCycle;
 // fuelTankLevel
-		case 543832183:
+		case 356:
 			return engine->outputChannels.fuelTankLevel;
 // totalFuelConsumption
-		case 1417905588:
+		case 44:
 			return engine->outputChannels.totalFuelConsumption;
 // fuelFlowRate
-		case 822501973:
+		case 265:
 			return engine->outputChannels.fuelFlowRate;
 // TPS2Value
-		case 686191307:
+		case 376:
 			return engine->outputChannels.TPS2Value;
 // tuneCrc16
-		case -1158359776:
+		case 319:
 			return engine->outputChannels.tuneCrc16;
 // veValue
-		case 1933507837:
+		case 12:
 			return engine->outputChannels.veValue;
 // seconds
-		case -1962923820:
+		case 609:
 			return engine->outputChannels.seconds;
 // engineMode
-		case -2073424832:
+		case 95:
 			return engine->outputChannels.engineMode;
 // firmwareVersion
-		case 799075048:
+		case 141:
 			return engine->outputChannels.firmwareVersion;
 // rawIdlePositionSensor
-		case -677561380:
+		case 85:
 			return engine->outputChannels.rawIdlePositionSensor;
 // rawWastegatePosition
-		case 2039421097:
+		case 83:
 			return engine->outputChannels.rawWastegatePosition;
 // accelerationLat
-		case -2133047664:
+		case 263:
 			return engine->outputChannels.accelerationLat;
 // accelerationLon
-		case -2133047208:
+		case 234:
 			return engine->outputChannels.accelerationLon;
 // detectedGear
-		case 283558758:
+		case 128:
 			return engine->outputChannels.detectedGear;
 // maxTriggerReentrant
-		case -1595441102:
+		case 312:
 			return engine->outputChannels.maxTriggerReentrant;
 // rawLowFuelPressure
-		case -148455898:
+		case 48:
 			return engine->outputChannels.rawLowFuelPressure;
 // rawHighFuelPressure
-		case 990714516:
+		case 253:
 			return engine->outputChannels.rawHighFuelPressure;
 // lowFuelPressure
-		case -628741220:
+		case 36:
 			return engine->outputChannels.lowFuelPressure;
 // tcuDesiredGear
-		case 471298448:
+		case 573:
 			return engine->outputChannels.tcuDesiredGear;
 // flexPercent
-		case 404628421:
+		case 43:
 			return engine->outputChannels.flexPercent;
 // wastegatePositionSensor
-		case 53406649:
+		case 202:
 			return engine->outputChannels.wastegatePositionSensor;
 // highFuelPressure
-		case -1973799222:
+		case 189:
 			return engine->outputChannels.highFuelPressure;
 // tempLogging3
-		case -679828715:
+		case 89:
 			return engine->outputChannels.tempLogging3;
 // tempLogging4
-		case -679828714:
+		case 463:
 			return engine->outputChannels.tempLogging4;
 // calibrationValue
-		case -1560670902:
+		case 30:
 			return engine->outputChannels.calibrationValue;
 // calibrationMode
-		case 1774505810:
+		case 98:
 			return engine->outputChannels.calibrationMode;
 // idleStepperTargetPosition
-		case 356548450:
+		case 157:
 			return engine->outputChannels.idleStepperTargetPosition;
 // totalTriggerErrorCounter
-		case 2018173863:
+		case 153:
 			return engine->outputChannels.totalTriggerErrorCounter;
 // orderingErrorCounter
-		case -1326404407:
+		case 478:
 			return engine->outputChannels.orderingErrorCounter;
 // warningCounter
-		case 1492724763:
+		case 155:
 			return engine->outputChannels.warningCounter;
 // lastErrorCode
-		case -1346040258:
+		case 302:
 			return engine->outputChannels.lastErrorCode;
 // debugFloatField1
-		case 1240443767:
+		case 184:
 			return engine->outputChannels.debugFloatField1;
 // debugFloatField2
-		case 1240443768:
+		case 426:
 			return engine->outputChannels.debugFloatField2;
 // debugFloatField3
-		case 1240443769:
+		case 58:
 			return engine->outputChannels.debugFloatField3;
 // debugFloatField4
-		case 1240443770:
+		case 524:
 			return engine->outputChannels.debugFloatField4;
 // debugFloatField5
-		case 1240443771:
+		case 238:
 			return engine->outputChannels.debugFloatField5;
 // debugFloatField6
-		case 1240443772:
+		case 41:
 			return engine->outputChannels.debugFloatField6;
 // debugFloatField7
-		case 1240443773:
+		case 195:
 			return engine->outputChannels.debugFloatField7;
 // debugIntField1
-		case -183564276:
+		case 386:
 			return engine->outputChannels.debugIntField1;
 // debugIntField2
-		case -183564275:
+		case 115:
 			return engine->outputChannels.debugIntField2;
 // debugIntField3
-		case -183564274:
+		case 460:
 			return engine->outputChannels.debugIntField3;
 // debugIntField4
-		case -183564273:
+		case 457:
 			return engine->outputChannels.debugIntField4;
 // debugIntField5
-		case -183564272:
+		case 51:
 			return engine->outputChannels.debugIntField5;
 // rawTps1Primary
-		case -1051397637:
+		case 91:
 			return engine->outputChannels.rawTps1Primary;
 // rawClt
-		case 417946098:
+		case 129:
 			return engine->outputChannels.rawClt;
 // rawIat
-		case 417952269:
+		case 70:
 			return engine->outputChannels.rawIat;
 // rawOilPressure
-		case 2070002124:
+		case 124:
 			return engine->outputChannels.rawOilPressure;
 // rawAcPressure
-		case 2079600300:
+		case 173:
 			return engine->outputChannels.rawAcPressure;
 // rawFuelLevel
-		case 1413130003:
+		case 217:
 			return engine->outputChannels.rawFuelLevel;
 // rawPpsPrimary
-		case -347083354:
+		case 17:
 			return engine->outputChannels.rawPpsPrimary;
 // rawPpsSecondary
-		case -1798336054:
+		case 557:
 			return engine->outputChannels.rawPpsSecondary;
 // rawRawPpsPrimary
-		case 347493808:
+		case 53:
 			return engine->outputChannels.rawRawPpsPrimary;
 // rawRawPpsSecondary
-		case -1318050732:
+		case 350:
 			return engine->outputChannels.rawRawPpsSecondary;
 // idlePositionSensor
-		case 782384530:
+		case 169:
 			return engine->outputChannels.idlePositionSensor;
 // AFRValue
-		case -1093429509:
+		case 508:
 			return engine->outputChannels.AFRValue;
 // AFRValue2
-		case -1723435379:
+		case 577:
 			return engine->outputChannels.AFRValue2;
 // SmoothedAFRValue
-		case -1845821506:
+		case 364:
 			return engine->outputChannels.SmoothedAFRValue;
 // SmoothedAFRValue2
-		case -782567504:
+		case 162:
 			return engine->outputChannels.SmoothedAFRValue2;
 // VssAcceleration
-		case -513494613:
+		case 142:
 			return engine->outputChannels.VssAcceleration;
 // lambdaValue2
-		case 1718832245:
+		case 278:
 			return engine->outputChannels.lambdaValue2;
 // vvtPositionB1E
-		case 1384666002:
+		case 96:
 			return engine->outputChannels.vvtPositionB1E;
 // vvtPositionB2I
-		case 1384666039:
+		case 547:
 			return engine->outputChannels.vvtPositionB2I;
 // vvtPositionB2E
-		case 1384666035:
+		case 245:
 			return engine->outputChannels.vvtPositionB2E;
 // rawTps1Secondary
-		case 2555743:
+		case 362:
 			return engine->outputChannels.rawTps1Secondary;
 // rawTps2Primary
-		case -1382627620:
+		case 528:
 			return engine->outputChannels.rawTps2Primary;
 // rawTps2Secondary
-		case 70357120:
+		case 65:
 			return engine->outputChannels.rawTps2Secondary;
 // accelerationVert
-		case -1670732400:
+		case 327:
 			return engine->outputChannels.accelerationVert;
 // gyroYaw
-		case 519838295:
+		case 306:
 			return engine->outputChannels.gyroYaw;
 // turboSpeed
-		case -4187390:
+		case 591:
 			return engine->outputChannels.turboSpeed;
 // tps1Split
-		case 644036825:
+		case 488:
 			return engine->outputChannels.tps1Split;
 // tps2Split
-		case 683172218:
+		case 445:
 			return engine->outputChannels.tps2Split;
 // tps12Split
-		case 1533250027:
+		case 183:
 			return engine->outputChannels.tps12Split;
 // accPedalSplit
-		case 864210494:
+		case 6:
 			return engine->outputChannels.accPedalSplit;
 // accPedalUnfiltered
-		case 1466421764:
+		case 358:
 			return engine->outputChannels.accPedalUnfiltered;
 // sparkCutReason
-		case -56739846:
+		case 527:
 			return engine->outputChannels.sparkCutReason;
 // fuelCutReason
-		case -1225000603:
+		case 24:
 			return engine->outputChannels.fuelCutReason;
 // mafEstimate
-		case -2045040875:
+		case 608:
 			return engine->outputChannels.mafEstimate;
 // instantRpm
-		case -658597643:
+		case 405:
 			return engine->outputChannels.instantRpm;
 // rawMap
-		case 417956621:
+		case 550:
 			return engine->outputChannels.rawMap;
 // rawMapFast
-		case -1458054117:
+		case 318:
 			return engine->outputChannels.rawMapFast;
 // rawAfr
-		case 417943720:
+		case 52:
 			return engine->outputChannels.rawAfr;
 // calibrationValue2
-		case 37467836:
+		case 562:
 			return engine->outputChannels.calibrationValue2;
 // luaInvocationCounter
-		case 1766132801:
+		case 533:
 			return engine->outputChannels.luaInvocationCounter;
 // luaLastCycleDuration
-		case 823476017:
+		case 25:
 			return engine->outputChannels.luaLastCycleDuration;
 // vssEdgeCounter
-		case 385418550:
+		case 351:
 			return engine->outputChannels.vssEdgeCounter;
 // issEdgeCounter
-		case 347478025:
+		case 446:
 			return engine->outputChannels.issEdgeCounter;
 // auxLinear1
-		case 803810399:
+		case 474:
 			return engine->outputChannels.auxLinear1;
 // auxLinear2
-		case 803810400:
+		case 594:
 			return engine->outputChannels.auxLinear2;
 // auxLinear3
-		case 803810401:
+		case 287:
 			return engine->outputChannels.auxLinear3;
 // auxLinear4
-		case 803810402:
+		case 199:
 			return engine->outputChannels.auxLinear4;
 // fallbackMap
-		case -940825965:
+		case 288:
 			return engine->outputChannels.fallbackMap;
 // effectiveMap
-		case -1724101868:
+		case 122:
 			return engine->outputChannels.effectiveMap;
 // instantMAPValue
-		case -1162308767:
+		case 172:
 			return engine->outputChannels.instantMAPValue;
 // maxLockedDuration
-		case -558968637:
+		case 166:
 			return engine->outputChannels.maxLockedDuration;
 // canWriteOk
-		case 1193280444:
+		case 397:
 			return engine->outputChannels.canWriteOk;
 // canWriteNotOk
-		case 1964920685:
+		case 267:
 			return engine->outputChannels.canWriteNotOk;
 // triggerPrimaryFall
-		case 248437820:
+		case 431:
 			return engine->outputChannels.triggerPrimaryFall;
 // triggerPrimaryRise
-		case 248878000:
+		case 283:
 			return engine->outputChannels.triggerPrimaryRise;
 // triggerSecondaryFall
-		case 1016089632:
+		case 208:
 			return engine->outputChannels.triggerSecondaryFall;
 // triggerSecondaryRise
-		case 1016529812:
+		case 198:
 			return engine->outputChannels.triggerSecondaryRise;
 // starterState
-		case -1438648277:
+		case 359:
 			return engine->outputChannels.starterState;
 // starterRelayDisable
-		case 1286045659:
+		case 146:
 			return engine->outputChannels.starterRelayDisable;
 // multiSparkCounter
-		case 680091441:
+		case 345:
 			return engine->outputChannels.multiSparkCounter;
 // extiOverflowCount
-		case 1630166812:
+		case 232:
 			return engine->outputChannels.extiOverflowCount;
 // alternatorStatus.pTerm
-		case -1097329029:
+		case 74:
 			return engine->outputChannels.alternatorStatus.pTerm;
 // alternatorStatus.iTerm
-		case -1105630476:
+		case 185:
 			return engine->outputChannels.alternatorStatus.iTerm;
 // alternatorStatus.dTerm
-		case -1111560081:
+		case 305:
 			return engine->outputChannels.alternatorStatus.dTerm;
 // alternatorStatus.output
-		case -1889531804:
+		case 66:
 			return engine->outputChannels.alternatorStatus.output;
 // alternatorStatus.error
-		case -1110431971:
+		case 99:
 			return engine->outputChannels.alternatorStatus.error;
 // alternatorStatus.resetCounter
-		case -1254008074:
+		case 581:
 			return engine->outputChannels.alternatorStatus.resetCounter;
 // idleStatus.pTerm
-		case -1798819555:
+		case 374:
 			return engine->outputChannels.idleStatus.pTerm;
 // idleStatus.iTerm
-		case -1807121002:
+		case 417:
 			return engine->outputChannels.idleStatus.iTerm;
 // idleStatus.dTerm
-		case -1813050607:
+		case 40:
 			return engine->outputChannels.idleStatus.dTerm;
 // idleStatus.output
-		case 731084614:
+		case 9:
 			return engine->outputChannels.idleStatus.output;
 // idleStatus.error
-		case -1811922497:
+		case 413:
 			return engine->outputChannels.idleStatus.error;
 // idleStatus.resetCounter
-		case -424088744:
+		case 523:
 			return engine->outputChannels.idleStatus.resetCounter;
 // etbStatus.pTerm
-		case -41846406:
+		case 372:
 			return engine->outputChannels.etbStatus.pTerm;
 // etbStatus.iTerm
-		case -50147853:
+		case 303:
 			return engine->outputChannels.etbStatus.iTerm;
 // etbStatus.dTerm
-		case -56077458:
+		case 400:
 			return engine->outputChannels.etbStatus.dTerm;
 // etbStatus.output
-		case -1418343613:
+		case 576:
 			return engine->outputChannels.etbStatus.output;
 // etbStatus.error
-		case -54949348:
+		case 436:
 			return engine->outputChannels.etbStatus.error;
 // etbStatus.resetCounter
-		case 2098956565:
+		case 380:
 			return engine->outputChannels.etbStatus.resetCounter;
 // boostStatus.pTerm
-		case 407130790:
+		case 294:
 			return engine->outputChannels.boostStatus.pTerm;
 // boostStatus.iTerm
-		case 398829343:
+		case 191:
 			return engine->outputChannels.boostStatus.iTerm;
 // boostStatus.dTerm
-		case 392899738:
+		case 120:
 			return engine->outputChannels.boostStatus.dTerm;
 // boostStatus.output
-		case 513001967:
+		case 574:
 			return engine->outputChannels.boostStatus.output;
 // boostStatus.error
-		case 394027848:
+		case 461:
 			return engine->outputChannels.boostStatus.error;
 // boostStatus.resetCounter
-		case 308336833:
+		case 1:
 			return engine->outputChannels.boostStatus.resetCounter;
 // wastegateDcStatus.pTerm
-		case 1569192907:
+		case 251:
 			return engine->outputChannels.wastegateDcStatus.pTerm;
 // wastegateDcStatus.iTerm
-		case 1560891460:
+		case 387:
 			return engine->outputChannels.wastegateDcStatus.iTerm;
 // wastegateDcStatus.dTerm
-		case 1554961855:
+		case 20:
 			return engine->outputChannels.wastegateDcStatus.dTerm;
 // wastegateDcStatus.output
-		case 206346164:
+		case 125:
 			return engine->outputChannels.wastegateDcStatus.output;
 // wastegateDcStatus.error
-		case 1556089965:
+		case 425:
 			return engine->outputChannels.wastegateDcStatus.error;
 // wastegateDcStatus.resetCounter
-		case 156247622:
+		case 178:
 			return engine->outputChannels.wastegateDcStatus.resetCounter;
 // auxSpeed1
-		case 957036309:
+		case 164:
 			return engine->outputChannels.auxSpeed1;
 // auxSpeed2
-		case 957036310:
+		case 196:
 			return engine->outputChannels.auxSpeed2;
 // ISSValue
-		case 200047729:
+		case 334:
 			return engine->outputChannels.ISSValue;
 // rawBattery
-		case 1520918538:
+		case 365:
 			return engine->outputChannels.rawBattery;
 // coilState1
-		case -1124698530:
+		case 500:
 			return engine->outputChannels.coilState1;
 // coilState2
-		case -1124698529:
+		case 227:
 			return engine->outputChannels.coilState2;
 // coilState3
-		case -1124698528:
+		case 487:
 			return engine->outputChannels.coilState3;
 // coilState4
-		case -1124698527:
+		case 284:
 			return engine->outputChannels.coilState4;
 // coilState5
-		case -1124698526:
+		case 514:
 			return engine->outputChannels.coilState5;
 // coilState6
-		case -1124698525:
+		case 297:
 			return engine->outputChannels.coilState6;
 // coilState7
-		case -1124698524:
+		case 37:
 			return engine->outputChannels.coilState7;
 // coilState8
-		case -1124698523:
+		case 240:
 			return engine->outputChannels.coilState8;
 // coilState9
-		case -1124698522:
+		case 59:
 			return engine->outputChannels.coilState9;
 // coilState10
-		case 1539654222:
+		case 152:
 			return engine->outputChannels.coilState10;
 // coilState11
-		case 1539654223:
+		case 597:
 			return engine->outputChannels.coilState11;
 // coilState12
-		case 1539654224:
+		case 49:
 			return engine->outputChannels.coilState12;
 // injectorState1
-		case 2081101045:
+		case 357:
 			return engine->outputChannels.injectorState1;
 // injectorState2
-		case 2081101046:
+		case 406:
 			return engine->outputChannels.injectorState2;
 // injectorState3
-		case 2081101047:
+		case 534:
 			return engine->outputChannels.injectorState3;
 // injectorState4
-		case 2081101048:
+		case 347:
 			return engine->outputChannels.injectorState4;
 // injectorState5
-		case 2081101049:
+		case 545:
 			return engine->outputChannels.injectorState5;
 // injectorState6
-		case 2081101050:
+		case 291:
 			return engine->outputChannels.injectorState6;
 // injectorState7
-		case 2081101051:
+		case 606:
 			return engine->outputChannels.injectorState7;
 // injectorState8
-		case 2081101052:
+		case 325:
 			return engine->outputChannels.injectorState8;
 // injectorState9
-		case 2081101053:
+		case 310:
 			return engine->outputChannels.injectorState9;
 // injectorState10
-		case -43142203:
+		case 133:
 			return engine->outputChannels.injectorState10;
 // injectorState11
-		case -43142202:
+		case 233:
 			return engine->outputChannels.injectorState11;
 // injectorState12
-		case -43142201:
+		case 315:
 			return engine->outputChannels.injectorState12;
 // triggerChannel1
-		case -448033693:
+		case 194:
 			return engine->outputChannels.triggerChannel1;
 // triggerChannel2
-		case -448033692:
+		case 449:
 			return engine->outputChannels.triggerChannel2;
 // vvtChannel1
-		case -1764857649:
+		case 610:
 			return engine->outputChannels.vvtChannel1;
 // vvtChannel2
-		case -1764857648:
+		case 470:
 			return engine->outputChannels.vvtChannel2;
 // vvtChannel3
-		case -1764857647:
+		case 473:
 			return engine->outputChannels.vvtChannel3;
 // vvtChannel4
-		case -1764857646:
+		case 158:
 			return engine->outputChannels.vvtChannel4;
 // isMapPredictionActive
-		case 884518764:
+		case 565:
 			return engine->outputChannels.isMapPredictionActive;
 // outputRequestPeriod
-		case 1894184322:
+		case 554:
 			return engine->outputChannels.outputRequestPeriod;
 // mapFast
-		case -1263258735:
+		case 255:
 			return engine->outputChannels.mapFast;
 // rawMaf2
-		case 907666325:
+		case 511:
 			return engine->outputChannels.rawMaf2;
 // mafMeasured2
-		case 1663359009:
+		case 237:
 			return engine->outputChannels.mafMeasured2;
 // schedulingUsedCount
-		case 967311941:
+		case 81:
 			return engine->outputChannels.schedulingUsedCount;
 // vehicleSpeedKph
-		case -1925174695:
+		case 503:
 			return engine->outputChannels.vehicleSpeedKph;
 // Gego
-		case 2090288615:
+		case 596:
 			return engine->outputChannels.Gego;
 // testBenchIter
-		case 1092959609:
+		case 492:
 			return engine->outputChannels.testBenchIter;
 // oilTemp
-		case 1628523935:
+		case 100:
 			return engine->outputChannels.oilTemp;
 // fuelTemp
-		case -1077373465:
+		case 601:
 			return engine->outputChannels.fuelTemp;
 // ambientTemp
-		case 309572379:
+		case 176:
 			return engine->outputChannels.ambientTemp;
 // compressorDischargeTemp
-		case 553570450:
+		case 71:
 			return engine->outputChannels.compressorDischargeTemp;
 // compressorDischargePressure
-		case 1404346549:
+		case 309:
 			return engine->outputChannels.compressorDischargePressure;
 // throttleInletPressure
-		case 769340240:
+		case 551:
 			return engine->outputChannels.throttleInletPressure;
 // ignitionOnTime
-		case 795671090:
+		case 521:
 			return engine->outputChannels.ignitionOnTime;
 // engineRunTime
-		case -1165835361:
+		case 177:
 			return engine->outputChannels.engineRunTime;
 // distanceTraveled
-		case -1357387481:
+		case 160:
 			return engine->outputChannels.distanceTraveled;
 // afrGasolineScale
-		case 111403416:
+		case 332:
 			return engine->outputChannels.afrGasolineScale;
 // afr2GasolineScale
-		case 2029444810:
+		case 286:
 			return engine->outputChannels.afr2GasolineScale;
 // wheelSlipRatio
-		case 398495089:
+		case 382:
 			return engine->outputChannels.wheelSlipRatio;
 // actualLastInjectionStage2
-		case -1434098660:
+		case 87:
 			return engine->outputChannels.actualLastInjectionStage2;
 // actualLastInjectionRatioStage2
-		case -666982725:
+		case 566:
 			return engine->outputChannels.actualLastInjectionRatioStage2;
 // injectorDutyCycleStage2
-		case -1337459841:
+		case 321:
 			return engine->outputChannels.injectorDutyCycleStage2;
 // rawFlexFreq
-		case -1935221780:
+		case 279:
 			return engine->outputChannels.rawFlexFreq;
 // canReWidebandCmdStatus
-		case -823915964:
+		case 522:
 			return engine->outputChannels.canReWidebandCmdStatus;
 // deviceUid
-		case 540029591:
+		case 236:
 			return engine->outputChannels.deviceUid;
 // mc33810spiErrorCounter
-		case -1225980502:
+		case 375:
 			return engine->outputChannels.mc33810spiErrorCounter;
 // injectionPrimingCounter
-		case 1526237246:
+		case 289:
 			return engine->outputChannels.injectionPrimingCounter;
 // tempLogging2
-		case -679828716:
+		case 295:
 			return engine->outputChannels.tempLogging2;
 // acPressure
-		case 1644550754:
+		case 482:
 			return engine->outputChannels.acPressure;
 // rawAuxAnalog1
-		case 98140608:
+		case 106:
 			return engine->outputChannels.rawAuxAnalog1;
 // rawAuxAnalog2
-		case 98140609:
+		case 0:
 			return engine->outputChannels.rawAuxAnalog2;
 // rawAuxAnalog3
-		case 98140610:
+		case 331:
 			return engine->outputChannels.rawAuxAnalog3;
 // rawAuxAnalog4
-		case 98140611:
+		case 18:
 			return engine->outputChannels.rawAuxAnalog4;
 // fastAdcErrorCount
-		case -1344436946:
+		case 214:
 			return engine->outputChannels.fastAdcErrorCount;
 // slowAdcErrorCount
-		case -807823931:
+		case 333:
 			return engine->outputChannels.slowAdcErrorCount;
 // rawAuxTemp1
-		case -801974332:
+		case 207:
 			return engine->outputChannels.rawAuxTemp1;
 // rawAuxTemp2
-		case -801974331:
+		case 228:
 			return engine->outputChannels.rawAuxTemp2;
 // rawAmbientTemp
-		case 1781305509:
+		case 367:
 			return engine->outputChannels.rawAmbientTemp;
 // rtcUnixEpochTime
-		case -1684644880:
+		case 63:
 			return engine->outputChannels.rtcUnixEpochTime;
 // sparkCutReasonBlinker
-		case 927388609:
+		case 55:
 			return engine->outputChannels.sparkCutReasonBlinker;
 // fuelCutReasonBlinker
-		case 1745186508:
+		case 483:
 			return engine->outputChannels.fuelCutReasonBlinker;
 // hp
-		case 5863453:
+		case 140:
 			return engine->outputChannels.hp;
 // torque
-		case 512655621:
+		case 23:
 			return engine->outputChannels.torque;
 // throttlePressureRatio
-		case -654466797:
+		case 370:
 			return engine->outputChannels.throttlePressureRatio;
 // throttleEffectiveAreaOpening
-		case -184764139:
+		case 469:
 			return engine->outputChannels.throttleEffectiveAreaOpening;
 // mcuSerial
-		case 714144074:
+		case 593:
 			return engine->outputChannels.mcuSerial;
 // sd_error
-		case -1811686395:
+		case 226:
 			return engine->outputChannels.sd_error;
 // fastAdcOverrunCount
-		case -1422787851:
+		case 619:
 			return engine->outputChannels.fastAdcOverrunCount;
 // slowAdcOverrunCount
-		case -1166766772:
+		case 395:
 			return engine->outputChannels.slowAdcOverrunCount;
 // fastAdcLastError
-		case -1773414247:
+		case 612:
 			return engine->outputChannels.fastAdcLastError;
 // fastAdcPeriod
-		case -1798837954:
+		case 264:
 			return engine->outputChannels.fastAdcPeriod;
 // fastAdcConversionCount
-		case 1749059722:
+		case 170:
 			return engine->outputChannels.fastAdcConversionCount;
 // canReWidebandVersion
-		case -2850030:
+		case 553:
 			return engine->outputChannels.canReWidebandVersion;
 // canReWidebandFwDay
-		case 888763399:
+		case 415:
 			return engine->outputChannels.canReWidebandFwDay;
 // canReWidebandFwMon
-		case 888773651:
+		case 506:
 			return engine->outputChannels.canReWidebandFwMon;
 // canReWidebandFwYear
-		case -734820550:
+		case 33:
 			return engine->outputChannels.canReWidebandFwYear;
 // transitionEventCode
-		case -1006487219:
+		case 200:
 			return engine->outputChannels.transitionEventCode;
 // transitionEventsCounter
-		case 1163075685:
+		case 147:
 			return engine->outputChannels.transitionEventsCounter;
 // baseDwell
-		case -1777838088:
+		case 131:
 			return engine->ignitionState.baseDwell;
 // sparkDwell
-		case -903101570:
+		case 501:
 			return engine->ignitionState.sparkDwell;
 // dwellDurationAngle
-		case -1208021110:
+		case 434:
 			return engine->ignitionState.dwellDurationAngle;
 // cltTimingCorrection
-		case 256951528:
+		case 136:
 			return engine->ignitionState.cltTimingCorrection;
 // timingIatCorrection
-		case -1886479485:
+		case 428:
 			return engine->ignitionState.timingIatCorrection;
 // timingPidCorrection
-		case -319326974:
+		case 269:
 			return engine->ignitionState.timingPidCorrection;
 // dfcoTimingRetard
-		case -735105365:
+		case 108:
 			return engine->ignitionState.dfcoTimingRetard;
 // baseIgnitionAdvance
-		case 493641747:
+		case 7:
 			return engine->ignitionState.baseIgnitionAdvance;
 // correctedIgnitionAdvance
-		case 352421907:
+		case 145:
 			return engine->ignitionState.correctedIgnitionAdvance;
 // tractionAdvanceDrop
-		case -899895696:
+		case 343:
 			return engine->ignitionState.tractionAdvanceDrop;
 // dwellVoltageCorrection
-		case -80612537:
+		case 205:
 			return engine->ignitionState.dwellVoltageCorrection;
 // luaTimingAdd
-		case -309610760:
+		case 150:
 			return engine->ignitionState.luaTimingAdd;
 // luaTimingMult
-		case -1626770351:
+		case 3:
 			return engine->ignitionState.luaTimingMult;
 // luaIgnitionSkip
-		case -1916613921:
+		case 163:
 			return engine->ignitionState.luaIgnitionSkip;
 // trailingSparkAngle
-		case 274318471:
+		case 438:
 			return engine->ignitionState.trailingSparkAngle;
 // rpmForIgnitionTableDot
-		case 1700636875:
+		case 468:
 			return engine->ignitionState.rpmForIgnitionTableDot;
 // rpmForIgnitionIdleTableDot
-		case -80687031:
+		case 249:
 			return engine->ignitionState.rpmForIgnitionIdleTableDot;
 // loadForIgnitionTableDot
-		case 2031242236:
+		case 564:
 			return engine->ignitionState.loadForIgnitionTableDot;
 // m_knockLevel
-		case -1571781441:
+		case 412:
 			return engine->module<KnockController>()->m_knockLevel;
 // m_knockRetard
-		case -94443575:
+		case 73:
 			return engine->module<KnockController>()->m_knockRetard;
 // m_knockThreshold
-		case -504596140:
+		case 260:
 			return engine->module<KnockController>()->m_knockThreshold;
 // m_knockCount
-		case -1582096144:
+		case 93:
 			return engine->module<KnockController>()->m_knockCount;
 // m_maximumRetard
-		case 164334513:
+		case 123:
 			return engine->module<KnockController>()->m_maximumRetard;
 // m_knockSpectrumChannelCyl
-		case -806484581:
+		case 192:
 			return engine->module<KnockController>()->m_knockSpectrumChannelCyl;
 // m_knockFrequencyStart
-		case -592323161:
+		case 10:
 			return engine->module<KnockController>()->m_knockFrequencyStart;
 // m_knockFrequencyStep
-		case 1283556181:
+		case 266:
 			return engine->module<KnockController>()->m_knockFrequencyStep;
 // m_knockFuelTrimMultiplier
-		case 95716118:
+		case 495:
 			return engine->module<KnockController>()->m_knockFuelTrimMultiplier;
 // m_isPriming
-		case -612624925:
+		case 259:
 			return engine->module<PrimeController>()->m_isPriming;
 // fan1cranking
-		case -113087656:
+		case 28:
 			return engine->module<FanControl1>()->cranking;
 // fan1notRunning
-		case -150769059:
+		case 589:
 			return engine->module<FanControl1>()->notRunning;
 // fan1disabledWhileEngineStopped
-		case 168011889:
+		case 560:
 			return engine->module<FanControl1>()->disabledWhileEngineStopped;
 // fan1brokenClt
-		case -614909137:
+		case 4:
 			return engine->module<FanControl1>()->brokenClt;
 // fan1enabledForAc
-		case -662113279:
+		case 77:
 			return engine->module<FanControl1>()->enabledForAc;
 // fan1hot
-		case -1717868938:
+		case 539:
 			return engine->module<FanControl1>()->hot;
 // fan1cold
-		case -855279955:
+		case 558:
 			return engine->module<FanControl1>()->cold;
 // fan1disabledBySpeed
-		case 890832495:
+		case 134:
 			return engine->module<FanControl1>()->disabledBySpeed;
 // fan1m_state
-		case -1997175144:
+		case 69:
 			return engine->module<FanControl1>()->m_state;
 // fan1radiatorFanStatus
-		case -1478067590:
+		case 404:
 			return engine->module<FanControl1>()->radiatorFanStatus;
 // fan1pwmCurvePwm
-		case 86008152:
+		case 75:
 			return engine->module<FanControl1>()->pwmCurvePwm;
 // fan1pwmTargetPwm
-		case -850386982:
+		case 352:
 			return engine->module<FanControl1>()->pwmTargetPwm;
 // fan1pwmAppliedPwm
-		case -1368130286:
+		case 338:
 			return engine->module<FanControl1>()->pwmAppliedPwm;
 // fan1pwmActive
-		case 638039515:
+		case 559:
 			return engine->module<FanControl1>()->pwmActive;
 // fan2cranking
-		case 1841224793:
+		case 60:
 			return engine->module<FanControl2>()->cranking;
 // fan2notRunning
-		case 2086676382:
+		case 451:
 			return engine->module<FanControl2>()->notRunning;
 // fan2disabledWhileEngineStopped
-		case 494714802:
+		case 466:
 			return engine->module<FanControl2>()->disabledWhileEngineStopped;
 // fan2brokenClt
-		case -547107760:
+		case 435:
 			return engine->module<FanControl2>()->brokenClt;
 // fan2enabledForAc
-		case 669515138:
+		case 248:
 			return engine->module<FanControl2>()->enabledForAc;
 // fan2hot
-		case -1717833001:
+		case 154:
 			return engine->module<FanControl2>()->hot;
 // fan2cold
-		case -854094034:
+		case 563:
 			return engine->module<FanControl2>()->cold;
 // fan2disabledBySpeed
-		case 1095642192:
+		case 480:
 			return engine->module<FanControl2>()->disabledBySpeed;
 // fan2m_state
-		case 1966562169:
+		case 422:
 			return engine->module<FanControl2>()->m_state;
 // fan2radiatorFanStatus
-		case -1778606949:
+		case 190:
 			return engine->module<FanControl2>()->radiatorFanStatus;
 // fan2pwmCurvePwm
-		case 907263673:
+		case 418:
 			return engine->module<FanControl2>()->pwmCurvePwm;
 // fan2pwmTargetPwm
-		case 481241435:
+		case 590:
 			return engine->module<FanControl2>()->pwmTargetPwm;
 // fan2pwmAppliedPwm
-		case -374065485:
+		case 392:
 			return engine->module<FanControl2>()->pwmAppliedPwm;
 // fan2pwmActive
-		case 705840892:
+		case 595:
 			return engine->module<FanControl2>()->pwmActive;
 // isPrime
-		case -1429286498:
+		case 118:
 			return engine->module<FuelPumpController>()->isPrime;
 // engineTurnedRecently
-		case -1270448973:
+		case 313:
 			return engine->module<FuelPumpController>()->engineTurnedRecently;
 // isFuelPumpOn
-		case -344048084:
+		case 498:
 			return engine->module<FuelPumpController>()->isFuelPumpOn;
 // ignitionOn
-		case -381519965:
+		case 339:
 			return engine->module<FuelPumpController>()->ignitionOn;
 // lua.fuelAdd
-		case 1649801578:
+		case 38:
 			return engine->engineState.lua.fuelAdd;
 // lua.fuelMult
-		case -1390672637:
+		case 277:
 			return engine->engineState.lua.fuelMult;
 // lua.engineTorque
-		case 958239307:
+		case 401:
 			return engine->engineState.lua.engineTorque;
 // lua.clutchUpState
-		case -427776066:
+		case 452:
 			return engine->engineState.lua.clutchUpState;
 // lua.brakePedalState
-		case -1296201087:
+		case 517:
 			return engine->engineState.lua.brakePedalState;
 // lua.acRequestState
-		case 1517904291:
+		case 592:
 			return engine->engineState.lua.acRequestState;
 // lua.luaDisableEtb
-		case 2055342630:
+		case 167:
 			return engine->engineState.lua.luaDisableEtb;
 // lua.luaIgnCut
-		case -802271455:
+		case 420:
 			return engine->engineState.lua.luaIgnCut;
 // lua.luaFuelCut
-		case 252935343:
+		case 471:
 			return engine->engineState.lua.luaFuelCut;
 // lua.clutchDownState
-		case 133427185:
+		case 598:
 			return engine->engineState.lua.clutchDownState;
 // lua.disableDecelerationFuelCutOff
-		case 1680936043:
+		case 509:
 			return engine->engineState.lua.disableDecelerationFuelCutOff;
 // lua.torqueReductionState
-		case -1605036797:
+		case 46:
 			return engine->engineState.lua.torqueReductionState;
 // sd.tCharge
-		case -893334680:
+		case 280:
 			return engine->engineState.sd.tCharge;
 // sd.tChargeK
-		case 584726739:
+		case 583:
 			return engine->engineState.sd.tChargeK;
 // crankingFuel.coolantTemperatureCoefficient
-		case -1206067863:
+		case 54:
 			return engine->engineState.crankingFuel.coolantTemperatureCoefficient;
 // crankingFuel.tpsCoefficient
-		case 20251202:
+		case 274:
 			return engine->engineState.crankingFuel.tpsCoefficient;
 // crankingFuel.baseFuel
-		case 1119735859:
+		case 605:
 			return engine->engineState.crankingFuel.baseFuel;
 // crankingFuel.fuel
-		case -180401224:
+		case 464:
 			return engine->engineState.crankingFuel.fuel;
 // baroCorrection
-		case -281693247:
+		case 529:
 			return engine->engineState.baroCorrection;
 // hellenBoardId
-		case -295556270:
+		case 109:
 			return engine->engineState.hellenBoardId;
 // clutchUpState
-		case -797965330:
+		case 31:
 			return engine->engineState.clutchUpState;
 // brakePedalState
-		case -705383759:
+		case 409:
 			return engine->engineState.brakePedalState;
 // startStopState
-		case 897099930:
+		case 447:
 			return engine->engineState.startStopState;
 // smartChipState
-		case -517673231:
+		case 293:
 			return engine->engineState.smartChipState;
 // smartChipRestartCounter
-		case 1192769173:
+		case 45:
 			return engine->engineState.smartChipRestartCounter;
 // smartChipAliveCounter
-		case -1945673215:
+		case 516:
 			return engine->engineState.smartChipAliveCounter;
 // startStopPhysicalState
-		case -1943724937:
+		case 432:
 			return engine->engineState.startStopPhysicalState;
 // acrActive
-		case -1548941801:
+		case 159:
 			return engine->engineState.acrActive;
 // isVeSwitchTableActive
-		case 1393895570:
+		case 402:
 			return engine->engineState.isVeSwitchTableActive;
 // acrEngineMovedRecently
-		case -791147982:
+		case 78:
 			return engine->engineState.acrEngineMovedRecently;
 // heaterControlEnabled
-		case -818268726:
+		case 90:
 			return engine->engineState.heaterControlEnabled;
 // luaDigitalState0
-		case 945288534:
+		case 344:
 			return engine->engineState.luaDigitalState0;
 // luaDigitalState1
-		case 945288535:
+		case 542:
 			return engine->engineState.luaDigitalState1;
 // luaDigitalState2
-		case 945288536:
+		case 410:
 			return engine->engineState.luaDigitalState2;
 // luaDigitalState3
-		case 945288537:
+		case 388:
 			return engine->engineState.luaDigitalState3;
 // clutchDownState
-		case 724244513:
+		case 26:
 			return engine->engineState.clutchDownState;
 // startStopStateToggleCounter
-		case -960645892:
+		case 80:
 			return engine->engineState.startStopStateToggleCounter;
 // currentVe
-		case 1359980579:
+		case 427:
 			return engine->engineState.currentVe;
 // luaSoftSparkSkip
-		case -1117430949:
+		case 11:
 			return engine->engineState.luaSoftSparkSkip;
 // luaHardSparkSkip
-		case -1498397570:
+		case 116:
 			return engine->engineState.luaHardSparkSkip;
 // tractionControlSparkSkip
-		case -1555684830:
+		case 582:
 			return engine->engineState.tractionControlSparkSkip;
 // fuelInjectionCounter
-		case -1839290700:
+		case 467:
 			return engine->engineState.fuelInjectionCounter;
 // globalSparkCounter
-		case 642962903:
+		case 390:
 			return engine->engineState.globalSparkCounter;
 // fuelingLoad
-		case 583799407:
+		case 94:
 			return engine->engineState.fuelingLoad;
 // ignitionLoad
-		case 1136482406:
+		case 270:
 			return engine->engineState.ignitionLoad;
 // veTableYAxis
-		case 1568071542:
+		case 67:
 			return engine->engineState.veTableYAxis;
 // veTableIdleYAxis
-		case -860328524:
+		case 419:
 			return engine->engineState.veTableIdleYAxis;
 // overDwellCanceledCounter
-		case -1327994008:
+		case 455:
 			return engine->engineState.overDwellCanceledCounter;
 // overDwellNotScheduledCounter
-		case 1629214715:
+		case 336:
 			return engine->engineState.overDwellNotScheduledCounter;
 // sparkOutOfOrderCounter
-		case -1595596945:
+		case 181:
 			return engine->engineState.sparkOutOfOrderCounter;
 // dwellUnderChargeCounter
-		case -1256359963:
+		case 433:
 			return engine->engineState.dwellUnderChargeCounter;
 // dwellOverChargeCounter
-		case 1221247747:
+		case 86:
 			return engine->engineState.dwellOverChargeCounter;
 // dwellActualRatio
-		case -175046954:
+		case 307:
 			return engine->engineState.dwellActualRatio;
 // dcOutput0
-		case 1242329357:
+		case 493:
 			return engine->dc_motors.dcOutput0;
 // isEnabled0_int
-		case -1236599226:
+		case 64:
 			return engine->dc_motors.isEnabled0_int;
 // isEnabled0
-		case 1691876092:
+		case 308:
 			return engine->dc_motors.isEnabled0;
 #if EFI_BOOST_CONTROL
 // isTpsInvalid
-		case -575666209:
+		case 225:
 			return engine->module<BoostController>()->isTpsInvalid;
 // m_shouldResetPid
-		case 1846215200:
+		case 555:
 			return engine->module<BoostController>()->m_shouldResetPid;
 // isBelowClosedLoopThreshold
-		case 1826317915:
+		case 369:
 			return engine->module<BoostController>()->isBelowClosedLoopThreshold;
 // isNotClosedLoop
-		case -1642402810:
+		case 144:
 			return engine->module<BoostController>()->isNotClosedLoop;
 // isZeroRpm
-		case 2111912944:
+		case 329:
 			return engine->module<BoostController>()->isZeroRpm;
 // hasInitBoost
-		case -2011570052:
+		case 149:
 			return engine->module<BoostController>()->hasInitBoost;
 // rpmTooLow
-		case 193830616:
+		case 272:
 			return engine->module<BoostController>()->rpmTooLow;
 // tpsTooLow
-		case -1033638560:
+		case 575:
 			return engine->module<BoostController>()->tpsTooLow;
 // mapTooLow
-		case -734877977:
+		case 579:
 			return engine->module<BoostController>()->mapTooLow;
 // isPlantValid
-		case -304796912:
+		case 377:
 			return engine->module<BoostController>()->isPlantValid;
 // isBoostControlled
-		case -1074908546:
+		case 603:
 			return engine->module<BoostController>()->isBoostControlled;
 // luaTargetAdd
-		case 119157463:
+		case 567:
 			return engine->module<BoostController>()->luaTargetAdd;
 // luaTargetMult
-		case -362320880:
+		case 212:
 			return engine->module<BoostController>()->luaTargetMult;
 // boostControlTarget
-		case -1712045196:
+		case 481:
 			return engine->module<BoostController>()->boostControlTarget;
 // openLoopPart
-		case -1481117304:
+		case 561:
 			return engine->module<BoostController>()->openLoopPart;
 // openLoopYAxis
-		case -1621551201:
+		case 340:
 			return engine->module<BoostController>()->openLoopYAxis;
 // luaOpenLoopAdd
-		case 1944984220:
+		case 68:
 			return engine->module<BoostController>()->luaOpenLoopAdd;
 // boostControllerClosedLoopPart
-		case -707712709:
+		case 502:
 			return engine->module<BoostController>()->boostControllerClosedLoopPart;
 // boostOutput
-		case 1239062717:
+		case 578:
 			return engine->module<BoostController>()->boostOutput;
 #endif
 #if EFI_ENGINE_CONTROL
 // totalFuelCorrection
-		case -1779658835:
+		case 182:
 			return engine->fuelComputer.totalFuelCorrection;
 // running.postCrankingFuelCorrection
-		case -1288205717:
+		case 127:
 			return engine->fuelComputer.running.postCrankingFuelCorrection;
 // running.intakeTemperatureCoefficient
-		case 197173469:
+		case 538:
 			return engine->fuelComputer.running.intakeTemperatureCoefficient;
 // running.coolantTemperatureCoefficient
-		case 1822238385:
+		case 135:
 			return engine->fuelComputer.running.coolantTemperatureCoefficient;
 // running.timeSinceCrankingInSecs
-		case 526786951:
+		case 22:
 			return engine->fuelComputer.running.timeSinceCrankingInSecs;
 // running.baseFuel
-		case -42886021:
+		case 437:
 			return engine->fuelComputer.running.baseFuel;
 // running.fuel
-		case -794283008:
+		case 84:
 			return engine->fuelComputer.running.fuel;
 // afrTableYAxis
-		case 995190836:
+		case 165:
 			return engine->fuelComputer.afrTableYAxis;
 // targetLambda
-		case -734904659:
+		case 111:
 			return engine->fuelComputer.targetLambda;
 // targetAFR
-		case 2122891301:
+		case 148:
 			return engine->fuelComputer.targetAFR;
 // stoichiometricRatio
-		case 341978922:
+		case 353:
 			return engine->fuelComputer.stoichiometricRatio;
 // sdTcharge_coff
-		case 1417236183:
+		case 439:
 			return engine->fuelComputer.sdTcharge_coff;
 // sdAirMassInOneCylinder
-		case 1650433343:
+		case 423:
 			return engine->fuelComputer.sdAirMassInOneCylinder;
 // normalizedCylinderFilling
-		case 1599780729:
+		case 519:
 			return engine->fuelComputer.normalizedCylinderFilling;
 // brokenInjector
-		case -1453554940:
+		case 322:
 			return engine->fuelComputer.brokenInjector;
 // idealEngineTorque
-		case -791713926:
+		case 531:
 			return engine->fuelComputer.idealEngineTorque;
 // injectorHwIssue
-		case -1237512821:
+		case 243:
 			return engine->fuelComputer.injectorHwIssue;
 #endif
 #if EFI_LAUNCH_CONTROL
 // retardThresholdRpm
-		case -1374156957:
+		case 515:
 			return engine->launchController.retardThresholdRpm;
 // launchActivatePinState
-		case 1928406809:
+		case 203:
 			return engine->launchController.launchActivatePinState;
 // isPreLaunchCondition
-		case -1872098102:
+		case 103:
 			return engine->launchController.isPreLaunchCondition;
 // isLaunchCondition
-		case -1959120957:
+		case 489:
 			return engine->launchController.isLaunchCondition;
 // isSwitchActivated
-		case 1699495432:
+		case 348:
 			return engine->launchController.isSwitchActivated;
 // isClutchActivated
-		case 1569151513:
+		case 391:
 			return engine->launchController.isClutchActivated;
 // isBrakePedalActivated
-		case 781025153:
+		case 39:
 			return engine->launchController.isBrakePedalActivated;
 // isValidInputPin
-		case -978523544:
+		case 8:
 			return engine->launchController.isValidInputPin;
 // activateSwitchCondition
-		case 1265600943:
+		case 497:
 			return engine->launchController.activateSwitchCondition;
 // rpmLaunchCondition
-		case 859283926:
+		case 104:
 			return engine->launchController.rpmLaunchCondition;
 // rpmPreLaunchCondition
-		case -774592003:
+		case 35:
 			return engine->launchController.rpmPreLaunchCondition;
 // speedCondition
-		case 1722712413:
+		case 354:
 			return engine->launchController.speedCondition;
 // tpsCondition
-		case 827982787:
+		case 229:
 			return engine->launchController.tpsCondition;
 // luaLaunchState
-		case 707453027:
+		case 186:
 			return engine->launchController.luaLaunchState;
 // isTorqueReductionTriggerPinValid
-		case 1922853657:
+		case 535:
 			return engine->shiftTorqueReductionController.isTorqueReductionTriggerPinValid;
 // torqueReductionTriggerPinState
-		case 501156654:
+		case 385:
 			return engine->shiftTorqueReductionController.torqueReductionTriggerPinState;
 // isTimeConditionSatisfied
-		case 1973309843:
+		case 586:
 			return engine->shiftTorqueReductionController.isTimeConditionSatisfied;
 // isRpmConditionSatisfied
-		case -304304077:
+		case 138:
 			return engine->shiftTorqueReductionController.isRpmConditionSatisfied;
 // isAppConditionSatisfied
-		case -1634779035:
+		case 174:
 			return engine->shiftTorqueReductionController.isAppConditionSatisfied;
 // isFlatShiftConditionSatisfied
-		case 1378388905:
+		case 505:
 			return engine->shiftTorqueReductionController.isFlatShiftConditionSatisfied;
 // isBelowTemperatureThreshold
-		case 319978869:
+		case 541:
 			return engine->shiftTorqueReductionController.isBelowTemperatureThreshold;
 // trqRedCutXaxisValue
-		case 468022861:
+		case 292:
 			return engine->shiftTorqueReductionController.trqRedCutXaxisValue;
 // trqRedTimeXaxisValue
-		case 1227553104:
+		case 600:
 			return engine->shiftTorqueReductionController.trqRedTimeXaxisValue;
 // trqRedIgnRetXaxisValue
-		case 892591242:
+		case 242:
 			return engine->shiftTorqueReductionController.trqRedIgnRetXaxisValue;
 // isNitrousArmed
-		case 595683774:
+		case 21:
 			return engine->module<NitrousController>()->isNitrousArmed;
 // isNitrousSpeedCondition
-		case 2135736269:
+		case 179:
 			return engine->module<NitrousController>()->isNitrousSpeedCondition;
 // isNitrousTpsCondition
-		case 1400235571:
+		case 5:
 			return engine->module<NitrousController>()->isNitrousTpsCondition;
 // isNitrousCltCondition
-		case 31747807:
+		case 607:
 			return engine->module<NitrousController>()->isNitrousCltCondition;
 // isNitrousMapCondition
-		case 541066842:
+		case 444:
 			return engine->module<NitrousController>()->isNitrousMapCondition;
 // isNitrousAfrCondition
-		case 2008830549:
+		case 403:
 			return engine->module<NitrousController>()->isNitrousAfrCondition;
 // isNitrousRpmCondition
-		case -649083733:
+		case 220:
 			return engine->module<NitrousController>()->isNitrousRpmCondition;
 // isNitrousCondition
-		case -454003684:
+		case 206:
 			return engine->module<NitrousController>()->isNitrousCondition;
 #endif
 #if EFI_PROD_CODE && EFI_ELECTRONIC_THROTTLE_BODY && FULL_SD_LOGS
 // etb1etbCurrentTarget
-		case -1044288778:
+		case 301:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->etbCurrentTarget;
 // etb1boardEtbAdjustment
-		case 1055284435:
+		case 618:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->boardEtbAdjustment;
 // etb1targetWithIdlePosition
-		case 99356871:
+		case 156:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->targetWithIdlePosition;
 // etb1luaAdjustment
-		case 1246430386:
+		case 472:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->luaAdjustment;
 // etb1trim
-		case 2069994349:
+		case 536:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->trim;
 // etb1adjustedEtbTarget
-		case -762743481:
+		case 320:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->adjustedEtbTarget;
 // etb1m_adjustedTarget
-		case 28274136:
+		case 342:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->m_adjustedTarget;
 // etb1m_wastegatePosition
-		case 561614935:
+		case 614:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->m_wastegatePosition;
 // etb1m_lastPidDtMs
-		case -1808022618:
+		case 407:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->m_lastPidDtMs;
 // etb1etbFeedForward
-		case -1970249707:
+		case 587:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->etbFeedForward;
 // etb1integralError
-		case -1507281103:
+		case 544:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->integralError;
 // etb1etbRevLimitActive
-		case -1808516876:
+		case 224:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->etbRevLimitActive;
 // etb1jamDetected
-		case -1238909045:
+		case 82:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->jamDetected;
 // etb1validPlantPosition
-		case 752161333:
+		case 27:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->validPlantPosition;
 // etb1etbTpsErrorCounter
-		case 86860621:
+		case 19:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->etbTpsErrorCounter;
 // etb1etbPpsErrorCounter
-		case 2014293065:
+		case 298:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->etbPpsErrorCounter;
 // etb1etbErrorCode
-		case 839236273:
+		case 491:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->etbErrorCode;
 // etb1etbErrorCodeBlinker
-		case -1007205736:
+		case 34:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->etbErrorCodeBlinker;
 // etb1tcEtbDrop
-		case 1502782136:
+		case 211:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->tcEtbDrop;
 // etb1jamTimer
-		case -213258422:
+		case 209:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->jamTimer;
 // etb1state
-		case -410785646:
+		case 56:
 			return getLiveDataConstexpr<electronic_throttle_s, 0>()->state;
 // etb2etbCurrentTarget
-		case 1419463927:
+		case 324:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->etbCurrentTarget;
 // etb2boardEtbAdjustment
-		case -272579820:
+		case 475:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->boardEtbAdjustment;
 // etb2targetWithIdlePosition
-		case -836653176:
+		case 230:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->targetWithIdlePosition;
 // etb2luaAdjustment
-		case -2054472109:
+		case 620:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->luaAdjustment;
 // etb2trim
-		case 2071180270:
+		case 371:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->trim;
 // etb2adjustedEtbTarget
-		case -1063282840:
+		case 398:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->adjustedEtbTarget;
 // etb2m_adjustedTarget
-		case -1802940455:
+		case 72:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->m_adjustedTarget;
 // etb2m_wastegatePosition
-		case -308232520:
+		case 396:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->m_wastegatePosition;
 // etb2m_lastPidDtMs
-		case -813957817:
+		case 477:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->m_lastPidDtMs;
 // etb2etbFeedForward
-		case 769117654:
+		case 246:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->etbFeedForward;
 // etb2integralError
-		case -513216302:
+		case 223:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->integralError;
 // etb2etbRevLimitActive
-		case -2109056235:
+		case 496:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->etbRevLimitActive;
 // etb2jamDetected
-		case -417653524:
+		case 490:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->jamDetected;
 // etb2validPlantPosition
-		case -575702922:
+		case 110:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->validPlantPosition;
 // etb2etbTpsErrorCounter
-		case -1241003634:
+		case 378:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->etbTpsErrorCounter;
 // etb2etbPpsErrorCounter
-		case 686428810:
+		case 335:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->etbPpsErrorCounter;
 // etb2etbErrorCode
-		case -2124102606:
+		case 188:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->etbErrorCode;
 // etb2etbErrorCodeBlinker
-		case -1877053191:
+		case 440:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->etbErrorCodeBlinker;
 // etb2tcEtbDrop
-		case 1570583513:
+		case 430:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->tcEtbDrop;
 // etb2jamTimer
-		case 1741054027:
+		case 512:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->jamTimer;
 // etb2state
-		case -371650253:
+		case 414:
 			return getLiveDataConstexpr<electronic_throttle_s, 1>()->state;
 #endif
 #if EFI_PROD_CODE && EFI_IDLE_CONTROL
 // m_deadtime
-		case -1167844818:
+		case 143:
 			return engine->module<InjectorModelPrimary>()->m_deadtime;
 // pressureDelta
-		case -376325528:
+		case 151:
 			return engine->module<InjectorModelPrimary>()->pressureDelta;
 // pressureRatio
-		case -359858019:
+		case 187:
 			return engine->module<InjectorModelPrimary>()->pressureRatio;
 // pressureCorrectionReference
-		case -917305595:
+		case 323:
 			return engine->module<InjectorModelPrimary>()->pressureCorrectionReference;
 // idleState
-		case 1886060228:
+		case 32:
 			return engine->module<IdleController>().unmock().idleState;
 // baseIdlePosition
-		case -580955469:
+		case 107:
 			return engine->module<IdleController>().unmock().baseIdlePosition;
 // iacByTpsTaper
-		case -2065814304:
+		case 355:
 			return engine->module<IdleController>().unmock().iacByTpsTaper;
 // mightResetPid
-		case 149945022:
+		case 168:
 			return engine->module<IdleController>().unmock().mightResetPid;
 // shouldResetPid
-		case -226320012:
+		case 360:
 			return engine->module<IdleController>().unmock().shouldResetPid;
 // wasResetPid
-		case 1830486000:
+		case 622:
 			return engine->module<IdleController>().unmock().wasResetPid;
 // isCranking
-		case -1055526802:
+		case 62:
 			return engine->module<IdleController>().unmock().isCranking;
 // isIacTableForCoasting
-		case 705044501:
+		case 571:
 			return engine->module<IdleController>().unmock().isIacTableForCoasting;
 // needReset
-		case -2049691836:
+		case 366:
 			return engine->module<IdleController>().unmock().needReset;
 // isInDeadZone
-		case -1661765918:
+		case 296:
 			return engine->module<IdleController>().unmock().isInDeadZone;
 // isBlipping
-		case 432464630:
+		case 518:
 			return engine->module<IdleController>().unmock().isBlipping;
 // badTps
-		case -208884349:
+		case 105:
 			return engine->module<IdleController>().unmock().badTps;
 // looksLikeRunning
-		case -1126009613:
+		case 204:
 			return engine->module<IdleController>().unmock().looksLikeRunning;
 // looksLikeCoasting
-		case -1786409942:
+		case 290:
 			return engine->module<IdleController>().unmock().looksLikeCoasting;
 // looksLikeCrankToIdle
-		case -2079775742:
+		case 304:
 			return engine->module<IdleController>().unmock().looksLikeCrankToIdle;
 // isIdleCoasting
-		case 2141275671:
+		case 580:
 			return engine->module<IdleController>().unmock().isIdleCoasting;
 // isIdleClosedLoop
-		case 1473688883:
+		case 604:
 			return engine->module<IdleController>().unmock().isIdleClosedLoop;
 // isIdling
-		case -212260968:
+		case 486:
 			return engine->module<IdleController>().unmock().isIdling;
 // idleTarget
-		case 2127645162:
+		case 210:
 			return engine->module<IdleController>().unmock().idleTarget;
 // idleEntryRpm
-		case -1902025276:
+		case 585:
 			return engine->module<IdleController>().unmock().idleEntryRpm;
 // idleExitRpm
-		case 190585324:
+		case 57:
 			return engine->module<IdleController>().unmock().idleExitRpm;
 // targetRpmByClt
-		case -1241725607:
+		case 88:
 			return engine->module<IdleController>().unmock().targetRpmByClt;
 // targetRpmAc
-		case 1156739423:
+		case 337:
 			return engine->module<IdleController>().unmock().targetRpmAc;
 // iacByRpmTaper
-		case -1638166696:
+		case 268:
 			return engine->module<IdleController>().unmock().iacByRpmTaper;
 // luaAdd
-		case 206059088:
+		case 613:
 			return engine->module<IdleController>().unmock().luaAdd;
 // m_lastTargetRpm
-		case 1838047931:
+		case 262:
 			return engine->module<IdleController>().unmock().m_lastTargetRpm;
 // idleClosedLoop
-		case 1267620087:
+		case 328:
 			return engine->module<IdleController>().unmock().idleClosedLoop;
 // currentIdlePosition
-		case -1149240133:
+		case 112:
 			return engine->module<IdleController>().unmock().currentIdlePosition;
 // idleTargetAirmass
-		case 1805437050:
+		case 239:
 			return engine->module<IdleController>().unmock().idleTargetAirmass;
 // idleTargetFlow
-		case -1190004798:
+		case 525:
 			return engine->module<IdleController>().unmock().idleTargetFlow;
 #endif
 #if EFI_SHAFT_POSITION_INPUT
 // vvtCamCounter
-		case 477303734:
+		case 126:
 			return engine->triggerCentral.vvtCamCounter;
 // mapVvt_MAP_AT_SPECIAL_POINT
-		case -1727829859:
+		case 615:
 			return engine->triggerCentral.mapVvt_MAP_AT_SPECIAL_POINT;
 // mapVvt_MAP_AT_DIFF
-		case -1585778708:
+		case 572:
 			return engine->triggerCentral.mapVvt_MAP_AT_DIFF;
 // mapVvt_MAP_AT_CYCLE_COUNT
-		case 1637661099:
+		case 121:
 			return engine->triggerCentral.mapVvt_MAP_AT_CYCLE_COUNT;
 // mapVvt_sync_counter
-		case 1921134430:
+		case 569:
 			return engine->triggerCentral.mapVvt_sync_counter;
 // mapVvt_min_point_counter
-		case -983339026:
+		case 222:
 			return engine->triggerCentral.mapVvt_min_point_counter;
 // temp_mapVvt_index
-		case 997197711:
+		case 416:
 			return engine->triggerCentral.temp_mapVvt_index;
 // mapVvt_CycleDelta
-		case 122475036:
+		case 346:
 			return engine->triggerCentral.mapVvt_CycleDelta;
 // currentEngineDecodedPhase
-		case 162105111:
+		case 326:
 			return engine->triggerCentral.currentEngineDecodedPhase;
 // triggerToothAngleError
-		case -280624712:
+		case 161:
 			return engine->triggerCentral.triggerToothAngleError;
 // triggerIgnoredToothCount
-		case 989545496:
+		case 499:
 			return engine->triggerCentral.triggerIgnoredToothCount;
 // mapCamPrevToothAngle
-		case 1581624998:
+		case 546:
 			return engine->triggerCentral.mapCamPrevToothAngle;
 // isDecodingMapCam
-		case 756216589:
+		case 29:
 			return engine->triggerCentral.isDecodingMapCam;
 // triggerElapsedUs
-		case 767689023:
+		case 15:
 			return engine->triggerCentral.triggerElapsedUs;
 // lambdaCurrentlyGood
-		case 350535927:
+		case 543:
 			return engine->lambdaMonitor.lambdaCurrentlyGood;
 // lambdaMonitorCut
-		case 1849938842:
+		case 180:
 			return engine->lambdaMonitor.lambdaMonitorCut;
 // lambdaTimeSinceGood
-		case 481450608:
+		case 314:
 			return engine->lambdaMonitor.lambdaTimeSinceGood;
 #endif
 #if EFI_SHAFT_POSITION_INPUT && FULL_SD_LOGS
 // trgsynchronizationCounter
-		case -1943574844:
+		case 389:
 			return engine->triggerCentral.triggerState.synchronizationCounter;
 // trgvvtToothDurations0
-		case -601476695:
+		case 453:
 			return engine->triggerCentral.triggerState.vvtToothDurations0;
 // trgvvtCurrentPosition
-		case 1926227562:
+		case 450:
 			return engine->triggerCentral.triggerState.vvtCurrentPosition;
 // trgtriggerSyncGapRatio
-		case 1313522810:
+		case 552:
 			return engine->triggerCentral.triggerState.triggerSyncGapRatio;
 // trgtriggerStateIndex
-		case 310661471:
+		case 484:
 			return engine->triggerCentral.triggerState.triggerStateIndex;
 // trgtriggerCountersError
-		case 1108896195:
+		case 42:
 			return engine->triggerCentral.triggerState.triggerCountersError;
 // vvt1isynchronizationCounter
-		case -608535663:
+		case 175:
 			return engine->triggerCentral.vvtState[0][0].synchronizationCounter;
 // vvt1ivvtToothDurations0
-		case 1574758390:
+		case 14:
 			return engine->triggerCentral.vvtState[0][0].vvtToothDurations0;
 // vvt1ivvtCurrentPosition
-		case -192504649:
+		case 215:
 			return engine->triggerCentral.vvtState[0][0].vvtCurrentPosition;
 // vvt1itriggerSyncGapRatio
-		case 114836583:
+		case 117:
 			return engine->triggerCentral.vvtState[0][0].triggerSyncGapRatio;
 // vvt1itriggerStateIndex
-		case -404295156:
+		case 61:
 			return engine->triggerCentral.vvtState[0][0].triggerStateIndex;
 // vvt1itriggerCountersError
-		case 206956368:
+		case 197:
 			return engine->triggerCentral.vvtState[0][0].triggerCountersError;
 // vvt1esynchronizationCounter
-		case -1159462771:
+		case 443:
 			return engine->triggerCentral.vvtState[0][1].synchronizationCounter;
 // vvt1evvtToothDurations0
-		case -1703719182:
+		case 556:
 			return engine->triggerCentral.vvtState[0][1].vvtToothDurations0;
 // vvt1evvtCurrentPosition
-		case 823985075:
+		case 119:
 			return engine->triggerCentral.vvtState[0][1].vvtCurrentPosition;
 // vvt1etriggerSyncGapRatio
-		case -700740893:
+		case 50:
 			return engine->triggerCentral.vvtState[0][1].triggerSyncGapRatio;
 // vvt1etriggerStateIndex
-		case 797862280:
+		case 411:
 			return engine->triggerCentral.vvtState[0][1].triggerStateIndex;
 // vvt1etriggerCountersError
-		case -937296564:
+		case 231:
 			return engine->triggerCentral.vvtState[0][1].triggerCountersError;
 // vvt2isynchronizationCounter
-		case -1432096142:
+		case 588:
 			return engine->triggerCentral.vvtState[1][0].synchronizationCounter;
 // vvt2ivvtToothDurations0
-		case 704910935:
+		case 132:
 			return engine->triggerCentral.vvtState[1][0].vvtToothDurations0;
 // vvt2ivvtCurrentPosition
-		case -1062352104:
+		case 448:
 			return engine->triggerCentral.vvtState[1][0].vvtCurrentPosition;
 // vvt2itriggerSyncGapRatio
-		case 1474641640:
+		case 504:
 			return engine->triggerCentral.vvtState[1][0].triggerSyncGapRatio;
 // vvt2itriggerStateIndex
-		case -1732159411:
+		case 252:
 			return engine->triggerCentral.vvtState[1][0].triggerStateIndex;
 // vvt2itriggerCountersError
-		case 2130850289:
+		case 373:
 			return engine->triggerCentral.vvtState[1][0].triggerCountersError;
 // vvt2esynchronizationCounter
-		case -1983023250:
+		case 101:
 			return engine->triggerCentral.vvtState[1][1].synchronizationCounter;
 // vvt2evvtToothDurations0
-		case 1721400659:
+		case 254:
 			return engine->triggerCentral.vvtState[1][1].vvtToothDurations0;
 // vvt2evvtCurrentPosition
-		case -45862380:
+		case 261:
 			return engine->triggerCentral.vvtState[1][1].vvtCurrentPosition;
 // vvt2etriggerSyncGapRatio
-		case 659064164:
+		case 213:
 			return engine->triggerCentral.vvtState[1][1].triggerSyncGapRatio;
 // vvt2etriggerStateIndex
-		case -530001975:
+		case 621:
 			return engine->triggerCentral.vvtState[1][1].triggerStateIndex;
 // vvt2etriggerCountersError
-		case 986597357:
+		case 381:
 			return engine->triggerCentral.vvtState[1][1].triggerCountersError;
 #endif
 #if EFI_VVT_PID
 // vvtTarget
-		case -2132393748:
+		case 271:
 			return engine->module<VvtController1>()->vvtTarget;
 // vvtOutput
-		case 1990697206:
+		case 282:
 			return engine->module<VvtController1>()->vvtOutput;
 #endif
 #if FULL_SD_LOGS
 // acButtonState
-		case -1809939546:
+		case 549:
 			return engine->module<AcController>()->acButtonState;
 // m_acEnabled
-		case 449790048:
+		case 510:
 			return engine->module<AcController>()->m_acEnabled;
 // engineTooSlow
-		case 1183441554:
+		case 285:
 			return engine->module<AcController>()->engineTooSlow;
 // engineTooFast
-		case 1182962523:
+		case 311:
 			return engine->module<AcController>()->engineTooFast;
 // noClt
-		case 268704037:
+		case 137:
 			return engine->module<AcController>()->noClt;
 // engineTooHot
-		case 1467505752:
+		case 513:
 			return engine->module<AcController>()->engineTooHot;
 // tpsTooHigh
-		case 249515182:
+		case 114:
 			return engine->module<AcController>()->tpsTooHigh;
 // isDisabledByLua
-		case 1199244598:
+		case 599:
 			return engine->module<AcController>()->isDisabledByLua;
 // acCompressorState
-		case -1015278697:
+		case 349:
 			return engine->module<AcController>()->acCompressorState;
 // acPressureTooLow
-		case -1208328954:
+		case 617:
 			return engine->module<AcController>()->acPressureTooLow;
 // acPressureTooHigh
-		case -1220300524:
+		case 479:
 			return engine->module<AcController>()->acPressureTooHigh;
 #endif
 #if MODULE_VVL_CONTROLLER
 // isVvlTpsCondition
-		case 365919991:
+		case 275:
 			return engine->module<VvlController>()->isVvlTpsCondition;
 // isVvlCltCondition
-		case -1002567773:
+		case 316:
 			return engine->module<VvlController>()->isVvlCltCondition;
 // isVvlMapCondition
-		case -493248738:
+		case 429:
 			return engine->module<VvlController>()->isVvlMapCondition;
 // isVvlAfrCondition
-		case 974514969:
+		case 476:
 			return engine->module<VvlController>()->isVvlAfrCondition;
 // isVvlRpmCondition
-		case -1683399313:
+		case 258:
 			return engine->module<VvlController>()->isVvlRpmCondition;
 // isVvlCondition
-		case 1072636768:
+		case 193:
 			return engine->module<VvlController>()->isVvlCondition;
 #endif
 	}
 	return EFI_ERROR_CODE;
 }
+float getOutputValueByHash(const int hash) {
+	int slot = getOutputSlotByHash(hash);
+	if (slot >= 0)
+		return getOutputValueBySlot(slot);
+	return EFI_ERROR_CODE;
+}
 float getOutputValueByName(const char *name) {
 	int hash = djb2lowerCase(name);
 	return getOutputValueByHash(hash);
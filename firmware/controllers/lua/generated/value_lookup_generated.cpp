@@ -2,2144 +2,2269 @@
 #include "pch.h"
 #include "board_lookup.h"
 #include "value_lookup.h"
-float getConfigValueByHash(const int hash) {
-	switch(hash) {
+static const int configHashBySlot[711] = {
+	47348059, 423655964, 2104472173, -904771683, -1829995308, 454615641, -798441680, -1415562185,
+	2016887022, 1509355736, -4616606, 1509355730, 329016035, -102001909, -1976642929, -1297544722,
+	931823549, 298649674, 280323355, -1985448683, 991724096, -1415669995, 1756514810, 578933872,
+	-1195844556, 1514634753, 872435040, 764445240, -1742418701, 1494394654, -25671466, -1671871759,
+	-1084262094, 1286770247, -1622665645, -1190930054, 1152218288, -727614755, -613392361, -776106289,
+	263235302, -1786673317, -1992945039, 161953459, -587700301, -1465119085, 934247460, 1486014321,
+	2115625312, -1056007485, -568903712, -1285484724, -1104834801, -1906717594, -1415598121, 1049828813,
+	1752481431, -763820449, 196797309, -1896516795, -464180576, 1509355729, 161953462, -713764196,
+	-1499796020, 755512282, 1427131506, 223926129, -672272160, -1014418505, -1623166029, -1014418504,
+	-695344665, -1794416277, -1816997974, -1564912640, 871106583, 2071041633, -430252676, -474791502,
+	764445241, 444648859, 306303086, -1171243585, -572500550, 1597749004, -2065042706, -311454863,
+	840966724, 38426001, -722238362, 2032707103, 589242035, -1898025562, 2070727975, -1607465307,
+	-794334344, -90543309, -1832527324, 1470846937, 1564984000, 1538579992, 600643125, 1611799720,
+	-920116109, -717549157, 1830002033, 1156367906, 1532941388, 161953465, 667504645, -708922423,
+	-1087585075, -1189603841, -474791503, 1570551154, 341519713, -364626778, -1965056926, -1084296599,
+	-1415669996, 794879319, 436500704, -2021435668, 1408421157, 9388880, -900025102, 201676494,
+	1742748825, -1058844738, -54973711, 1570088896, -1251676000, -1334689362, 1664668368, -1404414917,
+	-775882810, -1269130308, -1164331270, 119460051, -1494043213, 46918724, -65154788, -1491889938,
+	1455224910, -1011866871, -174866119, 107641479, -1153051360, 1697484698, -1085712470, 1464880398,
+	-272710799, 892958612, -672272162, 1983046327, 1779689293, 671821024, -195378748, 1542550121,
+	1698191973, 161953464, -556893719, -965453331, -1794692883, 1952621969, -102014810, -1726245940,
+	-1832527323, 535118708, 2032707104, 379403209, -469950118, -1494053736, -1331668704, -5328868,
+	107641733, 1988973320, 983814707, -1847892463, -727657058, 203921593, 1509355734, 1232469673,
+	512911183, -1742418955, -1415562184, -1661556925, 629168265, 399466905, 42872346, 1532957848,
+	-1121870933, -1495799741, -1460957867, 168701078, -1084296598, -2094010831, -647008743, 1117566701,
+	1057701663, 2099527693, -789855065, 1935395744, -491371088, -699822859, 275986512, -672272161,
+	298344625, -1862337922, 1145888170, -1995686573, -371707639, -2130836456, 383307083, 1097520823,
+	1295852216, -269110527, 1580101425, -81412933, -235994182, 1094944685, -376859614, -945021094,
+	1362186948, -613392360, -485091122, 1181153770, -346622972, -413489794, -1415634058, -1084296600,
+	1313479950, -991890097, -2065814304, -1811840427, 1272017572, 38719415, 1523832034, -487204662,
+	-425992769, 379679459, -1965075262, -1354884979, -869432403, -1407066344, -999870619, -213773345,
+	13806936, -785386645, 1072117635, -2101952506, 1664936450, -1032938305, -1311217456, -1434278346,
+	983231621, -506535813, 1838375282, 993282195, 665024981, -677571211, -2016978331, -1118241790,
+	334494733, -599338669, -1460957868, 401321850, 1028902582, -1297544723, 1435801342, -1274631759,
+	-1730868478, -786901709, -2079591860, 1523829850, -2096650725, 178430876, 923152418, -282198091,
+	-312962799, -1644699118, -2146852436, 896753456, 2012123720, 957244017, -81415311, -221893735,
+	-360834835, 6238478, 270256825, 275986514, -1578655365, -1256791716, 1640008461, -1832431020,
+	-582951931, -2146434132, -980843809, -1297544724, -617548836, -1284354759, -418454384, 402092253,
+	-1401426415, -1743747394, -491094482, -1832527325, -853358747, 1160459527, -1888587696, -396384771,
+	617337449, 1569359006, -1058844737, 878369918, -2136933308, -427105966, 866072300, -677584112,
+	-908268760, 220694456, -180298801, 1427207708, 161953461, -2111374247, -617915487, -511528784,
+	-1555883851, -1958312328, -1644887108, 1170565107, -1725192730, -2114430012, -1572546086, 1089348504,
+	1007396714, -1547587839, -893354748, -938609466, -954321508, -528043591, 457158886, -1373423899,
+	939816194, 2043354390, -1307181880, -965637402, 1081026348, -495855925, -933524784, -1404613719,
+	-2027523439, 1470830477, -1227821282, -1155937004, 259909218, 872437224, -1686338448, 1115446416,
+	859066570, -1514354211, 1881137064, -1256791970, 99110078, -48120222, 903483241, -2033984419,
+	-498450107, 629168264, -338157684, 1746193407, -2079960526, -243078627, -1132710384, 1025426144,
+	1569342546, -1409016614, -589710926, 1543085651, -1340834204, -524949197, 1176614802, -1195844554,
+	2094922339, 554586032, 245947066, -784200724, 582390322, 535118454, -65154789, -60727986,
+	-188591438, 1758659040, 483010008, -498450106, 1988973322, -1411996731, -389678699, 1273287930,
+	-1645106444, 787397010, 218340072, -390306941, 435614729, -1014418506, 128251338, 1490213215,
+	-838808073, 1212570205, -241663117, 1574876352, 1152494894, -557658095, 1643181024, 1414346958,
+	1917301199, -1855700175, 161953463, -1744146782, 402026201, -561715997, -325018342, -1171243586,
+	-1879090979, -1195844555, -790131671, -1284359115, -396384772, -855687130, -2086516502, -1236202550,
+	1506446058, 1509355733, -1147263902, -1798887513, 173166222, 878369917, 878369919, -5328869,
+	514256961, -1528619572, 62925536, 4130389, 1658738502, 1523813390, -2018683234, -1575487611,
+	-781828882, -464979268, 996346642, -608466667, 1318639761, 1164012327, -1852204335, -1993968289,
+	-395416807, -2020267706, -1055678778, -505201426, 1322924702, 1540420600, 1397079021, 1498075808,
+	726613349, 1879050865, 445194564, 1561929785, 625338761, -1724873939, -2138018615, 596585178,
+	-1494035092, -137390524, -819413824, 1060606307, -1128797750, 216872574, -695395485, -1725192476,
+	-505257057, 1281862911, 602046867, 161953466, 1762426578, -1460984893, 1997151643, 285726462,
+	1541525498, 1856486116, 1474689568, 304164959, -81483444, -713764194, -244496183, -1343193327,
+	-1944260329, -1760115393, -722238360, -1976634808, -722238357, -106437949, 1425664391, -783014803,
+	839486731, 1509051617, -731677323, 1925843479, -505257058, -1074393096, -953183719, 337194154,
+	465982216, -1256141959, 355839382, 20003211, 1958105647, -486240071, 1182499943, -295413160,
+	309682334, -253720028, 436500697, 1989648303, -1997438905, 346390417, 1509355735, -1197734314,
+	-900025104, 1467553180, 1470507575, 1546871344, -1655178001, 747573348, -1077032999, 296563315,
+	-1562952959, -543684839, -1008029221, -241663116, -618104323, 1451020756, 629168263, 893776859,
+	-722238359, -1056203297, -339821344, 799798215, -1923222129, -103982236, 1651400031, -1603423011,
+	-135093297, 48235288, -1104834800, 1953870952, -2116746650, -1730868480, -727614754, 594789367,
+	68539114, 288250022, 1509355732, -253543882, -1771449111, 4686563, -722238361, -2104625325,
+	734290080, -509113657, 1226423210, -391393956, -1188944476, 1988973321, -2070332548, 1758661224,
+	-311714733, -1373131840, 1068374799, 1997663388, 663037299, -1359134883, 2115625058, 1849727793,
+	-1415634059, -713764195, 1145081382, 1673018859, -1898025561, 29505657, 666098796, 1676700208,
+	-1460957866, 1064399425, 118504154, 1933500210, 30701245, -1194560694, -722238358, -1492464952,
+	-2142425790, 1089367148, 2048390406, -1073210355, -893360504, 387956265, 727066858, -1658957891,
+	971442495, -1583589783, 1049496900, -1730868479, 1081456939, 944657936, 275986513, 1509355728,
+	-631762165, 1962548154, -264572349, -1415598122, 341693817, 1445062086, 470555289, -1480283119,
+	-1899369472, -24313313, 670644444, 1915146851, -1279270887, -1196188030, 743163558, 2136379132,
+	-726159643, 1421783686, -1976636992, -1765427939, -866520333, -172907815, -723870257, 1562875200,
+	756523164, -773841334, -54532767, 183555079, -1992436143, 406607630, -1934896346, 1129109559,
+	-298185774, -5328867, 1509355731, 1972605869, -1198455285, -423426795, -2011139708, 1850657816,
+	-1543452424, -1788499857, 11736566, -1717336209, -1157123369, 58931511, -1833685972, 1945443830,
+	-1622665899, -1009116322, -25671212, 992359619, -900025103, -664540020, 586887955, -2071167002,
+	-763838959, 1077467605, 171869155, 777954680, -1942479387, 685453869, -283215870, -498450105,
+	-105464622, 1887120139, 1273287931, -1990709262, -204721234, -528008450, -282198345, -791880034,
+	1664917806, 1470507576, 578657622, 1590125629, -653172717, 161953460, 644409862, -1104834799,
+	601094003, -2086522258, -846143628, 1000921080, 2122875976, 1188684607, 1616873838, -289303407,
+	950993889, 496209836, 1569361190, -563973567, -566786093, 2030571545, 1979839970,
+};
+static const uint16_t configSeedByBucket[178] = {
+	28, 7, 79, 115, 0, 175, 42, 57,
+	9, 27, 1, 68, 10, 4, 151, 235,
+	169, 139, 30, 102, 173, 48, 146, 23,
+	3, 16, 23, 37, 73, 8, 1, 31,
+	2, 50, 30, 70, 21, 46, 67, 2,
+	214, 9, 20, 3, 47, 27, 4, 18,
+	98, 18, 3, 12, 1, 20, 71, 0,
+	248, 531, 14, 5, 149, 62, 744, 12,
+	0, 0, 1, 76, 32, 32, 1, 12,
+	6, 75, 2, 35, 120, 67, 207, 179,
+	483, 132, 68, 64, 630, 82, 564, 112,
+	0, 0, 3, 137, 96, 112, 3, 689,
+	9, 2, 1132, 152, 4, 831, 13, 49,
+	9, 55, 0, 1004, 65, 10, 1, 28,
+	105, 150, 6, 130, 203, 0, 0, 60,
+	1, 332, 102, 15, 89, 79, 28, 0,
+	30, 26, 77, 4, 1397, 51, 248, 33,
+	0, 41, 308, 0, 4, 167, 4, 0,
+	0, 21, 737, 10, 1161, 5, 14, 0,
+	54, 74, 88, 15, 1774, 101, 751, 6106,
+	30, 16, 2444, 1355, 263, 6, 148, 110,
+	661, 0, 20, 672, 0, 265, 25, 1,
+	402, 540,
+};
+int getConfigSlotByHash(const int hash) {
+	return perfectHashLookup(hash, configHashBySlot, configSeedByBucket);
+}
+float getConfigValueBySlot(const int slot) {
+	switch(slot) {
 // startButtonSuppressOnStartUpMs
-		case 1856486116:
+		case 489:
 			return engineConfiguration->startButtonSuppressOnStartUpMs;
 // launchRpm
-		case -776106289:
+		case 39:
 			return engineConfiguration->launchRpm;
 // rpmHardLimit
-		case 1176614802:
+		case 382:
 			return engineConfiguration->rpmHardLimit;
 // engineSnifferRpmThreshold
-		case 46918724:
+		case 141:
 			return engineConfiguration->engineSnifferRpmThreshold;
 // ltitEnabled
-		case 1049828813:
+		case 55:
 			return engineConfiguration->ltitEnabled;
 // useMetricOnInterface
-		case 934247460:
+		case 46:
 			return engineConfiguration->useMetricOnInterface;
 // useLambdaOnInterface
-		case 1514634753:
+		case 25:
 			return engineConfiguration->useLambdaOnInterface;
 // multisparkMaxRpm
-		case -775882810:
+		case 136:
 			return engineConfiguration->multisparkMaxRpm;
 // maxAcRpm
-		case 1569359006:
+		case 313:
 			return engineConfiguration->maxAcRpm;
 // maxAcTps
-		case 1569361190:
+		case 706:
 			return engineConfiguration->maxAcTps;
 // maxAcClt
-		case 1569342546:
+		case 376:
 			return engineConfiguration->maxAcClt;
 // compressionRatio
-		case 355839382:
+		case 514:
 			return engineConfiguration->compressionRatio;
 // idlePositionMin
-		case -1256791716:
+		case 293:
 			return engineConfiguration->idlePositionMin;
 // idlePositionMax
-		case -1256791970:
+		case 363:
 			return engineConfiguration->idlePositionMax;
 // ltitEmaAlpha
-		case -1008029221:
+		case 538:
 			return engineConfiguration->ltitEmaAlpha;
 // ltitStableRpmThreshold
-		case 341693817:
+		case 620:
 			return engineConfiguration->ltitStableRpmThreshold;
 // ltitStableTime
-		case 496209836:
+		case 705:
 			return engineConfiguration->ltitStableTime;
 // ltitCorrectionRate
-		case 743163558:
+		case 630:
 			return engineConfiguration->ltitCorrectionRate;
 // ltitIgnitionOnDelay
-		case -135093297:
+		case 552:
 			return engineConfiguration->ltitIgnitionOnDelay;
 // ltitIgnitionOffSaveDelay
-		case 423655964:
+		case 1:
 			return engineConfiguration->ltitIgnitionOffSaveDelay;
 // ltitClampMin
-		case -1622665645:
+		case 34:
 			return engineConfiguration->ltitClampMin;
 // ltitClampMax
-		case -1622665899:
+		case 664:
 			return engineConfiguration->ltitClampMax;
 // ltitSmoothingIntensity
-		case 341519713:
+		case 116:
 			return engineConfiguration->ltitSmoothingIntensity;
 // ltitIntegratorThreshold
-		case -2065042706:
+		case 86:
 			return engineConfiguration->ltitIntegratorThreshold;
 // launchFuelAdderPercent
-		case -904771683:
+		case 3:
 			return engineConfiguration->launchFuelAdderPercent;
 // etbJamTimeout
-		case 1057701663:
+		case 200:
 			return engineConfiguration->etbJamTimeout;
 // acIdleExtraOffset
-		case 1933500210:
+		case 595:
 			return engineConfiguration->acIdleExtraOffset;
 // multisparkMaxSparkingAngle
-		case 402092253:
+		case 303:
 			return engineConfiguration->multisparkMaxSparkingAngle;
 // multisparkMaxExtraSparkCount
-		case 726613349:
+		case 464:
 			return engineConfiguration->multisparkMaxExtraSparkCount;
 // vvtControlMinRpm
-		case 1470846937:
+		case 99:
 			return engineConfiguration->vvtControlMinRpm;
 // injector.flow
-		case 1542550121:
+		case 159:
 			return engineConfiguration->injector.flow;
 // injectorSecondary.flow
-		case -289303407:
+		case 703:
 			return engineConfiguration->injectorSecondary.flow;
 // isForcedInduction
-		case -617915487:
+		case 326:
 			return engineConfiguration->isForcedInduction;
 // useFordRedundantTps
-		case -1284354759:
+		case 301:
 			return engineConfiguration->useFordRedundantTps;
 // enableKline
-		case 1188684607:
+		case 701:
 			return engineConfiguration->enableKline;
 // overrideTriggerGaps
-		case 1362186948:
+		case 224:
 			return engineConfiguration->overrideTriggerGaps;
 // enableFan1WithAc
-		case -298185774:
+		case 648:
 			return engineConfiguration->enableFan1WithAc;
 // enableFan2WithAc
-		case 993282195:
+		case 259:
 			return engineConfiguration->enableFan2WithAc;
 // enableTrailingSparks
-		case -1409016614:
+		case 377:
 			return engineConfiguration->enableTrailingSparks;
 // etb_use_two_wires
-		case -1334689362:
+		case 133:
 			return engineConfiguration->etb_use_two_wires;
 // isDoubleSolenoidIdle
-		case 1097520823:
+		case 215:
 			return engineConfiguration->isDoubleSolenoidIdle;
 // useEeprom
-		case -1572546086:
+		case 334:
 			return engineConfiguration->useEeprom;
 // useCicPidForIdle
-		case -264572349:
+		case 618:
 			return engineConfiguration->useCicPidForIdle;
 // useTLE8888_cranking_hack
-		case -1279270887:
+		case 628:
 			return engineConfiguration->useTLE8888_cranking_hack;
 // kickStartCranking
-		case 1156367906:
+		case 107:
 			return engineConfiguration->kickStartCranking;
 // useSeparateIdleTablesForCrankingTaper
-		case -418454384:
+		case 302:
 			return engineConfiguration->useSeparateIdleTablesForCrankingTaper;
 // launchControlEnabled
-		case -338157684:
+		case 370:
 			return engineConfiguration->launchControlEnabled;
 // antiLagEnabled
-		case -933524784:
+		case 350:
 			return engineConfiguration->antiLagEnabled;
 // useRunningMathForCranking
-		case -54973711:
+		case 130:
 			return engineConfiguration->useRunningMathForCranking;
 // displayLogicLevelsInEngineSniffer
-		case 1616873838:
+		case 702:
 			return engineConfiguration->displayLogicLevelsInEngineSniffer;
 // useTLE8888_stepper
-		case -647008743:
+		case 198:
 			return engineConfiguration->useTLE8888_stepper;
 // usescriptTableForCanSniffingFiltering
-		case 671821024:
+		case 157:
 			return engineConfiguration->usescriptTableForCanSniffingFiltering;
 // verboseCan
-		case -1073210355:
+		case 603:
 			return engineConfiguration->verboseCan;
 // artificialTestMisfire
-		case -1528619572:
+		case 441:
 			return engineConfiguration->artificialTestMisfire;
 // useFordRedundantPps
-		case -1284359115:
+		case 427:
 			return engineConfiguration->useFordRedundantPps;
 // cltSensorPulldown
-		case 1925843479:
+		case 507:
 			return engineConfiguration->cltSensorPulldown;
 // iatSensorPulldown
-		case 1570551154:
+		case 115:
 			return engineConfiguration->iatSensorPulldown;
 // allowIdenticalPps
-		case 445194564:
+		case 466:
 			return engineConfiguration->allowIdenticalPps;
 // overrideVvtTriggerGaps
-		case 840966724:
+		case 88:
 			return engineConfiguration->overrideVvtTriggerGaps;
 // useSpiImu
-		case -1011866871:
+		case 145:
 			return engineConfiguration->useSpiImu;
 // enableStagedInjection
-		case 1160459527:
+		case 309:
 			return engineConfiguration->enableStagedInjection;
 // useIdleAdvanceWhileCoasting
-		case 586887955:
+		case 670:
 			return engineConfiguration->useIdleAdvanceWhileCoasting;
 // tpsErrorDetectionTooLow
-		case 625338761:
+		case 468:
 			return engineConfiguration->tpsErrorDetectionTooLow;
 // tpsErrorDetectionTooHigh
-		case -838808073:
+		case 408:
 			return engineConfiguration->tpsErrorDetectionTooHigh;
 // cranking.rpm
-		case -1717336209:
+		case 659:
 			return engineConfiguration->cranking.rpm;
 // ignitionDwellForCrankingMs
-		case -589710926:
+		case 378:
 			return engineConfiguration->ignitionDwellForCrankingMs;
 // etbRevLimitStart
-		case 401321850:
+		case 267:
 			return engineConfiguration->etbRevLimitStart;
 // etbRevLimitRange
-		case 399466905:
+		case 189:
 			return engineConfiguration->etbRevLimitRange;
 // map.sensor.lowValue
-		case -1307181880:
+		case 346:
 			return engineConfiguration->map.sensor.lowValue;
 // map.sensor.highValue
-		case -1434278346:
+		case 255:
 			return engineConfiguration->map.sensor.highValue;
 // clt.config.tempC_1
-		case -1832527325:
+		case 307:
 			return engineConfiguration->clt.config.tempC_1;
 // clt.config.tempC_2
-		case -1832527324:
+		case 98:
 			return engineConfiguration->clt.config.tempC_2;
 // clt.config.tempC_3
-		case -1832527323:
+		case 168:
 			return engineConfiguration->clt.config.tempC_3;
 // clt.config.resistance_1
-		case -5328869:
+		case 439:
 			return engineConfiguration->clt.config.resistance_1;
 // clt.config.resistance_2
-		case -5328868:
+		case 175:
 			return engineConfiguration->clt.config.resistance_2;
 // clt.config.resistance_3
-		case -5328867:
+		case 649:
 			return engineConfiguration->clt.config.resistance_3;
 // clt.config.bias_resistor
-		case -653172717:
+		case 692:
 			return engineConfiguration->clt.config.bias_resistor;
 // iat.config.tempC_1
-		case -672272162:
+		case 154:
 			return engineConfiguration->iat.config.tempC_1;
 // iat.config.tempC_2
-		case -672272161:
+		case 207:
 			return engineConfiguration->iat.config.tempC_2;
 // iat.config.tempC_3
-		case -672272160:
+		case 68:
 			return engineConfiguration->iat.config.tempC_3;
 // iat.config.resistance_1
-		case -1014418506:
+		case 405:
 			return engineConfiguration->iat.config.resistance_1;
 // iat.config.resistance_2
-		case -1014418505:
+		case 69:
 			return engineConfiguration->iat.config.resistance_2;
 // iat.config.resistance_3
-		case -1014418504:
+		case 71:
 			return engineConfiguration->iat.config.resistance_3;
 // iat.config.bias_resistor
-		case 406607630:
+		case 645:
 			return engineConfiguration->iat.config.bias_resistor;
 // launchTimingRetard
-		case 1226423210:
+		case 570:
 			return engineConfiguration->launchTimingRetard;
 // idleMaximumAirmass
-		case -1671871759:
+		case 31:
 			return engineConfiguration->idleMaximumAirmass;
 // alternator_iTermMin
-		case 107641733:
+		case 176:
 			return engineConfiguration->alternator_iTermMin;
 // alternator_iTermMax
-		case 107641479:
+		case 147:
 			return engineConfiguration->alternator_iTermMax;
 // displacement
-		case -1227821282:
+		case 354:
 			return engineConfiguration->displacement;
 // triggerSimulatorRpm
-		case 2122875976:
+		case 700:
 			return engineConfiguration->triggerSimulatorRpm;
 // cylindersCount
-		case -1578655365:
+		case 292:
 			return engineConfiguration->cylindersCount;
 // justATempTest
-		case -48120222:
+		case 365:
 			return engineConfiguration->justATempTest;
 // mapSyncThreshold
-		case 1640008461:
+		case 294:
 			return engineConfiguration->mapSyncThreshold;
 // cylinderBore
-		case 1425664391:
+		case 502:
 			return engineConfiguration->cylinderBore;
 // ALSMaxTPS
-		case 1523832034:
+		case 238:
 			return engineConfiguration->ALSMaxTPS;
 // boostControlMinRpm
-		case -1976636992:
+		case 634:
 			return engineConfiguration->boostControlMinRpm;
 // boostControlMinTps
-		case -1976634808:
+		case 499:
 			return engineConfiguration->boostControlMinTps;
 // boostControlMinMap
-		case -1976642929:
+		case 14:
 			return engineConfiguration->boostControlMinMap;
 // crankingTimingAngle
-		case 2071041633:
+		case 77:
 			return engineConfiguration->crankingTimingAngle;
 // gapTrackingLengthOverride
-		case -2079960526:
+		case 372:
 			return engineConfiguration->gapTrackingLengthOverride;
 // maxIdleVss
-		case 1408421157:
+		case 124:
 			return engineConfiguration->maxIdleVss;
 // camDecoder2jzPrecision
-		case 306303086:
+		case 82:
 			return engineConfiguration->camDecoder2jzPrecision;
 // minOilPressureAfterStart
-		case -855687130:
+		case 429:
 			return engineConfiguration->minOilPressureAfterStart;
 // fixedModeTiming
-		case -1965056926:
+		case 118:
 			return engineConfiguration->fixedModeTiming;
 // globalTriggerAngleOffset
-		case -295413160:
+		case 519:
 			return engineConfiguration->globalTriggerAngleOffset;
 // analogInputDividerCoefficient
-		case 1779689293:
+		case 156:
 			return engineConfiguration->analogInputDividerCoefficient;
 // vbattDividerCoeff
-		case -1311217456:
+		case 254:
 			return engineConfiguration->vbattDividerCoeff;
 // fanOnTemperature
-		case -853358747:
+		case 308:
 			return engineConfiguration->fanOnTemperature;
 // fanOffTemperature
-		case 4686563:
+		case 565:
 			return engineConfiguration->fanOffTemperature;
 // fan2OnTemperature
-		case 871106583:
+		case 76:
 			return engineConfiguration->fan2OnTemperature;
 // fan2OffTemperature
-		case 1077467605:
+		case 673:
 			return engineConfiguration->fan2OffTemperature;
 // disableFan1AtSpeed
-		case -1575487611:
+		case 447:
 			return engineConfiguration->disableFan1AtSpeed;
 // disableFan2AtSpeed
-		case -1906717594:
+		case 53:
 			return engineConfiguration->disableFan2AtSpeed;
 // disableFan1WhenStopped
-		case -1132710384:
+		case 374:
 			return engineConfiguration->disableFan1WhenStopped;
 // disableFan2WhenStopped
-		case -311454863:
+		case 87:
 			return engineConfiguration->disableFan2WhenStopped;
 // fan1PwmEnabled
-		case 859066570:
+		case 360:
 			return engineConfiguration->fan1PwmEnabled;
 // fan2PwmEnabled
-		case -1198455285:
+		case 652:
 			return engineConfiguration->fan2PwmEnabled;
 // fan1PwmFrequency
-		case 1318639761:
+		case 452:
 			return engineConfiguration->fan1PwmFrequency;
 // fan2PwmFrequency
-		case -1644699118:
+		case 281:
 			return engineConfiguration->fan2PwmFrequency;
 // fan1MinPwm
-		case 992359619:
+		case 667:
 			return engineConfiguration->fan1MinPwm;
 // fan1MaxPwm
-		case 983231621:
+		case 256:
 			return engineConfiguration->fan1MaxPwm;
 // fan2MinPwm
-		case -2011139708:
+		case 654:
 			return engineConfiguration->fan2MinPwm;
 // fan2MaxPwm
-		case -2020267706:
+		case 457:
 			return engineConfiguration->fan2MaxPwm;
 // fan1AcAdder
-		case -180298801:
+		case 322:
 			return engineConfiguration->fan1AcAdder;
 // fan2AcAdder
-		case -511528784:
+		case 327:
 			return engineConfiguration->fan2AcAdder;
 // fan1SoftStartSec
-		case 1115446416:
+		case 359:
 			return engineConfiguration->fan1SoftStartSec;
 // fan2SoftStartSec
-		case -1847892463:
+		case 179:
 			return engineConfiguration->fan2SoftStartSec;
 // wizardPanelToShow
-		case 727066858:
+		case 606:
 			return engineConfiguration->wizardPanelToShow;
 // driveWheelRevPerKm
-		case 991724096:
+		case 20:
 			return engineConfiguration->driveWheelRevPerKm;
 // canSleepPeriodMs
-		case 296563315:
+		case 535:
 			return engineConfiguration->canSleepPeriodMs;
 // byFirmwareVersion
-		case 171869155:
+		case 674:
 			return engineConfiguration->byFirmwareVersion;
 // idle_derivativeFilterLoss
-		case -1269130308:
+		case 137:
 			return engineConfiguration->idle_derivativeFilterLoss;
 // trigger.customTotalToothCount
-		case 1212570205:
+		case 409:
 			return engineConfiguration->trigger.customTotalToothCount;
 // trigger.customSkippedToothCount
-		case 387956265:
+		case 605:
 			return engineConfiguration->trigger.customSkippedToothCount;
 // airByRpmTaper
-		case 2070727975:
+		case 94:
 			return engineConfiguration->airByRpmTaper;
 // boostControlSafeDutyCycle
-		case -1965075262:
+		case 242:
 			return engineConfiguration->boostControlSafeDutyCycle;
 // acrRevolutions
-		case -1373423899:
+		case 343:
 			return engineConfiguration->acrRevolutions;
 // calibrationBirthday
-		case -2136933308:
+		case 316:
 			return engineConfiguration->calibrationBirthday;
 // adcVcc
-		case -244496183:
+		case 494:
 			return engineConfiguration->adcVcc;
 // mapCamDetectionAnglePosition
-		case 1958105647:
+		case 516:
 			return engineConfiguration->mapCamDetectionAnglePosition;
 // afr.v1
-		case -241663117:
+		case 410:
 			return engineConfiguration->afr.v1;
 // afr.value1
-		case 1273287930:
+		case 399:
 			return engineConfiguration->afr.value1;
 // afr.v2
-		case -241663116:
+		case 539:
 			return engineConfiguration->afr.v2;
 // afr.value2
-		case 1273287931:
+		case 682:
 			return engineConfiguration->afr.value2;
 // etbSplit
-		case -2146852436:
+		case 282:
 			return engineConfiguration->etbSplit;
 // baroSensor.lowValue
-		case 1474689568:
+		case 490:
 			return engineConfiguration->baroSensor.lowValue;
 // baroSensor.highValue
-		case 173166222:
+		case 436:
 			return engineConfiguration->baroSensor.highValue;
 // idle.solenoidFrequency
-		case -568903712:
+		case 50:
 			return engineConfiguration->idle.solenoidFrequency;
 // knockRetardAggression
-		case 1989648303:
+		case 523:
 			return engineConfiguration->knockRetardAggression;
 // knockRetardReapplyRate
-		case -938609466:
+		case 339:
 			return engineConfiguration->knockRetardReapplyRate;
 // vssGearRatio
-		case -213773345:
+		case 247:
 			return engineConfiguration->vssGearRatio;
 // vssFilterReciprocal
-		case -495855925:
+		case 349:
 			return engineConfiguration->vssFilterReciprocal;
 // vssToothCount
-		case -1958312328:
+		case 329:
 			return engineConfiguration->vssToothCount;
 // gapVvtTrackingLengthOverride
-		case -188591438:
+		case 392:
 			return engineConfiguration->gapVvtTrackingLengthOverride;
 // idle_antiwindupFreq
-		case -524949197:
+		case 381:
 			return engineConfiguration->idle_antiwindupFreq;
 // mc33_t_min_boost
-		case 1129109559:
+		case 647:
 			return engineConfiguration->mc33_t_min_boost;
 // finalGearRatio
-		case -869432403:
+		case 244:
 			return engineConfiguration->finalGearRatio;
 // tcuInputSpeedSensorTeeth
-		case -2116746650:
+		case 556:
 			return engineConfiguration->tcuInputSpeedSensorTeeth;
 // fordInjectorSmallPulseSlope
-		case -1465119085:
+		case 45:
 			return engineConfiguration->fordInjectorSmallPulseSlope;
 // lambdaProtectionMinRpm
-		case 1758659040:
+		case 393:
 			return engineConfiguration->lambdaProtectionMinRpm;
 // lambdaProtectionMinLoad
-		case -2094010831:
+		case 197:
 			return engineConfiguration->lambdaProtectionMinLoad;
 // is_enabled_spi_1
-		case -722238362:
+		case 90:
 			return engineConfiguration->is_enabled_spi_1;
 // is_enabled_spi_2
-		case -722238361:
+		case 566:
 			return engineConfiguration->is_enabled_spi_2;
 // is_enabled_spi_3
-		case -722238360:
+		case 498:
 			return engineConfiguration->is_enabled_spi_3;
 // isSdCardEnabled
-		case -1603423011:
+		case 551:
 			return engineConfiguration->isSdCardEnabled;
 // rusefiVerbose29b
-		case 2043354390:
+		case 345:
 			return engineConfiguration->rusefiVerbose29b;
 // rethrowHardFault
-		case 1081456939:
+		case 612:
 			return engineConfiguration->rethrowHardFault;
 // verboseQuad
-		case -1055678778:
+		case 458:
 			return engineConfiguration->verboseQuad;
 // useStepperIdle
-		case -920116109:
+		case 104:
 			return engineConfiguration->useStepperIdle;
 // lambdaProtectionEnable
-		case 1451020756:
+		case 541:
 			return engineConfiguration->lambdaProtectionEnable;
 // verboseTLE8888
-		case -1251676000:
+		case 132:
 			return engineConfiguration->verboseTLE8888;
 // enableVerboseCanTx
-		case 1643181024:
+		case 414:
 			return engineConfiguration->enableVerboseCanTx;
 // externalRusEfiGdiModule
-		case 1546871344:
+		case 531:
 			return engineConfiguration->externalRusEfiGdiModule;
 // measureMapOnlyInOneCylinder
-		case -1236202550:
+		case 431:
 			return engineConfiguration->measureMapOnlyInOneCylinder;
 // stepperForceParkingEveryRestart
-		case -2104625325:
+		case 567:
 			return engineConfiguration->stepperForceParkingEveryRestart;
 // isFasterEngineSpinUpEnabled
-		case 2048390406:
+		case 602:
 			return engineConfiguration->isFasterEngineSpinUpEnabled;
 // coastingFuelCutEnabled
-		case 1570088896:
+		case 131:
 			return engineConfiguration->coastingFuelCutEnabled;
 // useIacTableForCoasting
-		case -2101952506:
+		case 251:
 			return engineConfiguration->useIacTableForCoasting;
 // useNoiselessTriggerDecoder
-		case 957244017:
+		case 285:
 			return engineConfiguration->useNoiselessTriggerDecoder;
 // useIdleTimingPidControl
-		case 11736566:
+		case 658:
 			return engineConfiguration->useIdleTimingPidControl;
 // disableEtbWhenEngineStopped
-		case -2096650725:
+		case 276:
 			return engineConfiguration->disableEtbWhenEngineStopped;
 // is_enabled_spi_4
-		case -722238359:
+		case 544:
 			return engineConfiguration->is_enabled_spi_4;
 // pauseEtbControl
-		case -24313313:
+		case 625:
 			return engineConfiguration->pauseEtbControl;
 // verboseKLine
-		case -485091122:
+		case 226:
 			return engineConfiguration->verboseKLine;
 // idleIncrementalPidCic
-		case 1064399425:
+		case 593:
 			return engineConfiguration->idleIncrementalPidCic;
 // enableAemXSeries
-		case 259909218:
+		case 356:
 			return engineConfiguration->enableAemXSeries;
 // modeledFlowIdle
-		case 600643125:
+		case 102:
 			return engineConfiguration->modeledFlowIdle;
 // isTuningDetectorEnabled
-		case 1997151643:
+		case 486:
 			return engineConfiguration->isTuningDetectorEnabled;
 // useAbsolutePressureForLagTime
-		case -1155937004:
+		case 355:
 			return engineConfiguration->useAbsolutePressureForLagTime;
 // enableVeSwitchTable
-		case 514256961:
+		case 440:
 			return engineConfiguration->enableVeSwitchTable;
 // verboseCanBaseAddress
-		case 6238478:
+		case 289:
 			return engineConfiguration->verboseCanBaseAddress;
 // mc33_hvolt
-		case 1182499943:
+		case 518:
 			return engineConfiguration->mc33_hvolt;
 // minimumBoostClosedLoopMap
-		case 596585178:
+		case 471:
 			return engineConfiguration->minimumBoostClosedLoopMap;
 // initialIgnitionCutPercent
-		case -360834835:
+		case 288:
 			return engineConfiguration->initialIgnitionCutPercent;
 // finalIgnitionCutPercentBeforeLaunch
-		case 47348059:
+		case 0:
 			return engineConfiguration->finalIgnitionCutPercentBeforeLaunch;
 // idlePidRpmUpperLimit
-		case 1962548154:
+		case 617:
 			return engineConfiguration->idlePidRpmUpperLimit;
 // applyNonlinearBelowPulse
-		case 119460051:
+		case 139:
 			return engineConfiguration->applyNonlinearBelowPulse;
 // torqueReductionArmingRpm
-		case -763820449:
+		case 57:
 			return engineConfiguration->torqueReductionArmingRpm;
 // stoichRatioSecondary
-		case 1945443830:
+		case 663:
 			return engineConfiguration->stoichRatioSecondary;
 // etbMaximumPosition
-		case -786901709:
+		case 273:
 			return engineConfiguration->etbMaximumPosition;
 // sdCardLogFrequency
-		case -773841334:
+		case 641:
 			return engineConfiguration->sdCardLogFrequency;
 // launchCorrectionsEndRpm
-		case 223926129:
+		case 67:
 			return engineConfiguration->launchCorrectionsEndRpm;
 // lambdaProtectionRestoreRpm
-		case 872435040:
+		case 26:
 			return engineConfiguration->lambdaProtectionRestoreRpm;
 // mapMinBufferLength
-		case -561715997:
+		case 421:
 			return engineConfiguration->mapMinBufferLength;
 // idlePidDeactivationTpsThreshold
-		case 1490213215:
+		case 407:
 			return engineConfiguration->idlePidDeactivationTpsThreshold;
 // stepperParkingExtraSteps
-		case -509113657:
+		case 569:
 			return engineConfiguration->stepperParkingExtraSteps;
 // startCrankingDuration
-		case 644409862:
+		case 694:
 			return engineConfiguration->startCrankingDuration;
 // lambdaProtectionMinTps
-		case 1758661224:
+		case 575:
 			return engineConfiguration->lambdaProtectionMinTps;
 // lambdaProtectionTimeout
-		case -1645106444:
+		case 400:
 			return engineConfiguration->lambdaProtectionTimeout;
 // idleReturnTargetRamp
-		case 118504154:
+		case 594:
 			return engineConfiguration->idleReturnTargetRamp;
 // useInjectorFlowLinearizationTable
-		case 435614729:
+		case 404:
 			return engineConfiguration->useInjectorFlowLinearizationTable;
 // useHbridgesToDriveIdleStepper
-		case 13806936:
+		case 248:
 			return engineConfiguration->useHbridgesToDriveIdleStepper;
 // multisparkEnable
-		case -1074393096:
+		case 509:
 			return engineConfiguration->multisparkEnable;
 // enableLaunchRetard
-		case -1583589783:
+		case 609:
 			return engineConfiguration->enableLaunchRetard;
 // canInputBCM
-		case 470555289:
+		case 622:
 			return engineConfiguration->canInputBCM;
 // consumeObdSensors
-		case 950993889:
+		case 704:
 			return engineConfiguration->consumeObdSensors;
 // enableCanVss
-		case 245947066:
+		case 386:
 			return engineConfiguration->enableCanVss;
 // stftIgnoreErrorMagnitude
-		case 1838375282:
+		case 258:
 			return engineConfiguration->stftIgnoreErrorMagnitude;
 // vvtBooleanForVerySpecialCases
-		case -376859614:
+		case 222:
 			return engineConfiguration->vvtBooleanForVerySpecialCases;
 // enableSoftwareKnock
-		case -1724873939:
+		case 469:
 			return engineConfiguration->enableSoftwareKnock;
 // verboseVVTDecoding
-		case 1540420600:
+		case 461:
 			return engineConfiguration->verboseVVTDecoding;
 // invertCamVVTSignal
-		case 1081026348:
+		case 348:
 			return engineConfiguration->invertCamVVTSignal;
 // alphaNUseIat
-		case -253720028:
+		case 521:
 			return engineConfiguration->alphaNUseIat;
 // knockBankCyl1
-		case 1509355728:
+		case 615:
 			return engineConfiguration->knockBankCyl1;
 // knockBankCyl2
-		case 1509355729:
+		case 61:
 			return engineConfiguration->knockBankCyl2;
 // knockBankCyl3
-		case 1509355730:
+		case 11:
 			return engineConfiguration->knockBankCyl3;
 // knockBankCyl4
-		case 1509355731:
+		case 650:
 			return engineConfiguration->knockBankCyl4;
 // knockBankCyl5
-		case 1509355732:
+		case 562:
 			return engineConfiguration->knockBankCyl5;
 // knockBankCyl6
-		case 1509355733:
+		case 433:
 			return engineConfiguration->knockBankCyl6;
 // knockBankCyl7
-		case 1509355734:
+		case 182:
 			return engineConfiguration->knockBankCyl7;
 // knockBankCyl8
-		case 1509355735:
+		case 526:
 			return engineConfiguration->knockBankCyl8;
 // knockBankCyl9
-		case 1509355736:
+		case 9:
 			return engineConfiguration->knockBankCyl9;
 // knockBankCyl10
-		case -1730868480:
+		case 557:
 			return engineConfiguration->knockBankCyl10;
 // knockBankCyl11
-		case -1730868479:
+		case 611:
 			return engineConfiguration->knockBankCyl11;
 // knockBankCyl12
-		case -1730868478:
+		case 272:
 			return engineConfiguration->knockBankCyl12;
 // tcuEnabled
-		case 1997663388:
+		case 579:
 			return engineConfiguration->tcuEnabled;
 // canBroadcastUseChannelTwo
-		case 1181153770:
+		case 227:
 			return engineConfiguration->canBroadcastUseChannelTwo;
 // useRawOutputToDriveIdleStepper
-		case 839486731:
+		case 504:
 			return engineConfiguration->useRawOutputToDriveIdleStepper;
 // verboseCan2
-		case -1056203297:
+		case 545:
 			return engineConfiguration->verboseCan2;
 // boostPid.pFactor
-		case 1421783686:
+		case 633:
 			return engineConfiguration->boostPid.pFactor;
 // boostPid.iFactor
-		case 971442495:
+		case 608:
 			return engineConfiguration->boostPid.iFactor;
 // boostPid.dFactor
-		case -1190930054:
+		case 35:
 			return engineConfiguration->boostPid.dFactor;
 // boostPid.offset
-		case 1435801342:
+		case 270:
 			return engineConfiguration->boostPid.offset;
 // boostPid.periodMs
-		case -945021094:
+		case 223:
 			return engineConfiguration->boostPid.periodMs;
 // boostPid.minValue
-		case 777954680:
+		case 675:
 			return engineConfiguration->boostPid.minValue;
 // boostPid.maxValue
-		case -572500550:
+		case 84:
 			return engineConfiguration->boostPid.maxValue;
 // boostPwmFrequency
-		case -1990709262:
+		case 683:
 			return engineConfiguration->boostPwmFrequency;
 // tpsAccelLookback
-		case -1164331270:
+		case 138:
 			return engineConfiguration->tpsAccelLookback;
 // tpsDecelEnleanmentThreshold
-		case -965453331:
+		case 163:
 			return engineConfiguration->tpsDecelEnleanmentThreshold;
 // tpsDecelEnleanmentMultiplier
-		case 1164012327:
+		case 453:
 			return engineConfiguration->tpsDecelEnleanmentMultiplier;
 // noFuelTrimAfterDfcoTime
-		case 1286770247:
+		case 33:
 			return engineConfiguration->noFuelTrimAfterDfcoTime;
 // noFuelTrimAfterAccelTime
-		case -1460984893:
+		case 485:
 			return engineConfiguration->noFuelTrimAfterAccelTime;
 // launchSpeedThreshold
-		case -1743747394:
+		case 305:
 			return engineConfiguration->launchSpeedThreshold;
 // launchRpmWindow
-		case -1798887513:
+		case 435:
 			return engineConfiguration->launchRpmWindow;
 // triggerEventsTimeoutMs
-		case 665024981:
+		case 260:
 			return engineConfiguration->triggerEventsTimeoutMs;
 // ppsExpAverageAlpha
-		case 457158886:
+		case 342:
 			return engineConfiguration->ppsExpAverageAlpha;
 // mapExpAverageAlpha
-		case -1852204335:
+		case 454:
 			return engineConfiguration->mapExpAverageAlpha;
 // magicNumberAvailableForDevTricks
-		case -2071167002:
+		case 671:
 			return engineConfiguration->magicNumberAvailableForDevTricks;
 // turbochargerFilter
-		case 983814707:
+		case 178:
 			return engineConfiguration->turbochargerFilter;
 // launchTpsThreshold
-		case -1340834204:
+		case 380:
 			return engineConfiguration->launchTpsThreshold;
 // launchActivateDelay
-		case -1153051360:
+		case 148:
 			return engineConfiguration->launchActivateDelay;
 // stft.maxIdleRegionRpm
-		case 1887120139:
+		case 681:
 			return engineConfiguration->stft.maxIdleRegionRpm;
 // stft.maxOverrunLoad
-		case 1673018859:
+		case 587:
 			return engineConfiguration->stft.maxOverrunLoad;
 // stft.minPowerLoad
-		case -1942479387:
+		case 676:
 			return engineConfiguration->stft.minPowerLoad;
 // stft.deadband
-		case -1157123369:
+		case 660:
 			return engineConfiguration->stft.deadband;
 // stft.minClt
-		case -81412933:
+		case 219:
 			return engineConfiguration->stft.minClt;
 // stft.minAfr
-		case -81415311:
+		case 286:
 			return engineConfiguration->stft.minAfr;
 // stft.maxAfr
-		case -90543309:
+		case 97:
 			return engineConfiguration->stft.maxAfr;
 // stft.startupDelay
-		case 1028902582:
+		case 268:
 			return engineConfiguration->stft.startupDelay;
 // ltft.enabled
-		case -1407066344:
+		case 245:
 			return engineConfiguration->ltft.enabled;
 // ltft.correctionEnabled
-		case -1686338448:
+		case 358:
 			return engineConfiguration->ltft.correctionEnabled;
 // ltft.deadband
-		case -1888587696:
+		case 310:
 			return engineConfiguration->ltft.deadband;
 // ltft.maxAdd
-		case 1427207708:
+		case 323:
 			return engineConfiguration->ltft.maxAdd;
 // ltft.maxRemove
-		case -269110527:
+		case 217:
 			return engineConfiguration->ltft.maxRemove;
 // widebandOnSecondBus
-		case 1445062086:
+		case 621:
 			return engineConfiguration->widebandOnSecondBus;
 // fuelClosedLoopCorrectionEnabled
-		case 1611799720:
+		case 103:
 			return engineConfiguration->fuelClosedLoopCorrectionEnabled;
 // alwaysWriteSdCard
-		case 787397010:
+		case 401:
 			return engineConfiguration->alwaysWriteSdCard;
 // knockDetectionUseDoubleFrequency
-		case 892958612:
+		case 153:
 			return engineConfiguration->knockDetectionUseDoubleFrequency;
 // yesUnderstandLocking
-		case -1985448683:
+		case 19:
 			return engineConfiguration->yesUnderstandLocking;
 // silentTriggerError
-		case 582390322:
+		case 388:
 			return engineConfiguration->silentTriggerError;
 // useLinearCltSensor
-		case -1816997974:
+		case 74:
 			return engineConfiguration->useLinearCltSensor;
 // canReadEnabled
-		case -528008450:
+		case 685:
 			return engineConfiguration->canReadEnabled;
 // canWriteEnabled
-		case 2104472173:
+		case 2:
 			return engineConfiguration->canWriteEnabled;
 // useLinearIatSensor
-		case 667504645:
+		case 110:
 			return engineConfiguration->useLinearIatSensor;
 // enableOilPressureProtect
-		case -1194560694:
+		case 597:
 			return engineConfiguration->enableOilPressureProtect;
 // tachPulseDurationAsDutyCycle
-		case 99110078:
+		case 364:
 			return engineConfiguration->tachPulseDurationAsDutyCycle;
 // isAlternatorControlEnabled
-		case -1771449111:
+		case 564:
 			return engineConfiguration->isAlternatorControlEnabled;
 // invertPrimaryTriggerSignal
-		case -587700301:
+		case 44:
 			return engineConfiguration->invertPrimaryTriggerSignal;
 // invertSecondaryTriggerSignal
-		case -1944260329:
+		case 496:
 			return engineConfiguration->invertSecondaryTriggerSignal;
 // cutFuelOnHardLimit
-		case -794334344:
+		case 96:
 			return engineConfiguration->cutFuelOnHardLimit;
 // cutSparkOnHardLimit
-		case -1087585075:
+		case 112:
 			return engineConfiguration->cutSparkOnHardLimit;
 // launchFuelCutEnable
-		case -980843809:
+		case 298:
 			return engineConfiguration->launchFuelCutEnable;
 // launchSparkCutEnable
-		case -1829995308:
+		case 4:
 			return engineConfiguration->launchSparkCutEnable;
 // torqueReductionEnabled
-		case -618104323:
+		case 540:
 			return engineConfiguration->torqueReductionEnabled;
 // camSyncOnSecondCrankRevolution
-		case 996346642:
+		case 450:
 			return engineConfiguration->camSyncOnSecondCrankRevolution;
 // limitTorqueReductionTime
-		case -819413824:
+		case 474:
 			return engineConfiguration->limitTorqueReductionTime;
 // verboseIsoTp
-		case -487204662:
+		case 239:
 			return engineConfiguration->verboseIsoTp;
 // engineSnifferFocusOnInputs
-		case 465982216:
+		case 512:
 			return engineConfiguration->engineSnifferFocusOnInputs;
 // twoStroke
-		case 38719415:
+		case 237:
 			return engineConfiguration->twoStroke;
 // skippedWheelOnCam
-		case 1538579992:
+		case 101:
 			return engineConfiguration->skippedWheelOnCam;
 // etbNeutralPosition
-		case 1664668368:
+		case 134:
 			return engineConfiguration->etbNeutralPosition;
 // isInjectionEnabled
-		case 1917301199:
+		case 416:
 			return engineConfiguration->isInjectionEnabled;
 // isIgnitionEnabled
-		case -1354884979:
+		case 243:
 			return engineConfiguration->isIgnitionEnabled;
 // isCylinderCleanupEnabled
-		case -1491889938:
+		case 143:
 			return engineConfiguration->isCylinderCleanupEnabled;
 // complexWallModel
-		case -2018683234:
+		case 446:
 			return engineConfiguration->complexWallModel;
 // alwaysInstantRpm
-		case -1934896346:
+		case 646:
 			return engineConfiguration->alwaysInstantRpm;
 // isMapAveragingEnabled
-		case 285726462:
+		case 487:
 			return engineConfiguration->isMapAveragingEnabled;
 // useSeparateAdvanceForIdle
-		case 216872574:
+		case 477:
 			return engineConfiguration->useSeparateAdvanceForIdle;
 // isWaveAnalyzerEnabled
-		case -726159643:
+		case 632:
 			return engineConfiguration->isWaveAnalyzerEnabled;
 // useSeparateVeForIdle
-		case -1997438905:
+		case 524:
 			return engineConfiguration->useSeparateVeForIdle;
 // verboseTriggerSynchDetails
-		case -325018342:
+		case 422:
 			return engineConfiguration->verboseTriggerSynchDetails;
 // hondaK
-		case 42872346:
+		case 190:
 			return engineConfiguration->hondaK;
 // twoWireBatchIgnition
-		case 454615641:
+		case 5:
 			return engineConfiguration->twoWireBatchIgnition;
 // useFixedBaroCorrFromMap
-		case 201676494:
+		case 127:
 			return engineConfiguration->useFixedBaroCorrFromMap;
 // useSeparateAdvanceForCranking
-		case 685453869:
+		case 677:
 			return engineConfiguration->useSeparateAdvanceForCranking;
 // useAdvanceCorrectionsForCranking
-		case 1060606307:
+		case 475:
 			return engineConfiguration->useAdvanceCorrectionsForCranking;
 // flexCranking
-		case -563973567:
+		case 707:
 			return engineConfiguration->flexCranking;
 // useIacPidMultTable
-		case -364626778:
+		case 117:
 			return engineConfiguration->useIacPidMultTable;
 // isBoostControlEnabled
-		case -1832431020:
+		case 295:
 			return engineConfiguration->isBoostControlEnabled;
 // launchSmoothRetard
-		case -954321508:
+		case 340:
 			return engineConfiguration->launchSmoothRetard;
 // isPhaseSyncRequiredForIgnition
-		case -1543452424:
+		case 656:
 			return engineConfiguration->isPhaseSyncRequiredForIgnition;
 // useCltBasedRpmLimit
-		case 939816194:
+		case 344:
 			return engineConfiguration->useCltBasedRpmLimit;
 // forceO2Heating
-		case -389678699:
+		case 398:
 			return engineConfiguration->forceO2Heating;
 // invertVvtControlIntake
-		case 755512282:
+		case 65:
 			return engineConfiguration->invertVvtControlIntake;
 // invertVvtControlExhaust
-		case -1331668704:
+		case 174:
 			return engineConfiguration->invertVvtControlExhaust;
 // useBiQuadOnAuxSpeedSensors
-		case 1486014321:
+		case 47:
 			return engineConfiguration->useBiQuadOnAuxSpeedSensors;
 // sdTriggerLog
-		case -105464622:
+		case 680:
 			return engineConfiguration->sdTriggerLog;
 // stepper_dc_use_two_wires
-		case 2136379132:
+		case 631:
 			return engineConfiguration->stepper_dc_use_two_wires;
 // watchOutForLinearTime
-		case -1896516795:
+		case 59:
 			return engineConfiguration->watchOutForLinearTime;
 // engineChartSize
-		case -1492464952:
+		case 599:
 			return engineConfiguration->engineChartSize;
 // turboSpeedSensorMultiplier
-		case -1056007485:
+		case 49:
 			return engineConfiguration->turboSpeedSensorMultiplier;
 // acIdleRpmTarget
-		case 30701245:
+		case 596:
 			return engineConfiguration->acIdleRpmTarget;
 // warningPeriod
-		case 1322924702:
+		case 460:
 			return engineConfiguration->warningPeriod;
 // knockDetectionWindowStart
-		case -339821344:
+		case 546:
 			return engineConfiguration->knockDetectionWindowStart;
 // idleStepperReactionTime
-		case 1145888170:
+		case 210:
 			return engineConfiguration->idleStepperReactionTime;
 // idleStepperTotalSteps
-		case -1077032999:
+		case 534:
 			return engineConfiguration->idleStepperTotalSteps;
 // torqueReductionArmingApp
-		case -763838959:
+		case 672:
 			return engineConfiguration->torqueReductionArmingApp;
 // referenceTorqueForGenerator
-		case 1979839970:
+		case 710:
 			return engineConfiguration->referenceTorqueForGenerator;
 // referenceMapForGenerator
-		case -1373131840:
+		case 577:
 			return engineConfiguration->referenceMapForGenerator;
 // referenceVeForGenerator
-		case 931823549:
+		case 16:
 			return engineConfiguration->referenceVeForGenerator;
 // tachPulseDuractionMs
-		case 58931511:
+		case 661:
 			return engineConfiguration->tachPulseDuractionMs;
 // wwaeTau
-		case -390306941:
+		case 403:
 			return engineConfiguration->wwaeTau;
 // alternatorControl.pFactor
-		case -1993968289:
+		case 455:
 			return engineConfiguration->alternatorControl.pFactor;
 // alternatorControl.iFactor
-		case 1850657816:
+		case 655:
 			return engineConfiguration->alternatorControl.iFactor;
 // alternatorControl.dFactor
-		case -311714733:
+		case 576:
 			return engineConfiguration->alternatorControl.dFactor;
 // alternatorControl.offset
-		case 1983046327:
+		case 155:
 			return engineConfiguration->alternatorControl.offset;
 // alternatorControl.periodMs
-		case -1995686573:
+		case 211:
 			return engineConfiguration->alternatorControl.periodMs;
 // alternatorControl.minValue
-		case -272710799:
+		case 152:
 			return engineConfiguration->alternatorControl.minValue;
 // alternatorControl.maxValue
-		case -1623166029:
+		case 70:
 			return engineConfiguration->alternatorControl.maxValue;
 // etb.pFactor
-		case 196797309:
+		case 58:
 			return engineConfiguration->etb.pFactor;
 // etb.iFactor
-		case -253543882:
+		case 563:
 			return engineConfiguration->etb.iFactor;
 // etb.dFactor
-		case 1879050865:
+		case 465:
 			return engineConfiguration->etb.dFactor;
 // etb.offset
-		case -423426795:
+		case 653:
 			return engineConfiguration->etb.offset;
 // etb.periodMs
-		case 1580101425:
+		case 218:
 			return engineConfiguration->etb.periodMs;
 // etb.minValue
-		case -991890097:
+		case 233:
 			return engineConfiguration->etb.minValue;
 // etb.maxValue
-		case 1952621969:
+		case 165:
 			return engineConfiguration->etb.maxValue;
 // airTaperRpmRange
-		case -174866119:
+		case 146:
 			return engineConfiguration->airTaperRpmRange;
 // tachPulsePerRev
-		case -2142425790:
+		case 600:
 			return engineConfiguration->tachPulsePerRev;
 // mapErrorDetectionTooLow
-		case 9388880:
+		case 125:
 			return engineConfiguration->mapErrorDetectionTooLow;
 // mapErrorDetectionTooHigh
-		case 309682334:
+		case 520:
 			return engineConfiguration->mapErrorDetectionTooHigh;
 // multisparkSparkDuration
-		case 48235288:
+		case 553:
 			return engineConfiguration->multisparkSparkDuration;
 // multisparkDwell
-		case 617337449:
+		case 312:
 			return engineConfiguration->multisparkDwell;
 // idleRpmPid.pFactor
-		case -2146434132:
+		case 297:
 			return engineConfiguration->idleRpmPid.pFactor;
 // idleRpmPid.iFactor
-		case 1698191973:
+		case 160:
 			return engineConfiguration->idleRpmPid.iFactor;
 // idleRpmPid.dFactor
-		case -464180576:
+		case 60:
 			return engineConfiguration->idleRpmPid.dFactor;
 // idleRpmPid.offset
-		case -103982236:
+		case 549:
 			return engineConfiguration->idleRpmPid.offset;
 // idleRpmPid.periodMs
-		case 1562875200:
+		case 639:
 			return engineConfiguration->idleRpmPid.periodMs;
 // idleRpmPid.minValue
-		case -1009116322:
+		case 665:
 			return engineConfiguration->idleRpmPid.minValue;
 // idleRpmPid.maxValue
-		case 1935395744:
+		case 203:
 			return engineConfiguration->idleRpmPid.maxValue;
 // wwaeBeta
-		case 4130389:
+		case 443:
 			return engineConfiguration->wwaeBeta;
 // throttlePedalUpVoltage
-		case -2130836456:
+		case 213:
 			return engineConfiguration->throttlePedalUpVoltage;
 // throttlePedalWOTVoltage
-		case 2099527693:
+		case 201:
 			return engineConfiguration->throttlePedalWOTVoltage;
 // startUpFuelPumpDuration
-		case -664540020:
+		case 669:
 			return engineConfiguration->startUpFuelPumpDuration;
 // mafFilterParameter
-		case 1564984000:
+		case 100:
 			return engineConfiguration->mafFilterParameter;
 // idlePidRpmDeadZone
-		case -528043591:
+		case 341:
 			return engineConfiguration->idlePidRpmDeadZone;
 // mc33810DisableRecoveryMode
-		case -464979268:
+		case 449:
 			return engineConfiguration->mc33810DisableRecoveryMode;
 // mc33810Gpgd0Mode
-		case -785386645:
+		case 249:
 			return engineConfiguration->mc33810Gpgd0Mode;
 // mc33810Gpgd1Mode
-		case -784200724:
+		case 387:
 			return engineConfiguration->mc33810Gpgd1Mode;
 // mc33810Gpgd2Mode
-		case -783014803:
+		case 503:
 			return engineConfiguration->mc33810Gpgd2Mode;
 // mc33810Gpgd3Mode
-		case -781828882:
+		case 448:
 			return engineConfiguration->mc33810Gpgd3Mode;
 // enableExtendedCanBroadcast
-		case 923152418:
+		case 278:
 			return engineConfiguration->enableExtendedCanBroadcast;
 // luaCanRxWorkaround
-		case 1068374799:
+		case 578:
 			return engineConfiguration->luaCanRxWorkaround;
 // flexSensorInverted
-		case 512911183:
+		case 184:
 			return engineConfiguration->flexSensorInverted;
 // useHardSkipInTraction
-		case -1495799741:
+		case 193:
 			return engineConfiguration->useHardSkipInTraction;
 // useAuxSpeedForSlipRatio
-		case -723870257:
+		case 638:
 			return engineConfiguration->useAuxSpeedForSlipRatio;
 // useVssAsSecondWheelSpeed
-		case -195378748:
+		case 158:
 			return engineConfiguration->useVssAsSecondWheelSpeed;
 // is_enabled_spi_5
-		case -722238358:
+		case 598:
 			return engineConfiguration->is_enabled_spi_5;
 // is_enabled_spi_6
-		case -722238357:
+		case 500:
 			return engineConfiguration->is_enabled_spi_6;
 // enableAemXSeriesEgt
-		case -1196188030:
+		case 629:
 			return engineConfiguration->enableAemXSeriesEgt;
 // startRequestPinInverted
-		case 747573348:
+		case 533:
 			return engineConfiguration->startRequestPinInverted;
 // tcu_rangeSensorPulldown
-		case -2079591860:
+		case 274:
 			return engineConfiguration->tcu_rangeSensorPulldown;
 // devBit01
-		case 1049496900:
+		case 610:
 			return engineConfiguration->devBit01;
 // devBit0
-		case 161953459:
+		case 43:
 			return engineConfiguration->devBit0;
 // devBit1
-		case 161953460:
+		case 693:
 			return engineConfiguration->devBit1;
 // devBit2
-		case 161953461:
+		case 324:
 			return engineConfiguration->devBit2;
 // devBit3
-		case 161953462:
+		case 62:
 			return engineConfiguration->devBit3;
 // devBit4
-		case 161953463:
+		case 418:
 			return engineConfiguration->devBit4;
 // devBit5
-		case 161953464:
+		case 161:
 			return engineConfiguration->devBit5;
 // devBit6
-		case 161953465:
+		case 109:
 			return engineConfiguration->devBit6;
 // devBit7
-		case 161953466:
+		case 483:
 			return engineConfiguration->devBit7;
 // invertExhaustCamVVTSignal
-		case -60727986:
+		case 391:
 			return engineConfiguration->invertExhaustCamVVTSignal;
 // enableKnockSpectrogram
-		case -556893719:
+		case 162:
 			return engineConfiguration->enableKnockSpectrogram;
 // enableKnockSpectrogramFilter
-		case -1923222129:
+		case 548:
 			return engineConfiguration->enableKnockSpectrogramFilter;
 // iacByTpsTaper
-		case -2065814304:
+		case 234:
 			return engineConfiguration->iacByTpsTaper;
 // coastingFuelCutVssLow
-		case 329016035:
+		case 12:
 			return engineConfiguration->coastingFuelCutVssLow;
 // coastingFuelCutVssHigh
-		case -2027523439:
+		case 352:
 			return engineConfiguration->coastingFuelCutVssHigh;
 // tpsAccelEnrichmentThreshold
-		case 1313479950:
+		case 232:
 			return engineConfiguration->tpsAccelEnrichmentThreshold;
 // totalGearsCount
-		case -2114430012:
+		case 333:
 			return engineConfiguration->totalGearsCount;
 // fan1ExtraIdle
-		case 1397079021:
+		case 462:
 			return engineConfiguration->fan1ExtraIdle;
 // uartConsoleSerialSpeed
-		case -999870619:
+		case 246:
 			return engineConfiguration->uartConsoleSerialSpeed;
 // throttlePedalSecondaryUpVoltage
-		case -1564912640:
+		case 75:
 			return engineConfiguration->throttlePedalSecondaryUpVoltage;
 // throttlePedalSecondaryWOTVoltage
-		case -699822859:
+		case 205:
 			return engineConfiguration->throttlePedalSecondaryWOTVoltage;
 // mc33_hpfp_i_peak
-		case 578933872:
+		case 23:
 			return engineConfiguration->mc33_hpfp_i_peak;
 // mc33_hpfp_i_hold
-		case 578657622:
+		case 690:
 			return engineConfiguration->mc33_hpfp_i_hold;
 // mc33_hpfp_i_hold_off
-		case 944657936:
+		case 613:
 			return engineConfiguration->mc33_hpfp_i_hold_off;
 // mc33_hpfp_max_hold
-		case 663037299:
+		case 580:
 			return engineConfiguration->mc33_hpfp_max_hold;
 // stepperDcInvertedPins
-		case 337194154:
+		case 511:
 			return engineConfiguration->stepperDcInvertedPins;
 // canOpenBLT
-		case -631762165:
+		case 616:
 			return engineConfiguration->canOpenBLT;
 // can2OpenBLT
-		case -1514354211:
+		case 361:
 			return engineConfiguration->can2OpenBLT;
 // injectorFlowAsMassFlow
-		case 444648859:
+		case 81:
 			return engineConfiguration->injectorFlowAsMassFlow;
 // boardUseCanTerminator
-		case -312962799:
+		case 280:
 			return engineConfiguration->boardUseCanTerminator;
 // kLineDoHondaSend
-		case 304164959:
+		case 491:
 			return engineConfiguration->kLineDoHondaSend;
 // can1ListenMode
-		case 178430876:
+		case 277:
 			return engineConfiguration->can1ListenMode;
 // can2ListenMode
-		case -1879090979:
+		case 424:
 			return engineConfiguration->can2ListenMode;
 // camDecoder2jzPosition
-		case 594789367:
+		case 559:
 			return engineConfiguration->camDecoder2jzPosition;
 // benchTestOnTime
-		case -1992436143:
+		case 644:
 			return engineConfiguration->benchTestOnTime;
 // lambdaProtectionRestoreTps
-		case 872437224:
+		case 357:
 			return engineConfiguration->lambdaProtectionRestoreTps;
 // lambdaProtectionRestoreLoad
-		case -1274631759:
+		case 271:
 			return engineConfiguration->lambdaProtectionRestoreLoad;
 // boostCutPressure
-		case -1992945039:
+		case 42:
 			return engineConfiguration->boostCutPressure;
 // fixedTiming
-		case -1359134883:
+		case 581:
 			return engineConfiguration->fixedTiming;
 // mapLowValueVoltage
-		case -137390524:
+		case 473:
 			return engineConfiguration->mapLowValueVoltage;
 // mapHighValueVoltage
-		case -1084262094:
+		case 32:
 			return engineConfiguration->mapHighValueVoltage;
 // egoValueShift
-		case 280323355:
+		case 18:
 			return engineConfiguration->egoValueShift;
 // tChargeMinRpmMinTps
-		case -557658095:
+		case 413:
 			return engineConfiguration->tChargeMinRpmMinTps;
 // tChargeMinRpmMaxTps
-		case -566786093:
+		case 708:
 			return engineConfiguration->tChargeMinRpmMaxTps;
 // tChargeMaxRpmMinTps
-		case -599338669:
+		case 265:
 			return engineConfiguration->tChargeMaxRpmMinTps;
 // tChargeMaxRpmMaxTps
-		case -608466667:
+		case 451:
 			return engineConfiguration->tChargeMaxRpmMaxTps;
 // minimumIgnitionTiming
-		case 298649674:
+		case 17:
 			return engineConfiguration->minimumIgnitionTiming;
 // maximumIgnitionTiming
-		case -1726245940:
+		case 167:
 			return engineConfiguration->maximumIgnitionTiming;
 // alternatorPwmFrequency
-		case 799798215:
+		case 547:
 			return engineConfiguration->alternatorPwmFrequency;
 // fan2ExtraIdle
-		case 1464880398:
+		case 151:
 			return engineConfiguration->fan2ExtraIdle;
 // primingDelay
-		case 1506446058:
+		case 432:
 			return engineConfiguration->primingDelay;
 // fuelReferencePressure
-		case -395416807:
+		case 456:
 			return engineConfiguration->fuelReferencePressure;
 // auxTempSensor1.config.tempC_1
-		case -1104834801:
+		case 52:
 			return engineConfiguration->auxTempSensor1.config.tempC_1;
 // auxTempSensor1.config.tempC_2
-		case -1104834800:
+		case 554:
 			return engineConfiguration->auxTempSensor1.config.tempC_2;
 // auxTempSensor1.config.tempC_3
-		case -1104834799:
+		case 695:
 			return engineConfiguration->auxTempSensor1.config.tempC_3;
 // auxTempSensor1.config.resistance_1
-		case 629168263:
+		case 542:
 			return engineConfiguration->auxTempSensor1.config.resistance_1;
 // auxTempSensor1.config.resistance_2
-		case 629168264:
+		case 369:
 			return engineConfiguration->auxTempSensor1.config.resistance_2;
 // auxTempSensor1.config.resistance_3
-		case 629168265:
+		case 188:
 			return engineConfiguration->auxTempSensor1.config.resistance_3;
 // auxTempSensor1.config.bias_resistor
-		case -1189603841:
+		case 113:
 			return engineConfiguration->auxTempSensor1.config.bias_resistor;
 // auxTempSensor2.config.tempC_1
-		case -900025104:
+		case 528:
 			return engineConfiguration->auxTempSensor2.config.tempC_1;
 // auxTempSensor2.config.tempC_2
-		case -900025103:
+		case 668:
 			return engineConfiguration->auxTempSensor2.config.tempC_2;
 // auxTempSensor2.config.tempC_3
-		case -900025102:
+		case 126:
 			return engineConfiguration->auxTempSensor2.config.tempC_3;
 // auxTempSensor2.config.resistance_1
-		case 1988973320:
+		case 177:
 			return engineConfiguration->auxTempSensor2.config.resistance_1;
 // auxTempSensor2.config.resistance_2
-		case 1988973321:
+		case 573:
 			return engineConfiguration->auxTempSensor2.config.resistance_2;
 // auxTempSensor2.config.resistance_3
-		case 1988973322:
+		case 396:
 			return engineConfiguration->auxTempSensor2.config.resistance_3;
 // auxTempSensor2.config.bias_resistor
-		case 734290080:
+		case 568:
 			return engineConfiguration->auxTempSensor2.config.bias_resistor;
 // knockSamplingDuration
-		case -430252676:
+		case 78:
 			return engineConfiguration->knockSamplingDuration;
 // etbFreq
-		case 2016887022:
+		case 8:
 			return engineConfiguration->etbFreq;
 // etbWastegatePid.pFactor
-		case 1746193407:
+		case 371:
 			return engineConfiguration->etbWastegatePid.pFactor;
 // etbWastegatePid.iFactor
-		case 1295852216:
+		case 216:
 			return engineConfiguration->etbWastegatePid.iFactor;
 // etbWastegatePid.dFactor
-		case -866520333:
+		case 636:
 			return engineConfiguration->etbWastegatePid.dFactor;
 // etbWastegatePid.offset
-		case 794879319:
+		case 121:
 			return engineConfiguration->etbWastegatePid.offset;
 // etbWastegatePid.periodMs
-		case 1170565107:
+		case 331:
 			return engineConfiguration->etbWastegatePid.periodMs;
 // etbWastegatePid.minValue
-		case -1401426415:
+		case 304:
 			return engineConfiguration->etbWastegatePid.minValue;
 // etbWastegatePid.maxValue
-		case 1543085651:
+		case 379:
 			return engineConfiguration->etbWastegatePid.maxValue;
 // stepperMinDutyCycle
-		case -1147263902:
+		case 434:
 			return engineConfiguration->stepperMinDutyCycle;
 // stepperMaxDutyCycle
-		case -1188944476:
+		case 572:
 			return engineConfiguration->stepperMaxDutyCycle;
 // idlePidActivationTime
-		case -1562952959:
+		case 536:
 			return engineConfiguration->idlePidActivationTime;
 // vvtControlMinClt
-		case 1470830477:
+		case 353:
 			return engineConfiguration->vvtControlMinClt;
 // oilPressure.v1
-		case -613392361:
+		case 38:
 			return engineConfiguration->oilPressure.v1;
 // oilPressure.value1
-		case -505257058:
+		case 508:
 			return engineConfiguration->oilPressure.value1;
 // oilPressure.v2
-		case -613392360:
+		case 225:
 			return engineConfiguration->oilPressure.v2;
 // oilPressure.value2
-		case -505257057:
+		case 480:
 			return engineConfiguration->oilPressure.value2;
 // auxFrequencyFilter
-		case 383307083:
+		case 214:
 			return engineConfiguration->auxFrequencyFilter;
 // coastingFuelCutRpmHigh
-		case 1272017572:
+		case 236:
 			return engineConfiguration->coastingFuelCutRpmHigh;
 // coastingFuelCutRpmLow
-		case 168701078:
+		case 195:
 			return engineConfiguration->coastingFuelCutRpmLow;
 // coastingFuelCutTps
-		case -1494035092:
+		case 472:
 			return engineConfiguration->coastingFuelCutTps;
 // coastingFuelCutClt
-		case -1494053736:
+		case 173:
 			return engineConfiguration->coastingFuelCutClt;
 // pidExtraForLowRpm
-		case 1414346958:
+		case 415:
 			return engineConfiguration->pidExtraForLowRpm;
 // coastingFuelCutMap
-		case -1494043213:
+		case 140:
 			return engineConfiguration->coastingFuelCutMap;
 // highPressureFuel.v1
-		case 2032707103:
+		case 91:
 			return engineConfiguration->highPressureFuel.v1;
 // highPressureFuel.value1
-		case -1898025562:
+		case 93:
 			return engineConfiguration->highPressureFuel.value1;
 // highPressureFuel.v2
-		case 2032707104:
+		case 170:
 			return engineConfiguration->highPressureFuel.v2;
 // highPressureFuel.value2
-		case -1898025561:
+		case 588:
 			return engineConfiguration->highPressureFuel.value2;
 // lowPressureFuel.v1
-		case -474791503:
+		case 114:
 			return engineConfiguration->lowPressureFuel.v1;
 // lowPressureFuel.value1
-		case 764445240:
+		case 27:
 			return engineConfiguration->lowPressureFuel.value1;
 // lowPressureFuel.v2
-		case -474791502:
+		case 79:
 			return engineConfiguration->lowPressureFuel.v2;
 // lowPressureFuel.value2
-		case 764445241:
+		case 80:
 			return engineConfiguration->lowPressureFuel.value2;
 // tChargeAirCoefMin
-		case 2115625312:
+		case 48:
 			return engineConfiguration->tChargeAirCoefMin;
 // tChargeAirCoefMax
-		case 2115625058:
+		case 582:
 			return engineConfiguration->tChargeAirCoefMax;
 // tChargeAirFlowMax
-		case 1590125629:
+		case 691:
 			return engineConfiguration->tChargeAirFlowMax;
 // tChargeAirIncrLimit
-		case -1128797750:
+		case 476:
 			return engineConfiguration->tChargeAirIncrLimit;
 // tChargeAirDecrLimit
-		case 670644444:
+		case 626:
 			return engineConfiguration->tChargeAirDecrLimit;
 // etb_iTermMin
-		case -1725192476:
+		case 479:
 			return engineConfiguration->etb_iTermMin;
 // etb_iTermMax
-		case -1725192730:
+		case 332:
 			return engineConfiguration->etb_iTermMax;
 // idleTimingPid.pFactor
-		case -1411996731:
+		case 397:
 			return engineConfiguration->idleTimingPid.pFactor;
 // idleTimingPid.iFactor
-		case -1862337922:
+		case 209:
 			return engineConfiguration->idleTimingPid.iFactor;
 // idleTimingPid.dFactor
-		case 270256825:
+		case 290:
 			return engineConfiguration->idleTimingPid.dFactor;
 // idleTimingPid.offset
-		case -2033984419:
+		case 367:
 			return engineConfiguration->idleTimingPid.offset;
 // idleTimingPid.periodMs
-		case 29505657:
+		case 589:
 			return engineConfiguration->idleTimingPid.periodMs;
 // idleTimingPid.minValue
-		case 1752481431:
+		case 56:
 			return engineConfiguration->idleTimingPid.minValue;
 // idleTimingPid.maxValue
-		case 402026201:
+		case 420:
 			return engineConfiguration->idleTimingPid.maxValue;
 // idleTimingSoftEntryTime
-		case 1881137064:
+		case 362:
 			return engineConfiguration->idleTimingSoftEntryTime;
 // tpsAccelFractionPeriod
-		case 1117566701:
+		case 199:
 			return engineConfiguration->tpsAccelFractionPeriod;
 // tpsAccelFractionDivisor
-		case 68539114:
+		case 560:
 			return engineConfiguration->tpsAccelFractionDivisor;
 // idlerpmpid_iTermMin
-		case -1742418701:
+		case 28:
 			return engineConfiguration->idlerpmpid_iTermMin;
 // stoichRatioPrimary
-		case 1762426578:
+		case 484:
 			return engineConfiguration->stoichRatioPrimary;
 // idlerpmpid_iTermMax
-		case -1742418955:
+		case 185:
 			return engineConfiguration->idlerpmpid_iTermMax;
 // etbIdleThrottleRange
-		case -54532767:
+		case 642:
 			return engineConfiguration->etbIdleThrottleRange;
 // triggerCompCenterVolt
-		case 1455224910:
+		case 144:
 			return engineConfiguration->triggerCompCenterVolt;
 // triggerCompHystMin
-		case -25671212:
+		case 666:
 			return engineConfiguration->triggerCompHystMin;
 // triggerCompHystMax
-		case -25671466:
+		case 30:
 			return engineConfiguration->triggerCompHystMax;
 // triggerCompSensorSatRpm
-		case -953183719:
+		case 510:
 			return engineConfiguration->triggerCompSensorSatRpm;
 // mc33_i_boost
-		case -371707639:
+		case 212:
 			return engineConfiguration->mc33_i_boost;
 // mc33_i_peak
-		case 379679459:
+		case 241:
 			return engineConfiguration->mc33_i_peak;
 // mc33_i_hold
-		case 379403209:
+		case 171:
 			return engineConfiguration->mc33_i_hold;
 // mc33_t_max_boost
-		case -486240071:
+		case 517:
 			return engineConfiguration->mc33_t_max_boost;
 // mc33_t_peak_off
-		case -893360504:
+		case 604:
 			return engineConfiguration->mc33_t_peak_off;
 // mc33_t_peak_tot
-		case -893354748:
+		case 338:
 			return engineConfiguration->mc33_t_peak_tot;
 // mc33_t_bypass
-		case 1281862911:
+		case 481:
 			return engineConfiguration->mc33_t_bypass;
 // mc33_t_hold_off
-		case -2086522258:
+		case 697:
 			return engineConfiguration->mc33_t_hold_off;
 // mc33_t_hold_tot
-		case -2086516502:
+		case 430:
 			return engineConfiguration->mc33_t_hold_tot;
 // maxCamPhaseResolveRpm
-		case -2070332548:
+		case 574:
 			return engineConfiguration->maxCamPhaseResolveRpm;
 // dfcoDelay
-		case 1676700208:
+		case 591:
 			return engineConfiguration->dfcoDelay;
 // acDelay
-		case 483010008:
+		case 394:
 			return engineConfiguration->acDelay;
 // fordInjectorSmallPulseBreakPoint
-		case -1032938305:
+		case 253:
 			return engineConfiguration->fordInjectorSmallPulseBreakPoint;
 // etbJamDetectThreshold
-		case -791880034:
+		case 687:
 			return engineConfiguration->etbJamDetectThreshold;
 // hpfpCamLobes
-		case -1256141959:
+		case 513:
 			return engineConfiguration->hpfpCamLobes;
 // acLowRpmLimit
-		case -2138018615:
+		case 470:
 			return engineConfiguration->acLowRpmLimit;
 // hpfpMinAngle
-		case 1494394654:
+		case 29:
 			return engineConfiguration->hpfpMinAngle;
 // hpfpPumpVolume
-		case 334494733:
+		case 264:
 			return engineConfiguration->hpfpPumpVolume;
 // hpfpActivationAngle
-		case -81483444:
+		case 492:
 			return engineConfiguration->hpfpActivationAngle;
 // issFilterReciprocal
-		case -413489794:
+		case 229:
 			return engineConfiguration->issFilterReciprocal;
 // hpfpPidP
-		case 436500704:
+		case 122:
 			return engineConfiguration->hpfpPidP;
 // hpfpPidI
-		case 436500697:
+		case 522:
 			return engineConfiguration->hpfpPidI;
 // hpfpPid_iTermMin
-		case 535118708:
+		case 169:
 			return engineConfiguration->hpfpPid_iTermMin;
 // hpfpPid_iTermMax
-		case 535118454:
+		case 389:
 			return engineConfiguration->hpfpPid_iTermMax;
 // hpfpTargetDecay
-		case 1025426144:
+		case 375:
 			return engineConfiguration->hpfpTargetDecay;
 // vvtActivationDelayMs
-		case 288250022:
+		case 561:
 			return engineConfiguration->vvtActivationDelayMs;
 // acrDisablePhase
-		case 1574876352:
+		case 411:
 			return engineConfiguration->acrDisablePhase;
 // auxLinear1.v1
-		case -1415669996:
+		case 120:
 			return engineConfiguration->auxLinear1.v1;
 // auxLinear1.value1
-		case -65154789:
+		case 390:
 			return engineConfiguration->auxLinear1.value1;
 // auxLinear1.v2
-		case -1415669995:
+		case 21:
 			return engineConfiguration->auxLinear1.v2;
 // auxLinear1.value2
-		case -65154788:
+		case 142:
 			return engineConfiguration->auxLinear1.value2;
 // auxLinear2.v1
-		case -1415634059:
+		case 584:
 			return engineConfiguration->auxLinear2.v1;
 // auxLinear2.value1
-		case -396384772:
+		case 428:
 			return engineConfiguration->auxLinear2.value1;
 // auxLinear2.v2
-		case -1415634058:
+		case 230:
 			return engineConfiguration->auxLinear2.v2;
 // auxLinear2.value2
-		case -396384771:
+		case 311:
 			return engineConfiguration->auxLinear2.value2;
 // etbMinimumPosition
-		case -1855700175:
+		case 417:
 			return engineConfiguration->etbMinimumPosition;
 // tuneHidingKey
-		case -243078627:
+		case 373:
 			return engineConfiguration->tuneHidingKey;
 // torqueReductionActivationTemperature
-		case -427105966:
+		case 317:
 			return engineConfiguration->torqueReductionActivationTemperature;
 // ALSMinRPM
-		case 1532957848:
+		case 191:
 			return engineConfiguration->ALSMinRPM;
 // ALSMaxRPM
-		case 1523829850:
+		case 275:
 			return engineConfiguration->ALSMaxRPM;
 // ALSMaxDuration
-		case 1830002033:
+		case 106:
 			return engineConfiguration->ALSMaxDuration;
 // ALSMinCLT
-		case 1532941388:
+		case 108:
 			return engineConfiguration->ALSMinCLT;
 // ALSMaxCLT
-		case 1523813390:
+		case 445:
 			return engineConfiguration->ALSMaxCLT;
 // alsMinTimeBetween
-		case -1118241790:
+		case 263:
 			return engineConfiguration->alsMinTimeBetween;
 // alsEtbPosition
-		case -731677323:
+		case 506:
 			return engineConfiguration->alsEtbPosition;
 // acRelayAlternatorDutyAdder
-		case -908268760:
+		case 320:
 			return engineConfiguration->acRelayAlternatorDutyAdder;
 // customSentTpsMin
-		case -282198091:
+		case 279:
 			return engineConfiguration->customSentTpsMin;
 // ALSIdleAdd
-		case -2021435668:
+		case 123:
 			return engineConfiguration->ALSIdleAdd;
 // ALSEtbAdd
-		case 1232469673:
+		case 183:
 			return engineConfiguration->ALSEtbAdd;
 // ALSSkipRatio
-		case -1404414917:
+		case 135:
 			return engineConfiguration->ALSSkipRatio;
 // acPressureEnableHyst
-		case 298344625:
+		case 208:
 			return engineConfiguration->acPressureEnableHyst;
 // tpsSecondaryMaximum
-		case -1744146782:
+		case 419:
 			return engineConfiguration->tpsSecondaryMaximum;
 // ppsSecondaryMaximum
-		case -727657058:
+		case 180:
 			return engineConfiguration->ppsSecondaryMaximum;
 // customSentTpsMax
-		case -282198345:
+		case 686:
 			return engineConfiguration->customSentTpsMax;
 // kLineBaudRate
-		case 1498075808:
+		case 463:
 			return engineConfiguration->kLineBaudRate;
 // hpfpPeakPos
-		case 1145081382:
+		case 586:
 			return engineConfiguration->hpfpPeakPos;
 // kLinePeriodUs
-		case 1915146851:
+		case 627:
 			return engineConfiguration->kLinePeriodUs;
 // rpmSoftLimitTimingRetard
-		case -543684839:
+		case 537:
 			return engineConfiguration->rpmSoftLimitTimingRetard;
 // rpmSoftLimitFuelAdded
-		case 1094944685:
+		case 221:
 			return engineConfiguration->rpmSoftLimitFuelAdded;
 // rpmHardLimitHyst
-		case 1756514810:
+		case 22:
 			return engineConfiguration->rpmHardLimitHyst;
 // benchTestOffTime
-		case -1655178001:
+		case 532:
 			return engineConfiguration->benchTestOffTime;
 // boostCutPressureHyst
-		case -2111374247:
+		case 325:
 			return engineConfiguration->boostCutPressureHyst;
 // benchTestCount
-		case -204721234:
+		case 684:
 			return engineConfiguration->benchTestCount;
 // iacByTpsHoldTime
-		case -235994182:
+		case 220:
 			return engineConfiguration->iacByTpsHoldTime;
 // iacByTpsDecayTime
-		case 1742748825:
+		case 128:
 			return engineConfiguration->iacByTpsDecayTime;
 // canVssScaling
-		case -846143628:
+		case 698:
 			return engineConfiguration->canVssScaling;
 // oilTempSensor.config.tempC_1
-		case -1460957868:
+		case 266:
 			return engineConfiguration->oilTempSensor.config.tempC_1;
 // oilTempSensor.config.tempC_2
-		case -1460957867:
+		case 194:
 			return engineConfiguration->oilTempSensor.config.tempC_2;
 // oilTempSensor.config.tempC_3
-		case -1460957866:
+		case 592:
 			return engineConfiguration->oilTempSensor.config.tempC_3;
 // oilTempSensor.config.resistance_1
-		case -1297544724:
+		case 299:
 			return engineConfiguration->oilTempSensor.config.resistance_1;
 // oilTempSensor.config.resistance_2
-		case -1297544723:
+		case 269:
 			return engineConfiguration->oilTempSensor.config.resistance_2;
 // oilTempSensor.config.resistance_3
-		case -1297544722:
+		case 15:
 			return engineConfiguration->oilTempSensor.config.resistance_3;
 // oilTempSensor.config.bias_resistor
-		case -346622972:
+		case 228:
 			return engineConfiguration->oilTempSensor.config.bias_resistor;
 // fuelTempSensor.config.tempC_1
-		case -713764196:
+		case 63:
 			return engineConfiguration->fuelTempSensor.config.tempC_1;
 // fuelTempSensor.config.tempC_2
-		case -713764195:
+		case 585:
 			return engineConfiguration->fuelTempSensor.config.tempC_2;
 // fuelTempSensor.config.tempC_3
-		case -713764194:
+		case 493:
 			return engineConfiguration->fuelTempSensor.config.tempC_3;
 // fuelTempSensor.config.resistance_1
-		case -1195844556:
+		case 24:
 			return engineConfiguration->fuelTempSensor.config.resistance_1;
 // fuelTempSensor.config.resistance_2
-		case -1195844555:
+		case 425:
 			return engineConfiguration->fuelTempSensor.config.resistance_2;
 // fuelTempSensor.config.resistance_3
-		case -1195844554:
+		case 383:
 			return engineConfiguration->fuelTempSensor.config.resistance_3;
 // fuelTempSensor.config.bias_resistor
-		case -1285484724:
+		case 51:
 			return engineConfiguration->fuelTempSensor.config.bias_resistor;
 // ambientTempSensor.config.tempC_1
-		case 275986512:
+		case 206:
 			return engineConfiguration->ambientTempSensor.config.tempC_1;
 // ambientTempSensor.config.tempC_2
-		case 275986513:
+		case 614:
 			return engineConfiguration->ambientTempSensor.config.tempC_2;
 // ambientTempSensor.config.tempC_3
-		case 275986514:
+		case 291:
 			return engineConfiguration->ambientTempSensor.config.tempC_3;
 // ambientTempSensor.config.resistance_1
-		case -1084296600:
+		case 231:
 			return engineConfiguration->ambientTempSensor.config.resistance_1;
 // ambientTempSensor.config.resistance_2
-		case -1084296599:
+		case 119:
 			return engineConfiguration->ambientTempSensor.config.resistance_2;
 // ambientTempSensor.config.resistance_3
-		case -1084296598:
+		case 196:
 			return engineConfiguration->ambientTempSensor.config.resistance_3;
 // ambientTempSensor.config.bias_resistor
-		case -1899369472:
+		case 624:
 			return engineConfiguration->ambientTempSensor.config.bias_resistor;
 // compressorDischargeTemperature.config.tempC_1
-		case -498450107:
+		case 368:
 			return engineConfiguration->compressorDischargeTemperature.config.tempC_1;
 // compressorDischargeTemperature.config.tempC_2
-		case -498450106:
+		case 395:
 			return engineConfiguration->compressorDischargeTemperature.config.tempC_2;
 // compressorDischargeTemperature.config.tempC_3
-		case -498450105:
+		case 679:
 			return engineConfiguration->compressorDischargeTemperature.config.tempC_3;
 // compressorDischargeTemperature.config.resistance_1
-		case 878369917:
+		case 437:
 			return engineConfiguration->compressorDischargeTemperature.config.resistance_1;
 // compressorDischargeTemperature.config.resistance_2
-		case 878369918:
+		case 315:
 			return engineConfiguration->compressorDischargeTemperature.config.resistance_2;
 // compressorDischargeTemperature.config.resistance_3
-		case 878369919:
+		case 438:
 			return engineConfiguration->compressorDischargeTemperature.config.resistance_3;
 // compressorDischargeTemperature.config.bias_resistor
-		case -1555883851:
+		case 328:
 			return engineConfiguration->compressorDischargeTemperature.config.bias_resistor;
 // speedometerPulsePerKm
-		case 1007396714:
+		case 336:
 			return engineConfiguration->speedometerPulsePerKm;
 // ignKeyAdcDivider
-		case -506535813:
+		case 257:
 			return engineConfiguration->ignKeyAdcDivider;
 // maxInjectorDutyInstant
-		case 896753456:
+		case 283:
 			return engineConfiguration->maxInjectorDutyInstant;
 // maxInjectorDutySustained
-		case 1651400031:
+		case 550:
 			return engineConfiguration->maxInjectorDutySustained;
 // maxInjectorDutySustainedTimeout
-		case 263235302:
+		case 40:
 			return engineConfiguration->maxInjectorDutySustainedTimeout;
 // auxSpeed1Multiplier
-		case -1644887108:
+		case 330:
 			return engineConfiguration->auxSpeed1Multiplier;
 // brakeMeanEffectivePressureDifferential
-		case -4616606:
+		case 10:
 			return engineConfiguration->brakeMeanEffectivePressureDifferential;
 // tunerStudioSerialSpeed
-		case 1467553180:
+		case 529:
 			return engineConfiguration->tunerStudioSerialSpeed;
 // anotherCiTest
-		case -283215870:
+		case 678:
 			return engineConfiguration->anotherCiTest;
 // tcu_rangeSensorBiasResistor
-		case -1480283119:
+		case 623:
 			return engineConfiguration->tcu_rangeSensorBiasResistor;
 // mc33810Nomi
-		case -695344665:
+		case 72:
 			return engineConfiguration->mc33810Nomi;
 // mc33810Maxi
-		case -695395485:
+		case 478:
 			return engineConfiguration->mc33810Maxi;
 // acPressure.v1
-		case 1470507575:
+		case 530:
 			return engineConfiguration->acPressure.v1;
 // acPressure.value1
-		case -1171243586:
+		case 423:
 			return engineConfiguration->acPressure.value1;
 // acPressure.v2
-		case 1470507576:
+		case 689:
 			return engineConfiguration->acPressure.v2;
 // acPressure.value2
-		case -1171243585:
+		case 83:
 			return engineConfiguration->acPressure.value2;
 // minAcPressure
-		case -965637402:
+		case 347:
 			return engineConfiguration->minAcPressure;
 // maxAcPressure
-		case 1953870952:
+		case 555:
 			return engineConfiguration->maxAcPressure;
 // minimumOilPressureTimeout
-		case -2016978331:
+		case 262:
 			return engineConfiguration->minimumOilPressureTimeout;
 // auxLinear3.v1
-		case -1415598122:
+		case 619:
 			return engineConfiguration->auxLinear3.v1;
 // auxLinear3.value1
-		case -727614755:
+		case 37:
 			return engineConfiguration->auxLinear3.value1;
 // auxLinear3.v2
-		case -1415598121:
+		case 54:
 			return engineConfiguration->auxLinear3.v2;
 // auxLinear3.value2
-		case -727614754:
+		case 558:
 			return engineConfiguration->auxLinear3.value2;
 // auxLinear4.v1
-		case -1415562185:
+		case 7:
 			return engineConfiguration->auxLinear4.v1;
 // auxLinear4.value1
-		case -1058844738:
+		case 129:
 			return engineConfiguration->auxLinear4.value1;
 // auxLinear4.v2
-		case -1415562184:
+		case 186:
 			return engineConfiguration->auxLinear4.v2;
 // auxLinear4.value2
-		case -1058844737:
+		case 314:
 			return engineConfiguration->auxLinear4.value2;
 // knockSuppressMinTps
-		case 893776859:
+		case 543:
 			return engineConfiguration->knockSuppressMinTps;
 // knockFuelTrimAggression
-		case -1811840427:
+		case 235:
 			return engineConfiguration->knockFuelTrimAggression;
 // knockFuelTrimReapplyRate
-		case -1833685972:
+		case 662:
 			return engineConfiguration->knockFuelTrimReapplyRate;
 // knockFuelTrim
-		case -106437949:
+		case 501:
 			return engineConfiguration->knockFuelTrim;
 // knockSpectrumSensitivity
-		case 1561929785:
+		case 467:
 			return engineConfiguration->knockSpectrumSensitivity;
 // knockFrequency
-		case 1972605869:
+		case 651:
 			return engineConfiguration->knockFrequency;
 // secondaryInjectorFuelReferencePressure
-		case -425992769:
+		case 240:
 			return engineConfiguration->secondaryInjectorFuelReferencePressure;
 // nitrousControlEnabled
-		case -582951931:
+		case 296:
 			return engineConfiguration->nitrousControlEnabled;
 // vvlControlEnabled
-		case -708922423:
+		case 111:
 			return engineConfiguration->vvlControlEnabled;
 // nitrousLuaGaugeArmingValue
-		case -1760115393:
+		case 497:
 			return engineConfiguration->nitrousLuaGaugeArmingValue;
 // nitrousMinimumTps
-		case 1089367148:
+		case 601:
 			return engineConfiguration->nitrousMinimumTps;
 // nitrousMinimumClt
-		case 1089348504:
+		case 335:
 			return engineConfiguration->nitrousMinimumClt;
 // nitrousMaximumMap
-		case -677571211:
+		case 261:
 			return engineConfiguration->nitrousMaximumMap;
 // nitrousMaximumAfr
-		case -677584112:
+		case 319:
 			return engineConfiguration->nitrousMaximumAfr;
 // nitrousActivationRpm
-		case -469950118:
+		case 172:
 			return engineConfiguration->nitrousActivationRpm;
 // nitrousDeactivationRpm
-		case 1072117635:
+		case 250:
 			return engineConfiguration->nitrousDeactivationRpm;
 // nitrousDeactivationRpmWindow
-		case -1786673317:
+		case 41:
 			return engineConfiguration->nitrousDeactivationRpmWindow;
 // dfcoRetardDeg
-		case 601094003:
+		case 696:
 			return engineConfiguration->dfcoRetardDeg;
 // dfcoRetardRampInTime
-		case 2030571545:
+		case 709:
 			return engineConfiguration->dfcoRetardRampInTime;
 // nitrousFuelAdderPercent
-		case -1197734314:
+		case 527:
 			return engineConfiguration->nitrousFuelAdderPercent;
 // nitrousIgnitionRetard
-		case -617548836:
+		case 300:
 			return engineConfiguration->nitrousIgnitionRetard;
 // nitrousMinimumVehicleSpeed
-		case 1658738502:
+		case 444:
 			return engineConfiguration->nitrousMinimumVehicleSpeed;
 // fuelLevelAveragingAlpha
-		case 2094922339:
+		case 384:
 			return engineConfiguration->fuelLevelAveragingAlpha;
 // fuelLevelUpdatePeriodSec
-		case 128251338:
+		case 406:
 			return engineConfiguration->fuelLevelUpdatePeriodSec;
 // fuelLevelLowThresholdVoltage
-		case 1697484698:
+		case 149:
 			return engineConfiguration->fuelLevelLowThresholdVoltage;
 // fuelLevelHighThresholdVoltage
-		case 2012123720:
+		case 284:
 			return engineConfiguration->fuelLevelHighThresholdVoltage;
 // afrExpAverageAlpha
-		case 1597749004:
+		case 85:
 			return engineConfiguration->afrExpAverageAlpha;
 // sparkHardwareLatencyCorrection
-		case 756523164:
+		case 640:
 			return engineConfiguration->sparkHardwareLatencyCorrection;
 // maxOilPressureTimeout
-		case -1788499857:
+		case 657:
 			return engineConfiguration->maxOilPressureTimeout;
 // idleReturnTargetRampDuration
-		case 62925536:
+		case 442:
 			return engineConfiguration->idleReturnTargetRampDuration;
 // wastegatePositionOpenedVoltage
-		case 866072300:
+		case 318:
 			return engineConfiguration->wastegatePositionOpenedVoltage;
 // wastegatePositionClosedVoltage
-		case 20003211:
+		case 515:
 			return engineConfiguration->wastegatePositionClosedVoltage;
 // vvlController.fuelAdderPercent
-		case 666098796:
+		case 590:
 			return engineConfiguration->vvlController.fuelAdderPercent;
 // vvlController.ignitionRetard
-		case 1427131506:
+		case 66:
 			return engineConfiguration->vvlController.ignitionRetard;
 // vvlController.minimumTps
-		case 1664936450:
+		case 252:
 			return engineConfiguration->vvlController.minimumTps;
 // vvlController.minimumClt
-		case 1664917806:
+		case 688:
 			return engineConfiguration->vvlController.minimumClt;
 // vvlController.maximumMap
-		case -102001909:
+		case 13:
 			return engineConfiguration->vvlController.maximumMap;
 // vvlController.maximumAfr
-		case -102014810:
+		case 166:
 			return engineConfiguration->vvlController.maximumAfr;
 // vvlController.activationRpm
-		case -798441680:
+		case 6:
 			return engineConfiguration->vvlController.activationRpm;
 // vvlController.deactivationRpm
-		case -172907815:
+		case 637:
 			return engineConfiguration->vvlController.deactivationRpm;
 // vvlController.deactivationRpmWindow
-		case 1849727793:
+		case 583:
 			return engineConfiguration->vvlController.deactivationRpmWindow;
 // rotationalIdleController.enabled
-		case -1765427939:
+		case 635:
 			return engineConfiguration->rotationalIdleController.enabled;
 // rotationalIdleController.auto_engage
-		case 38426001:
+		case 89:
 			return engineConfiguration->rotationalIdleController.auto_engage;
 // rotationalIdleController.max_tps
-		case -505201426:
+		case 459:
 			return engineConfiguration->rotationalIdleController.max_tps;
 // rotationalIdleController.auto_engage_clt_enable
-		case 203921593:
+		case 181:
 			return engineConfiguration->rotationalIdleController.auto_engage_clt_enable;
 // rotationalIdleController.auto_engage_clt
-		case 602046867:
+		case 482:
 			return engineConfiguration->rotationalIdleController.auto_engage_clt;
 // tcu_shiftTime
-		case -1658957891:
+		case 607:
 			return config->tcu_shiftTime;
 // cel_battery_min_v
-		case -1794416277:
+		case 73:
 			return config->cel_battery_min_v;
 // cel_battery_max_v
-		case -1794692883:
+		case 164:
 			return config->cel_battery_max_v;
 // cel_map_min_v
-		case -491094482:
+		case 306:
 			return config->cel_map_min_v;
 // cel_map_max_v
-		case -491371088:
+		case 204:
 			return config->cel_map_max_v;
 // cel_iat_min_v
-		case 1152494894:
+		case 412:
 			return config->cel_iat_min_v;
 // cel_iat_max_v
-		case 1152218288:
+		case 36:
 			return config->cel_iat_max_v;
 // cel_tps_min_v
-		case -789855065:
+		case 202:
 			return config->cel_tps_min_v;
 // cel_tps_max_v
-		case -790131671:
+		case 426:
 			return config->cel_tps_max_v;
 // dynoRpmStep
-		case -1085712470:
+		case 150:
 			return config->dynoRpmStep;
 // dynoSaeTemperatureC
-		case 903483241:
+		case 366:
 			return config->dynoSaeTemperatureC;
 // dynoSaeRelativeHumidity
-		case 1509051617:
+		case 505:
 			return config->dynoSaeRelativeHumidity;
 // dynoSaeBaro
-		case -391393956:
+		case 571:
 			return config->dynoSaeBaro;
 // dynoCarWheelDiaInch
-		case 1541525498:
+		case 488:
 			return config->dynoCarWheelDiaInch;
 // dynoCarWheelAspectRatio
-		case -1404613719:
+		case 351:
 			return config->dynoCarWheelAspectRatio;
 // dynoCarWheelTireWidthMm
-		case 1000921080:
+		case 699:
 			return config->dynoCarWheelTireWidthMm;
 // dynoCarGearPrimaryReduction
-		case -1607465307:
+		case 95:
 			return config->dynoCarGearPrimaryReduction;
 // dynoCarGearRatio
-		case 589242035:
+		case 92:
 			return config->dynoCarGearRatio;
 // dynoCarGearFinalDrive
-		case 220694456:
+		case 321:
 			return config->dynoCarGearFinalDrive;
 // dynoCarCarMassKg
-		case -1343193327:
+		case 495:
 			return config->dynoCarCarMassKg;
 // dynoCarCargoMassKg
-		case 183555079:
+		case 643:
 			return config->dynoCarCargoMassKg;
 // dynoCarCoeffOfDrag
-		case -1121870933:
+		case 192:
 			return config->dynoCarCoeffOfDrag;
 // dynoCarFrontalAreaM2
-		case -1661556925:
+		case 187:
 			return config->dynoCarFrontalAreaM2;
 // wizardNumberOfCylinders
-		case -1547587839:
+		case 337:
 			return config->wizardNumberOfCylinders;
 // wizardFiringOrder
-		case 346390417:
+		case 525:
 			return config->wizardFiringOrder;
 // wizardMapSensorType
-		case 554586032:
+		case 385:
 			return config->wizardMapSensorType;
 // wizardCrankTrigger
-		case -221893735:
+		case 287:
 			return config->wizardCrankTrigger;
 // wizardCamTrigger
-		case -717549157:
+		case 105:
 			return config->wizardCamTrigger;
 // wizardInjectorFlow
-		case -1499796020:
+		case 64:
 			return config->wizardInjectorFlow;
 // technicalDebt7738
-		case 218340072:
+		case 402:
 			return config->technicalDebt7738;
 	}
 	return EFI_ERROR_CODE;
 }
+float getConfigValueByHash(const int hash) {
+	int slot = getConfigSlotByHash(hash);
+	if (slot >= 0)
+		return getConfigValueBySlot(slot);
+	return EFI_ERROR_CODE;
+}
 float getConfigValueByName(const char *name) {
 	int hash = djb2lowerCase(name);
 	return getConfigValueByHash(hash);
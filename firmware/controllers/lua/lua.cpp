@@ -7,6 +7,8 @@
 
 #include "lua.hpp"
 #include "lua_heap.h"
+#include "lua_bytecode_cache.h"
+#include "lua_gc_scheduler.h"
 #include "lua_hooks.h"
 #include "can_filter.h"
 
@@ -14,6 +16,7 @@
 
 static bool withErrorLoading = false;
 static int luaTickPeriodUs;
+static int luaGcStepBudgetUs;
 
 #if EFI_CAN_SUPPORT
 static int recentRxCount = 0;
@@ -39,6 +42,12 @@ static int lua_setTickRate(lua_State* l) {
 	return 0;
 }
 
+static int lua_setGcStepBudget(lua_State* l) {
+	// zero hands garbage collection back to Lua
+	luaGcStepBudgetUs = clampF(0, luaL_checknumber(l, 1), MS2US(10));
+	return 0;
+}
+
 static void loadLibraries(LuaHandle& ls) {
 	constexpr luaL_Reg libs[] = {
 		// TODO: do we even need the base lib?
@@ -75,6 +84,7 @@ static LuaHandle setupLuaState(lua_Alloc alloc) {
 
 	// Load rusEFI hooks
 	lua_register(ls, "setTickRate", lua_setTickRate);
+	lua_register(ls, "setGcStepBudget", lua_setGcStepBudget);
 	configureRusefiLuaHooks(ls);
 
 	// run a GC cycle
@@ -88,9 +98,23 @@ static LuaHandle setupLuaState(lua_Alloc alloc) {
 }
 
 static bool loadScript(LuaHandle& ls, const char* scriptStr) {
-	efiPrintf(TAG "loading script length: %u...", std::strlen(scriptStr));
+	size_t length = std::strlen(scriptStr);
+	efiPrintf(TAG "loading script length: %u...", length);
+
+	uint32_t scriptCrc = crc32(scriptStr, length);
+	if (!luaBytecodeCacheLoad(ls, scriptCrc, length)) {
+		// same chunk name as luaL_dostring for error messages
+		if (0 != luaL_loadbuffer(ls, scriptStr, length, scriptStr)) {
+			withErrorLoading = true;
+			efiPrintf(TAG "ERROR loading script: %s", lua_tostring(ls, -1));
+			lua_pop(ls, 1);
+			return false;
+		}
 
-	if (0 != luaL_dostring(ls, scriptStr)) {
+		luaBytecodeCacheStore(ls, scriptCrc, length);
+	}
+
+	if (0 != lua_pcall(ls, 0, LUA_MULTRET, 0)) {
 	  withErrorLoading = true;
 		efiPrintf(TAG "ERROR loading script: %s", lua_tostring(ls, -1));
 		lua_pop(ls, 1);
@@ -214,11 +238,16 @@ static bool runOneLua(lua_Alloc alloc, const char* script) {
 
 	// Reset default tick rate
 	luaTickPeriodUs = MS2US(5);
+	luaGcStepBudgetUs = LUA_GC_STEP_BUDGET_US;
 
 	if (!loadScript(ls, script)) {
 		return false;
 	}
 
+	// collector was left automatic while loading since parser produces lots of garbage
+	LuaGcScheduler gc;
+	gc.start(ls);
+
 	while (!needsReset && !chThdShouldTerminateX()) {
 		efitick_t beforeNt = getTimeNowNt();
 #if EFI_CAN_SUPPORT
@@ -235,7 +264,15 @@ static bool runOneLua(lua_Alloc alloc, const char* script) {
 
 		engine->outputChannels.luaLastCycleDuration = (getTimeNowNt() - beforeNt);
 		engine->outputChannels.luaInvocationCounter++;
-		chThdSleep(TIME_US2I(luaTickPeriodUs));
+
+		// GC gets at most half of the tick period, steps may overrun the budget a bit
+		int gcUs = NT2US(gc.onIdle(ls, std::min(luaGcStepBudgetUs, luaTickPeriodUs / 2)));
+		luaHeapUpdateLiveData();
+		auto& luaState = getLuaState();
+		luaState.luaHeapAfterGcBytes = gc.getHeapAfterGc();
+		luaState.luaGcStepTime = gcUs;
+		luaState.luaGcCycles = gc.getCompletedCycles();
+		chThdSleep(TIME_US2I(std::max(luaTickPeriodUs - gcUs, luaTickPeriodUs / 2)));
 
 		engine->engineState.luaDigitalState0 = getAuxDigital(0);
 		engine->engineState.luaDigitalState1 = getAuxDigital(1);
@@ -315,6 +352,7 @@ void startLua() {
 	    NT2US(rxTime));
 
      luaHeapPrintInfo();
+     luaBytecodeCachePrintInfo();
   });
 }
 
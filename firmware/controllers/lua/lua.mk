@@ -3,6 +3,9 @@ LUA_EXT=$(PROJECT_DIR)/ext/lua
 
 ALLCPPSRC += $(LUA_DIR)/lua.cpp \
 			 $(LUA_DIR)/lua_heap.cpp \
+			 $(LUA_DIR)/lua_slab.cpp \
+			 $(LUA_DIR)/lua_bytecode_cache.cpp \
+			 $(LUA_DIR)/lua_gc_scheduler.cpp \
 			 $(LUA_DIR)/lua_hooks.cpp \
 			 $(LUA_DIR)/lua_hooks_ext.cpp \
 			 $(LUA_DIR)/can_filter.cpp \
@@ -0,0 +1,330 @@
+/**
+ * @file lua_bytecode_cache.cpp
+ *
+ * Chunk is dumped with strip = 1: runtime errors raised by a cached chunk have no line numbers. Parse
+ * errors are always reported against script text since a script which does not parse is never cached.
+ */
+
+#include "pch.h"
+
+#include "rusefi_lua.h"
+
+#if EFI_LUA
+
+#include "lua.hpp"
+#include "lua_heap.h"
+#include "lua_bytecode_cache.h"
+
+#if EFI_PROD_CODE && EFI_CONFIGURATION_STORAGE && EFI_LUA_BYTECODE_STORAGE
+	#define LUA_BYTECODE_PERSISTENT TRUE
+	#include "storage.h"
+#else
+	#define LUA_BYTECODE_PERSISTENT FALSE
+#endif
+
+#define TAG "LUA "
+
+// bump when header layout changes, Lua itself rejects chunks of other Lua versions or number formats
+#define LUA_BYTECODE_MAGIC 0x4C424302
+
+struct LuaBytecodeHeader {
+	uint32_t magic;
+	// firmware build which compiled the chunk
+	uint32_t buildSignature;
+	uint32_t scriptCrc;
+	uint32_t scriptLength;
+	uint32_t size;
+	uint32_t bytecodeCrc;
+};
+
+static LuaBytecodeHeader cacheHeader;
+static uint8_t* cacheBytecode = nullptr;
+static uint32_t cacheHitCount = 0;
+
+#if LUA_BYTECODE_PERSISTENT
+// how long first script start waits for storage before compiling the script
+#ifndef LUA_BYTECODE_STORAGE_TIMEOUT_MS
+#define LUA_BYTECODE_STORAGE_TIMEOUT_MS 500
+#endif
+
+enum class StorageReadState : uint8_t {
+	NotRequested,
+	// storage manager owns the read, it may publish its chunk into the cache
+	Pending,
+	Done,
+};
+
+// storage manager thread reads and writes the chunk while Lua thread may want to replace it
+static chibios_rt::Mutex cacheMutex;
+static chibios_rt::BinarySemaphore storageReadSem(/* taken =*/ true);
+static StorageReadState storageReadState = StorageReadState::NotRequested;
+// script which storage manager reads the chunk for
+static uint32_t storageScriptCrc;
+static size_t storageScriptLength;
+// chunk which storage manager is writing without holding cacheMutex
+static uint8_t* writingBytecode = nullptr;
+// writingBytecode is not in cache anymore, storage manager frees it once done
+static bool writingReplaced = false;
+#endif // LUA_BYTECODE_PERSISTENT
+
+/**
+ * Lua only checks its version and number format, a chunk stored by another firmware build could still
+ * be compiled by a patched or differently configured Lua: only the build which compiled it loads it.
+ */
+static uint32_t getBuildSignature() {
+#if LUA_BYTECODE_PERSISTENT
+	static const char buildTime[] = __DATE__ " " __TIME__;
+	return crc32(buildTime, sizeof(buildTime)) ^ (uint32_t)getRusEfiVersion() ^ (uint32_t)SIGNATURE_HASH;
+#else
+	// RAM copy never outlives the firmware
+	return 0;
+#endif // LUA_BYTECODE_PERSISTENT
+}
+
+static bool isHeaderFor(const LuaBytecodeHeader& header, uint32_t scriptCrc, size_t scriptLength) {
+	return header.magic == LUA_BYTECODE_MAGIC
+		&& header.buildSignature == getBuildSignature()
+		&& header.scriptCrc == scriptCrc
+		&& header.scriptLength == scriptLength
+		&& header.size != 0;
+}
+
+static void freeChunk(uint8_t* bytecode) {
+#if LUA_BYTECODE_PERSISTENT
+	if (bytecode == writingBytecode) {
+		// storage manager is still writing it
+		writingReplaced = true;
+		return;
+	}
+#endif // LUA_BYTECODE_PERSISTENT
+
+	luaHeapFreeLongLived(bytecode);
+}
+
+static void replaceCache(const LuaBytecodeHeader& header, uint8_t* bytecode) {
+#if LUA_BYTECODE_PERSISTENT
+	chibios_rt::MutexLocker lock(cacheMutex);
+#endif // LUA_BYTECODE_PERSISTENT
+
+	if (cacheBytecode) {
+		freeChunk(cacheBytecode);
+	}
+	cacheHeader = header;
+	cacheBytecode = bytecode;
+}
+
+#if LUA_BYTECODE_PERSISTENT
+static void waitForStorage(uint32_t scriptCrc, size_t scriptLength) {
+	storageScriptCrc = scriptCrc;
+	storageScriptLength = scriptLength;
+	storageReadState = StorageReadState::Pending;
+
+	if (storageReqestReadID(EFI_LUA_BYTECODE_INFO_RECORD_ID)) {
+		storageReadSem.wait(TIME_MS2I(LUA_BYTECODE_STORAGE_TIMEOUT_MS));
+	}
+
+	chibios_rt::MutexLocker lock(cacheMutex);
+	if (storageReadState == StorageReadState::Pending) {
+		// storage is not ready yet, whatever it reads later is dropped
+		efiPrintf(TAG "no bytecode from storage within %d ms", LUA_BYTECODE_STORAGE_TIMEOUT_MS);
+		storageReadState = StorageReadState::Done;
+	}
+}
+#endif // LUA_BYTECODE_PERSISTENT
+
+bool luaBytecodeCacheLoad(lua_State* l, uint32_t scriptCrc, size_t scriptLength) {
+#if LUA_BYTECODE_PERSISTENT
+	// once per boot, afterwards RAM copy is the most recent one
+	if (storageReadState == StorageReadState::NotRequested) {
+		waitForStorage(scriptCrc, scriptLength);
+	}
+#endif // LUA_BYTECODE_PERSISTENT
+
+	if (cacheBytecode == nullptr || !isHeaderFor(cacheHeader, scriptCrc, scriptLength)) {
+		return false;
+	}
+
+	// "b": never treat cache contents as script text
+	if (0 != luaL_loadbufferx(l, (const char*)cacheBytecode, cacheHeader.size, "=script", "b")) {
+		efiPrintf(TAG "cached bytecode rejected: %s", lua_tostring(l, -1));
+		lua_pop(l, 1);
+		replaceCache({}, nullptr);
+		return false;
+	}
+
+	cacheHitCount++;
+	return true;
+}
+
+struct DumpBuffer {
+	uint8_t* ptr;
+	size_t size;
+	size_t used;
+};
+
+static int countDumpSize(lua_State*, const void*, size_t size, void* ud) {
+	*(size_t*)ud += size;
+	return 0;
+}
+
+static int copyDump(lua_State*, const void* p, size_t size, void* ud) {
+	auto buffer = (DumpBuffer*)ud;
+	if (buffer->used + size > buffer->size) {
+		return 1;
+	}
+	memcpy(buffer->ptr + buffer->used, p, size);
+	buffer->used += size;
+	return 0;
+}
+
+void luaBytecodeCacheStore(lua_State* l, uint32_t scriptCrc, size_t scriptLength) {
+	// dump twice rather than growing a buffer: exact size allocation and no realloc peak
+	size_t size = 0;
+	if (0 != lua_dump(l, countDumpSize, &size, 1) || size == 0) {
+		return;
+	}
+
+	// chunk of previous script is of no use, its memory might be needed for the new one
+	replaceCache({}, nullptr);
+
+	DumpBuffer buffer = { (uint8_t*)luaHeapAllocLongLived(size), size, 0 };
+	if (buffer.ptr == nullptr) {
+		efiPrintf(TAG "no memory to cache %d bytes of bytecode", size);
+		return;
+	}
+
+	if (0 != lua_dump(l, copyDump, &buffer, 1) || buffer.used != size) {
+		luaHeapFreeLongLived(buffer.ptr);
+		return;
+	}
+
+	LuaBytecodeHeader header = {
+		LUA_BYTECODE_MAGIC,
+		getBuildSignature(),
+		scriptCrc,
+		(uint32_t)scriptLength,
+		(uint32_t)size,
+		crc32(buffer.ptr, size),
+	};
+	replaceCache(header, buffer.ptr);
+
+#if LUA_BYTECODE_PERSISTENT
+	storageRequestWriteID(EFI_LUA_BYTECODE_RECORD_ID, false);
+#endif // LUA_BYTECODE_PERSISTENT
+}
+
+size_t luaBytecodeCacheSize() {
+	return cacheBytecode ? cacheHeader.size : 0;
+}
+
+uint32_t luaBytecodeCacheHitCount() {
+	return cacheHitCount;
+}
+
+void luaBytecodeCachePrintInfo() {
+	efiPrintf(TAG "bytecode cache: %d bytes for script crc %08lx, %lu hit(s)",
+		luaBytecodeCacheSize(), cacheHeader.scriptCrc, cacheHitCount);
+}
+
+#if LUA_BYTECODE_PERSISTENT
+// @return chunk to publish, nullptr if there is none for the script Lua thread waits for
+static uint8_t* readChunk(LuaBytecodeHeader& header) {
+	if (storageRead(EFI_LUA_BYTECODE_INFO_RECORD_ID, (uint8_t *)&header, sizeof(header)) != StorageStatus::Ok) {
+		return nullptr;
+	}
+	if (!isHeaderFor(header, storageScriptCrc, storageScriptLength)) {
+		if (header.magic == LUA_BYTECODE_MAGIC && header.buildSignature != getBuildSignature()) {
+			efiPrintf(TAG "stored bytecode is from another firmware build");
+		}
+		// chunk of some older script or firmware, it would be overwritten once current one is compiled
+		return nullptr;
+	}
+
+	uint8_t* bytecode = (uint8_t*)luaHeapAllocLongLived(header.size);
+	if (bytecode == nullptr) {
+		return nullptr;
+	}
+
+	if (storageRead(EFI_LUA_BYTECODE_RECORD_ID, bytecode, header.size) != StorageStatus::Ok ||
+			crc32(bytecode, header.size) != header.bytecodeCrc) {
+		efiPrintf(TAG "stored bytecode is damaged");
+		luaHeapFreeLongLived(bytecode);
+		return nullptr;
+	}
+
+	return bytecode;
+}
+
+static void writeChunk(const LuaBytecodeHeader& header, const uint8_t* bytecode) {
+	LuaBytecodeHeader stored;
+	if (storageRead(EFI_LUA_BYTECODE_INFO_RECORD_ID, (uint8_t *)&stored, sizeof(stored)) == StorageStatus::Ok &&
+			memcmp(&stored, &header, sizeof(stored)) == 0) {
+		// same chunk is already there, save the flash
+		return;
+	}
+
+	// data first: if we get interrupted old header does not match CRC of new data
+	if (storageWrite(EFI_LUA_BYTECODE_RECORD_ID, bytecode, header.size) != StorageStatus::Ok) {
+		efiPrintf(TAG "failed to store %d bytes of bytecode", header.size);
+		return;
+	}
+	storageWrite(EFI_LUA_BYTECODE_INFO_RECORD_ID, (const uint8_t *)&header, sizeof(header));
+}
+#endif // LUA_BYTECODE_PERSISTENT
+
+void luaBytecodeCacheReadStorage() {
+#if LUA_BYTECODE_PERSISTENT
+	if (storageReadState != StorageReadState::Pending) {
+		// Lua thread did not wait for us
+		return;
+	}
+
+	LuaBytecodeHeader header;
+	uint8_t* bytecode = readChunk(header);
+
+	{
+		chibios_rt::MutexLocker lock(cacheMutex);
+		if (storageReadState == StorageReadState::Pending) {
+			// Lua thread waits and does not touch the cache until signalled
+			if (bytecode) {
+				efiPrintf(TAG "using %d bytes of bytecode from storage", header.size);
+				cacheHeader = header;
+				cacheBytecode = bytecode;
+				bytecode = nullptr;
+			}
+			storageReadState = StorageReadState::Done;
+			storageReadSem.signal();
+		}
+	}
+
+	if (bytecode) {
+		luaHeapFreeLongLived(bytecode);
+	}
+#endif // LUA_BYTECODE_PERSISTENT
+}
+
+void luaBytecodeCacheWriteStorage() {
+#if LUA_BYTECODE_PERSISTENT
+	LuaBytecodeHeader header;
+	{
+		chibios_rt::MutexLocker lock(cacheMutex);
+		if (cacheBytecode == nullptr) {
+			return;
+		}
+		// Lua thread may replace the chunk while we write it, replaceCache() leaves freeing it to us
+		header = cacheHeader;
+		writingBytecode = cacheBytecode;
+	}
+
+	writeChunk(header, writingBytecode);
+
+	chibios_rt::MutexLocker lock(cacheMutex);
+	if (writingReplaced) {
+		luaHeapFreeLongLived(writingBytecode);
+	}
+	writingBytecode = nullptr;
+	writingReplaced = false;
+#endif // LUA_BYTECODE_PERSISTENT
+}
+
+#endif // EFI_LUA
@@ -0,0 +1,34 @@
+// file lua_bytecode_cache.h
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+struct lua_State;
+
+/**
+ * Compiled script chunk without debug info, keyed by CRC and length of script text. Lua reset with
+ * unchanged script loads the chunk instead of running the parser, which is both slow and the peak of
+ * heap usage for large scripts.
+ *
+ * With EFI_LUA_BYTECODE_STORAGE the chunk is also kept in a storage record so the first start after
+ * boot skips the parser as well.
+ */
+
+/**
+ * @return true if chunk for this script was pushed onto the stack
+ */
+bool luaBytecodeCacheLoad(lua_State* l, uint32_t scriptCrc, size_t scriptLength);
+/**
+ * Remember function on top of the stack as the chunk for this script, stack is left unchanged
+ */
+void luaBytecodeCacheStore(lua_State* l, uint32_t scriptCrc, size_t scriptLength);
+
+size_t luaBytecodeCacheSize();
+uint32_t luaBytecodeCacheHitCount();
+void luaBytecodeCachePrintInfo();
+
+// storage manager context
+void luaBytecodeCacheReadStorage();
+void luaBytecodeCacheWriteStorage();
@@ -0,0 +1,74 @@
+/**
+ * @file lua_gc_scheduler.cpp
+ *
+ * lua_gc(LUA_GCSTEP, 0) does one basic step even with the collector stopped and returns 1 once
+ * that step has finished a cycle.
+ */
+
+#include "pch.h"
+
+#include "rusefi_lua.h"
+
+#if EFI_LUA
+
+#include "lua_gc_scheduler.h"
+
+size_t LuaGcScheduler::heapBytes(lua_State* l) {
+	return (size_t)lua_gc(l, LUA_GCCOUNT) * 1024 + lua_gc(l, LUA_GCCOUNTB);
+}
+
+void LuaGcScheduler::start(lua_State* l) {
+	lua_gc(l, LUA_GCCOLLECT);
+	lua_gc(l, LUA_GCSTOP);
+
+	m_isManual = true;
+	m_cycleRunning = false;
+	m_completedCycles = 0;
+	onCycleComplete(l);
+}
+
+void LuaGcScheduler::onCycleComplete(lua_State* l) {
+	m_cycleRunning = false;
+	m_heapAfterGc = heapBytes(l);
+	m_nextCycleBytes = m_heapAfterGc + m_heapAfterGc * LUA_GC_PAUSE_PERCENT / 100;
+	m_completedCycles++;
+}
+
+efidur_t LuaGcScheduler::onIdle(lua_State* l, int budgetUs) {
+	if (budgetUs <= 0) {
+		if (m_isManual) {
+			m_isManual = false;
+			m_cycleRunning = false;
+			lua_gc(l, LUA_GCRESTART);
+		}
+		return 0;
+	}
+
+	if (!m_isManual) {
+		// budget is back, continue from wherever automatic collector is
+		m_isManual = true;
+		lua_gc(l, LUA_GCSTOP);
+	}
+
+	if (!m_cycleRunning) {
+		if (heapBytes(l) < m_nextCycleBytes) {
+			// not enough garbage yet to be worth a cycle
+			return 0;
+		}
+		m_cycleRunning = true;
+	}
+
+	efitick_t startNt = getTimeNowNt();
+	efidur_t budgetNt = US2NT(budgetUs);
+	efidur_t elapsedNt;
+	do {
+		if (lua_gc(l, LUA_GCSTEP, 0)) {
+			onCycleComplete(l);
+		}
+		elapsedNt = getTimeNowNt() - startNt;
+	} while (m_cycleRunning && elapsedNt < budgetNt);
+
+	return elapsedNt;
+}
+
+#endif // EFI_LUA
@@ -0,0 +1,61 @@
+// file lua_gc_scheduler.h
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+struct lua_State;
+
+// time budget for incremental GC steps after each tick, scripts can change it with setGcStepBudget()
+#ifndef LUA_GC_STEP_BUDGET_US
+#define LUA_GC_STEP_BUDGET_US 500
+#endif
+
+// start next cycle once heap has grown by this many percent since last cycle, same as Lua 'pause'
+#define LUA_GC_PAUSE_PERCENT 50
+
+/**
+ * Lua automatic collector runs whenever an allocation pushes it over its debt, so a collection cycle
+ * lands in the middle of whatever tick happened to allocate. This scheduler stops the automatic
+ * collector and runs incremental steps in the idle part of the tick period instead, each call spends
+ * at most its budget plus one basic step.
+ *
+ * Allocation failure still triggers Lua emergency full collection while the collector is stopped.
+ */
+class LuaGcScheduler {
+public:
+	/**
+	 * Full collection as the baseline, then take over from automatic collector
+	 */
+	void start(lua_State* l);
+
+	/**
+	 * Run incremental steps until current cycle completes or budget is spent. Zero budget hands
+	 * collection back to Lua automatic collector.
+	 * @return time spent in nt
+	 */
+	efidur_t onIdle(lua_State* l, int budgetUs);
+
+	bool isCycleRunning() const {
+		return m_cycleRunning;
+	}
+	// Lua heap in bytes right after the last completed cycle
+	size_t getHeapAfterGc() const {
+		return m_heapAfterGc;
+	}
+	uint32_t getCompletedCycles() const {
+		return m_completedCycles;
+	}
+
+	static size_t heapBytes(lua_State* l);
+
+private:
+	void onCycleComplete(lua_State* l);
+
+	bool m_isManual = false;
+	bool m_cycleRunning = false;
+	size_t m_heapAfterGc = 0;
+	size_t m_nextCycleBytes = 0;
+	uint32_t m_completedCycles = 0;
+};
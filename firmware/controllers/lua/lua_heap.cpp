@@ -6,6 +6,7 @@
 
 #include "lua.hpp"
 #include "lua_heap.h"
+#include "lua_slab.h"
 
 #if EFI_PROD_CODE || EFI_SIMULATOR
 
@@ -32,9 +33,9 @@ public:
 	size_t m_size = 0;
 	uint8_t* m_buffer = nullptr;
 
-	void* alloc(size_t n) {
+	void* alloc(size_t n, unsigned align = CH_HEAP_ALIGNMENT) {
 		if (m_buffer && m_size) {
-			return chHeapAlloc(&m_heap, n);
+			return chHeapAllocAligned(&m_heap, n, align);
 		}
 
 		return nullptr;
@@ -135,62 +136,98 @@ void luaHeapInit()
 
 static size_t luaMemoryUsed = 0;
 
-void* luaHeapAlloc(void* /*ud*/, void* optr, size_t osize, size_t nsize) {
-    // If new size is zero, this is a free. Do not allocate.
-    if (nsize == 0) {
-        if (optr) {
-            size_t oldSize = chHeapGetSize(optr);
-            chHeapFree(optr);
-            luaMemoryUsed -= oldSize;
-        }
-        return nullptr;
-    }
-
-    void *nptr = nullptr;
+static void* luaAllocFromHeaps(size_t size, unsigned align) {
+	void *ptr = nullptr;
 
 	// [tag:multi-step-lua-alloc]
 	// First try dedicated Lua heap(s)
 #if (LUA_EXTRA_HEAP > 0)
-	if (nptr == nullptr) {
-		nptr = luaExtraHeap.alloc(nsize);
+	if (ptr == nullptr) {
+		ptr = luaExtraHeap.alloc(size, align);
 	}
 #endif
 #if defined(STM32F4)
-	if (nptr == nullptr) {
-		nptr = luaOptionalHeap.alloc(nsize);
+	if (ptr == nullptr) {
+		ptr = luaOptionalHeap.alloc(size, align);
 	}
 #endif
 #if MCU_HAS_CCM_RAM
-	if (nptr == nullptr) {
-		nptr = luaCcmHeap.alloc(nsize);
+	if (ptr == nullptr) {
+		ptr = luaCcmHeap.alloc(size, align);
 	}
 #endif
 
-    // [tag:multi-step-lua-alloc]
-    // then try ChibiOS default heap
+	// [tag:multi-step-lua-alloc]
+	// then try ChibiOS default heap
+	if (ptr == nullptr) {
+		ptr = chHeapAllocAligned(NULL, size, align);
+	}
+
+	return ptr;
+}
+
+// small objects live in size class pages carved out of the same heaps, see lua_slab.h
+static LuaSlabAllocator luaSlab(
+	[](size_t size, size_t alignment) { return luaAllocFromHeaps(size, alignment); },
+	[](void* page) { chHeapFree(page); }
+);
+
+static size_t luaBlockSize(void* ptr) {
+	return luaSlab.owns(ptr) ? luaSlab.getSlotSize(ptr) : chHeapGetSize(ptr);
+}
+
+static void luaBlockFree(void* ptr, size_t osize) {
+	if (luaSlab.owns(ptr)) {
+		luaMemoryUsed -= luaSlab.getSlotSize(ptr);
+		luaSlab.free(ptr, osize);
+	} else {
+		luaMemoryUsed -= chHeapGetSize(ptr);
+		// chHeapFree will find correct heap to return memory to
+		chHeapFree(ptr);
+	}
+}
+
+void* luaHeapAlloc(void* /*ud*/, void* optr, size_t osize, size_t nsize) {
+    // If new size is zero, this is a free. Do not allocate.
+    if (nsize == 0) {
+        if (optr) {
+            luaBlockFree(optr, osize);
+        }
+        return nullptr;
+    }
+
+    // small object which still fits its size class stays where it is
+    if (optr && luaSlab.owns(optr) && luaSlab.resize(optr, osize, nsize)) {
+        return optr;
+    }
+
+    void *nptr = luaSlab.alloc(nsize);
     if (nptr == nullptr) {
-        nptr = chHeapAlloc(NULL, nsize);
+        // large object, or no room for one more slab page
+        nptr = luaAllocFromHeaps(nsize, CH_HEAP_ALIGNMENT);
+    }
+    if (nptr == nullptr && luaSlab.releaseEmptyPages() > 0) {
+        // empty pages kept for small objects are worth less than this allocation
+        nptr = luaAllocFromHeaps(nsize, CH_HEAP_ALIGNMENT);
     }
 
     size_t newSize = 0;
     if (nptr) {
         // Account for newly allocated memory by actual block size
-        newSize = chHeapGetSize(nptr);
+        newSize = luaBlockSize(nptr);
         chDbgAssert(newSize >= nsize, "Lua allocator returned smaller block than requested");
         luaMemoryUsed += newSize;
     }
 
     if (optr) {
-    	chDbgAssert(osize <= chHeapGetSize(optr), "Lua lost track of allocated mem");
+        size_t oldSize = luaBlockSize(optr);
+    	chDbgAssert(osize <= oldSize, "Lua lost track of allocated mem");
         // An old pointer was passed in. Only free it if we successfully allocated a new one.
-        size_t oldSize = chHeapGetSize(optr);
         if (nptr != nullptr) {
             // Copy the minimum of old and new block sizes
             size_t copySize = (oldSize < newSize) ? oldSize : newSize;
             memcpy(nptr, optr, copySize);
-            // chHeapFree will find correct heap to return memory to
-            chHeapFree(optr);
-            luaMemoryUsed -= oldSize;
+            luaBlockFree(optr, osize);
         } else {
             if (nsize <= oldSize) {
                 return optr; // shrink must not fail per Lua's assumption
@@ -199,10 +236,6 @@ void* luaHeapAlloc(void* /*ud*/, void* optr, size_t osize, size_t nsize) {
         }
     }
 
-	if (engineConfiguration->debugMode == DBG_LUA) {
-		engine->outputChannels.debugIntField1 = luaHeapUsed();
-	}
-
 	return nptr;
 }
 
@@ -211,8 +244,29 @@ size_t luaHeapUsed()
 	return luaMemoryUsed;
 }
 
+void luaHeapUpdateLiveData() {
+	auto& state = getLuaState();
+	static_assert(sizeof(lua_state_s::luaSlabClassUsage) == LUA_SLAB_CLASS_COUNT);
+
+	size_t requested = 0;
+	for (int i = 0; i < LUA_SLAB_CLASS_COUNT; i++) {
+		auto stats = luaSlab.getClassStats(i);
+		state.luaSlabClassUsage[i] = stats.totalSlots == 0 ? 0 : 100 * stats.usedSlots / stats.totalSlots;
+		requested += stats.requestedBytes;
+	}
+
+	size_t slotBytes = luaSlab.usedBytes();
+	state.luaHeapUsedBytes = luaHeapUsed();
+	state.luaSlabSlackBytes = slotBytes - requested;
+	state.luaSlabFreeBytes = luaSlab.reservedBytes() - slotBytes;
+}
+
 void luaHeapReset()
 {
+	// some slab pages may come from ChibiOS default heap which is not reset below, return pages
+	// while heaps are still intact
+	luaSlab.releaseAll();
+
 #if (LUA_EXTRA_HEAP > 0)
 	luaExtraHeap.reset();
 #endif
@@ -226,6 +280,15 @@ void luaHeapReset()
 	luaMemoryUsed = 0;
 }
 
+void* luaHeapAllocLongLived(size_t size) {
+	// ChibiOS default heap is never reset
+	return chHeapAlloc(NULL, size);
+}
+
+void luaHeapFreeLongLived(void* ptr) {
+	chHeapFree(ptr);
+}
+
 #if CH_CFG_MEMCORE_SIZE == 0
 	extern uint8_t __heap_base__[];
 	extern uint8_t __heap_end__[];
@@ -270,6 +333,18 @@ void luaHeapPrintInfo() {
 		efiPrintf("Lua CCM heap usage: %d / %d", luaCcmHeap.used(), luaCcmHeap.size());
 	#endif
 
+	efiPrintf("Lua small object pages: %d, %d / %d bytes in use",
+		luaSlab.getPageCount(), luaSlab.usedBytes(), luaSlab.reservedBytes());
+	for (int i = 0; i < LUA_SLAB_CLASS_COUNT; i++) {
+		auto stats = luaSlab.getClassStats(i);
+		if (stats.pages == 0) {
+			continue;
+		}
+		size_t slotBytes = stats.usedSlots * stats.slotSize;
+		efiPrintf("  %3d byte slots: %d page(s), %d / %d slots used, %d bytes lost to rounding",
+			stats.slotSize, stats.pages, stats.usedSlots, stats.totalSlots, slotBytes - stats.requestedBytes);
+	}
+
 	size_t chHeapFree = 0;
 	chHeapStatus(NULL, &chHeapFree, NULL);
 	/* total available for ChibiOS minus left free, plus free in Chibios Heap */
@@ -292,6 +367,24 @@ void* luaHeapAlloc(void* /*ud*/, void* ptr, size_t /*osize*/, size_t nsize) {
 
 	return realloc(ptr, nsize);
 }
+
+void* luaHeapAllocLongLived(size_t size) {
+	return malloc(size);
+}
+
+void luaHeapFreeLongLived(void* ptr) {
+	free(ptr);
+}
+
+void luaHeapUpdateLiveData() {
+	// realloc has no statistics
+}
 #endif // EFI_PROD_CODE
 
+static lua_state_s luaState;
+
+lua_state_s& getLuaState() {
+	return luaState;
+}
+
 #endif // EFI_LUA
@@ -2,9 +2,19 @@
 
 #pragma once
 
+#include "lua_state_generated.h"
+
 void luaHeapInit();
 void* luaHeapAlloc(void* /*ud*/, void* optr, size_t osize, size_t nsize);
 size_t luaHeapUsed();
 void luaHeapReset();
 
+// blocks which outlive interpreter instances: not part of luaHeapUsed() and not wiped by luaHeapReset()
+void* luaHeapAllocLongLived(size_t size);
+void luaHeapFreeLongLived(void* ptr);
+
 void luaHeapPrintInfo();
+
+// heap and GC statistics for TS, refreshed once per Lua tick
+lua_state_s& getLuaState();
+void luaHeapUpdateLiveData();
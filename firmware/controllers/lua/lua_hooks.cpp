@@ -120,6 +120,16 @@ static int lua_getSensorByName(lua_State* l) {
 	return getSensor(l, type);
 }
 
+// lookup slots are zero based and never negative, nil if name is unknown
+static int lua_pushSlotOrNil(lua_State* l, int slot) {
+	if (slot < 0) {
+		lua_pushnil(l);
+	} else {
+		lua_pushinteger(l, slot);
+	}
+	return 1;
+}
+
 static int lua_getSensorRaw(lua_State* l) {
 	auto zeroBasedSensorIndex = luaL_checkinteger(l, 1);
 
@@ -1032,6 +1042,18 @@ extern int luaCommandCounters[LUA_BUTTON_COUNT];
 		return 1;
 	});
 
+	// resolve name once in script setup, then read by handle without hashing the name on every tick
+	lua_register(lState, "getCalibrationHandle", [](lua_State* l) {
+		auto propertyName = luaL_checklstring(l, 1, nullptr);
+		return lua_pushSlotOrNil(l, getConfigSlotByHash(djb2lowerCase(propertyName)));
+	});
+
+	lua_register(lState, "getCalibrationByHandle", [](lua_State* l) {
+		auto slot = luaL_checkinteger(l, 1);
+		lua_pushnumber(l, getConfigValueBySlot(slot));
+		return 1;
+	});
+
 #if EFI_TUNER_STUDIO && (EFI_PROD_CODE || EFI_SIMULATOR)
 	lua_register(lState, "getOutput", [](lua_State* l) {
 		auto propertyName = luaL_checklstring(l, 1, nullptr);
@@ -1041,6 +1063,18 @@ extern int luaCommandCounters[LUA_BUTTON_COUNT];
 		lua_pushnumber(l, result);
 		return 1;
 	});
+
+	lua_register(lState, "getOutputHandle", [](lua_State* l) {
+		auto propertyName = luaL_checklstring(l, 1, nullptr);
+		return lua_pushSlotOrNil(l, getOutputSlotByHash(djb2lowerCase(propertyName)));
+	});
+
+	lua_register(lState, "getOutputByHandle", [](lua_State* l) {
+		auto slot = luaL_checkinteger(l, 1);
+		updateTunerStudioState();
+		lua_pushnumber(l, getOutputValueBySlot(slot));
+		return 1;
+	});
 #endif // EFI_PROD_CODE || EFI_SIMULATOR
 
 #if EFI_SHAFT_POSITION_INPUT
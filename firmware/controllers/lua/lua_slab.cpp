@@ -0,0 +1,320 @@
+/**
+ * @file lua_slab.cpp
+ *
+ * Page layout: Page header, then slots of one size class. Never used slots are handed out by bumping
+ * an index so a new page does not need a pass to build its free list.
+ */
+
+#include "pch.h"
+
+#include "lua_slab.h"
+
+#define SLAB_ALIGNMENT 8
+
+struct LuaSlabAllocator::Page {
+	// links in partial list of own size class
+	Page* prev;
+	Page* next;
+	// slots freed after being handed out
+	void* freeList;
+	uint16_t bumpIndex;
+	uint16_t used;
+	uint8_t sizeClass;
+};
+
+static constexpr size_t alignUp(size_t size) {
+	return (size + SLAB_ALIGNMENT - 1) & ~(size_t)(SLAB_ALIGNMENT - 1);
+}
+
+size_t LuaSlabAllocator::headerSize() {
+	return alignUp(sizeof(Page));
+}
+
+// sizes of common Lua objects on 32 bit targets: short strings, tables, closures, upvalues
+static const uint16_t classSlotSize[LUA_SLAB_CLASS_COUNT] = { 16, 24, 32, 48, 64, 96, LUA_SLAB_MAX_SIZE };
+
+// size class by size rounded up to SLAB_ALIGNMENT
+static const uint8_t classBySize[LUA_SLAB_MAX_SIZE / SLAB_ALIGNMENT + 1] = {
+	0, 0, 0, 1, 2, 3, 3, 4, 4, 5, 5, 5, 5, 6, 6, 6, 6
+};
+
+static_assert(LUA_SLAB_CLASS_COUNT == efi::size(classSlotSize));
+static_assert((LUA_SLAB_PAGE_SIZE & (LUA_SLAB_PAGE_SIZE - 1)) == 0, "page size has to be power of two");
+static_assert((LUA_SLAB_MAX_PAGES * 2 & (LUA_SLAB_MAX_PAGES * 2 - 1)) == 0, "page table size has to be power of two");
+
+LuaSlabAllocator::LuaSlabAllocator(PageAlloc pageAlloc, PageFree pageFree)
+	: m_pageAlloc(pageAlloc)
+	, m_pageFree(pageFree)
+{
+	reset();
+}
+
+int LuaSlabAllocator::getSizeClass(size_t size) {
+	if (size == 0 || size > LUA_SLAB_MAX_SIZE) {
+		return -1;
+	}
+	return classBySize[(size + SLAB_ALIGNMENT - 1) / SLAB_ALIGNMENT];
+}
+
+size_t LuaSlabAllocator::getClassSlotSize(int sizeClass) {
+	return classSlotSize[sizeClass];
+}
+
+size_t LuaSlabAllocator::getClassCapacity(int sizeClass) {
+	return (LUA_SLAB_PAGE_SIZE - headerSize()) / classSlotSize[sizeClass];
+}
+
+void LuaSlabAllocator::reset() {
+	for (int i = 0; i < LUA_SLAB_CLASS_COUNT; i++) {
+		m_partial[i] = nullptr;
+		m_classPages[i] = 0;
+		m_emptyPages[i] = 0;
+		m_usedSlots[i] = 0;
+		m_requestedBytes[i] = 0;
+	}
+	m_pageCount = 0;
+	for (auto& pageAddress : m_pageTable) {
+		pageAddress = 0;
+	}
+}
+
+LuaSlabAllocator::Page* LuaSlabAllocator::pageOf(const void* ptr) {
+	return reinterpret_cast<Page*>(reinterpret_cast<uintptr_t>(ptr) & ~(uintptr_t)(LUA_SLAB_PAGE_SIZE - 1));
+}
+
+size_t LuaSlabAllocator::pageSlot(uintptr_t pageAddress) {
+	// Fibonacci hashing of page number
+	uint32_t pageNumber = (uint32_t)(pageAddress / LUA_SLAB_PAGE_SIZE);
+	return (pageNumber * 2654435761u) & (PAGE_TABLE_SIZE - 1);
+}
+
+void LuaSlabAllocator::registerPage(uintptr_t pageAddress) {
+	size_t slot = pageSlot(pageAddress);
+	while (m_pageTable[slot] != 0) {
+		slot = (slot + 1) & (PAGE_TABLE_SIZE - 1);
+	}
+	m_pageTable[slot] = pageAddress;
+	m_pageCount++;
+}
+
+void LuaSlabAllocator::unregisterPage(uintptr_t pageAddress) {
+	size_t hole = pageSlot(pageAddress);
+	while (m_pageTable[hole] != pageAddress) {
+		criticalAssertVoid(m_pageTable[hole] != 0, "Lua slab page not registered");
+		hole = (hole + 1) & (PAGE_TABLE_SIZE - 1);
+	}
+	m_pageTable[hole] = 0;
+	m_pageCount--;
+
+	// backward shift deletion: move following entries of the probe run into the hole where allowed
+	size_t next = hole;
+	while (true) {
+		next = (next + 1) & (PAGE_TABLE_SIZE - 1);
+		if (m_pageTable[next] == 0) {
+			return;
+		}
+
+		size_t home = pageSlot(m_pageTable[next]);
+		bool homeBetweenHoleAndNext = hole <= next ? (hole < home && home <= next) : (hole < home || home <= next);
+		if (!homeBetweenHoleAndNext) {
+			m_pageTable[hole] = m_pageTable[next];
+			m_pageTable[next] = 0;
+			hole = next;
+		}
+	}
+}
+
+bool LuaSlabAllocator::owns(const void* ptr) const {
+	uintptr_t pageAddress = reinterpret_cast<uintptr_t>(pageOf(ptr));
+	if (pageAddress == 0) {
+		return false;
+	}
+
+	size_t slot = pageSlot(pageAddress);
+	while (m_pageTable[slot] != 0) {
+		if (m_pageTable[slot] == pageAddress) {
+			return true;
+		}
+		slot = (slot + 1) & (PAGE_TABLE_SIZE - 1);
+	}
+	return false;
+}
+
+size_t LuaSlabAllocator::getSlotSize(const void* ptr) const {
+	return classSlotSize[pageOf(ptr)->sizeClass];
+}
+
+bool LuaSlabAllocator::isFull(const Page* page) const {
+	return page->freeList == nullptr && page->bumpIndex == getClassCapacity(page->sizeClass);
+}
+
+void LuaSlabAllocator::linkPartial(Page* page) {
+	Page*& head = m_partial[page->sizeClass];
+	page->prev = nullptr;
+	page->next = head;
+	if (head) {
+		head->prev = page;
+	}
+	head = page;
+}
+
+void LuaSlabAllocator::unlinkPartial(Page* page) {
+	if (page->prev) {
+		page->prev->next = page->next;
+	} else {
+		m_partial[page->sizeClass] = page->next;
+	}
+	if (page->next) {
+		page->next->prev = page->prev;
+	}
+	page->prev = page->next = nullptr;
+}
+
+LuaSlabAllocator::Page* LuaSlabAllocator::newPage(int sizeClass) {
+	if (m_pageCount >= LUA_SLAB_MAX_PAGES) {
+		return nullptr;
+	}
+
+	void* memory = m_pageAlloc(LUA_SLAB_PAGE_SIZE, LUA_SLAB_PAGE_SIZE);
+	if (memory == nullptr) {
+		return nullptr;
+	}
+	efiAssert(ObdCode::OBD_PCM_Processor_Fault, memory == pageOf(memory), "Lua slab page not aligned", nullptr);
+
+	registerPage(reinterpret_cast<uintptr_t>(memory));
+
+	Page* page = new (memory) Page{};
+	page->sizeClass = sizeClass;
+	m_classPages[sizeClass]++;
+	m_emptyPages[sizeClass]++;
+	linkPartial(page);
+	return page;
+}
+
+void LuaSlabAllocator::releasePage(Page* page) {
+	m_classPages[page->sizeClass]--;
+	unregisterPage(reinterpret_cast<uintptr_t>(page));
+	m_pageFree(page);
+}
+
+void* LuaSlabAllocator::alloc(size_t size) {
+	int sizeClass = getSizeClass(size);
+	if (sizeClass < 0) {
+		return nullptr;
+	}
+
+	Page* page = m_partial[sizeClass];
+	if (page == nullptr) {
+		page = newPage(sizeClass);
+		if (page == nullptr) {
+			return nullptr;
+		}
+	}
+
+	if (page->used == 0) {
+		m_emptyPages[sizeClass]--;
+	}
+
+	void* slot;
+	if (page->freeList) {
+		slot = page->freeList;
+		page->freeList = *reinterpret_cast<void**>(slot);
+	} else {
+		slot = reinterpret_cast<uint8_t*>(page) + headerSize() + page->bumpIndex * classSlotSize[sizeClass];
+		page->bumpIndex++;
+	}
+	page->used++;
+
+	if (isFull(page)) {
+		unlinkPartial(page);
+	}
+
+	m_usedSlots[sizeClass]++;
+	m_requestedBytes[sizeClass] += size;
+	return slot;
+}
+
+void LuaSlabAllocator::free(void* ptr, size_t size) {
+	Page* page = pageOf(ptr);
+	int sizeClass = page->sizeClass;
+	bool wasFull = isFull(page);
+
+	*reinterpret_cast<void**>(ptr) = page->freeList;
+	page->freeList = ptr;
+	page->used--;
+
+	m_usedSlots[sizeClass]--;
+	m_requestedBytes[sizeClass] -= size;
+
+	if (page->used == 0 && m_emptyPages[sizeClass] > 0) {
+		// this class already has an empty page for the next allocation
+		if (!wasFull) {
+			unlinkPartial(page);
+		}
+		releasePage(page);
+		return;
+	}
+
+	if (page->used == 0) {
+		m_emptyPages[sizeClass]++;
+	}
+	if (wasFull) {
+		linkPartial(page);
+	}
+}
+
+size_t LuaSlabAllocator::releaseEmptyPages() {
+	size_t released = 0;
+	for (int i = 0; i < LUA_SLAB_CLASS_COUNT; i++) {
+		Page* page = m_partial[i];
+		while (page && m_emptyPages[i] > 0) {
+			Page* next = page->next;
+			if (page->used == 0) {
+				unlinkPartial(page);
+				releasePage(page);
+				m_emptyPages[i]--;
+				released++;
+			}
+			page = next;
+		}
+	}
+	return released;
+}
+
+void LuaSlabAllocator::releaseAll() {
+	for (auto pageAddress : m_pageTable) {
+		if (pageAddress != 0) {
+			m_pageFree(reinterpret_cast<void*>(pageAddress));
+		}
+	}
+	reset();
+}
+
+bool LuaSlabAllocator::resize(void* ptr, size_t oldSize, size_t newSize) {
+	int sizeClass = pageOf(ptr)->sizeClass;
+	if (getSizeClass(newSize) != sizeClass) {
+		return false;
+	}
+
+	m_requestedBytes[sizeClass] += newSize;
+	m_requestedBytes[sizeClass] -= oldSize;
+	return true;
+}
+
+LuaSlabAllocator::ClassStats LuaSlabAllocator::getClassStats(int sizeClass) const {
+	return {
+		classSlotSize[sizeClass],
+		m_classPages[sizeClass],
+		m_usedSlots[sizeClass],
+		m_classPages[sizeClass] * getClassCapacity(sizeClass),
+		m_requestedBytes[sizeClass],
+	};
+}
+
+size_t LuaSlabAllocator::usedBytes() const {
+	size_t result = 0;
+	for (int i = 0; i < LUA_SLAB_CLASS_COUNT; i++) {
+		result += m_usedSlots[i] * classSlotSize[i];
+	}
+	return result;
+}
@@ -0,0 +1,116 @@
+// file lua_slab.h
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#define LUA_SLAB_PAGE_SIZE 1024
+// small objects above this many pages go to the backend heap directly
+#define LUA_SLAB_MAX_PAGES 64
+#define LUA_SLAB_CLASS_COUNT 7
+#define LUA_SLAB_MAX_SIZE 128
+
+/**
+ * Size class allocator for small Lua objects: strings, tables, closures and upvalues.
+ *
+ * Pages are LUA_SLAB_PAGE_SIZE aligned blocks taken from a backend heap, each page only holds slots of
+ * one size class so small objects do not fragment the backend heap. Allocating and freeing a slot is
+ * constant time. One empty page per size class is kept so that an object created and collected over and
+ * over does not take a page from the backend and give it back every time, further empty pages go back.
+ */
+class LuaSlabAllocator {
+public:
+	using PageAlloc = void* (*)(size_t size, size_t alignment);
+	using PageFree = void (*)(void* page);
+
+	struct ClassStats {
+		size_t slotSize;
+		size_t pages;
+		size_t usedSlots;
+		size_t totalSlots;
+		// sum of sizes Lua has asked for, slot bytes in use minus this is internal fragmentation
+		size_t requestedBytes;
+	};
+
+	LuaSlabAllocator(PageAlloc pageAlloc, PageFree pageFree);
+
+	/**
+	 * @return size class index, -1 if this size is not served by slabs
+	 */
+	static int getSizeClass(size_t size);
+	static size_t getClassSlotSize(int sizeClass);
+	static size_t getClassCapacity(int sizeClass);
+
+	/**
+	 * @return nullptr if size is too large for slabs or no page could be allocated
+	 */
+	void* alloc(size_t size);
+	/**
+	 * @param size size Lua believes the object has, only used for statistics
+	 */
+	void free(void* ptr, size_t size);
+	/**
+	 * @return true if object stays in its slot with new size
+	 */
+	bool resize(void* ptr, size_t oldSize, size_t newSize);
+
+	/**
+	 * @return true if ptr is a slot of one of our pages
+	 */
+	bool owns(const void* ptr) const;
+	size_t getSlotSize(const void* ptr) const;
+
+	/**
+	 * Give cached empty pages back to the backend, for when backend is short of memory
+	 * @return number of pages released
+	 */
+	size_t releaseEmptyPages();
+	/**
+	 * Give all pages back to the backend, slots still in use are lost
+	 */
+	void releaseAll();
+
+	ClassStats getClassStats(int sizeClass) const;
+	size_t getPageCount() const {
+		return m_pageCount;
+	}
+	// slot bytes in use
+	size_t usedBytes() const;
+	// page bytes taken from backend
+	size_t reservedBytes() const {
+		return m_pageCount * LUA_SLAB_PAGE_SIZE;
+	}
+
+private:
+	struct Page;
+
+	static size_t headerSize();
+	void reset();
+	Page* newPage(int sizeClass);
+	void releasePage(Page* page);
+	bool isFull(const Page* page) const;
+	void linkPartial(Page* page);
+	void unlinkPartial(Page* page);
+
+	static Page* pageOf(const void* ptr);
+	static size_t pageSlot(uintptr_t pageAddress);
+	void registerPage(uintptr_t pageAddress);
+	void unregisterPage(uintptr_t pageAddress);
+
+	const PageAlloc m_pageAlloc;
+	const PageFree m_pageFree;
+
+	// pages with at least one free slot
+	Page* m_partial[LUA_SLAB_CLASS_COUNT];
+	size_t m_classPages[LUA_SLAB_CLASS_COUNT];
+	// pages without slots in use, still on partial list
+	size_t m_emptyPages[LUA_SLAB_CLASS_COUNT];
+	size_t m_usedSlots[LUA_SLAB_CLASS_COUNT];
+	size_t m_requestedBytes[LUA_SLAB_CLASS_COUNT];
+	size_t m_pageCount = 0;
+
+	// open addressing set of page addresses, zero is empty
+	static constexpr size_t PAGE_TABLE_SIZE = LUA_SLAB_MAX_PAGES * 2;
+	uintptr_t m_pageTable[PAGE_TABLE_SIZE];
+};
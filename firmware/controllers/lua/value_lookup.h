@@ -29,8 +29,41 @@ struct plain_get_float_s {
 	float *value;
 };
 
+/**
+ * Has to match PerfectHash.mix in the generator
+ */
+inline uint32_t perfectHashMix(uint32_t key, uint32_t seed) {
+	uint32_t x = key ^ (seed * 0x9E3779B9u);
+	x ^= x >> 16;
+	x *= 0x85EBCA6Bu;
+	x ^= x >> 13;
+	x *= 0xC2B2AE35u;
+	x ^= x >> 16;
+	return x;
+}
+
+/**
+ * Minimal perfect hash lookup over generated tables, see PerfectHash.java
+ * Two mixes and one compare instead of a binary search through a sparse switch.
+ * @return slot of given name hash, or -1 for unknown names
+ */
+template <size_t TSlots, size_t TBuckets>
+int perfectHashLookup(const int hash, const int (&hashBySlot)[TSlots], const uint16_t (&seedByBucket)[TBuckets]) {
+	uint32_t bucket = perfectHashMix(hash, 0) % TBuckets;
+	uint32_t slot = perfectHashMix(hash, seedByBucket[bucket] + 1) % TSlots;
+	return hashBySlot[slot] == hash ? (int)slot : -1;
+}
+
+/**
+ * Slots are stable for given firmware build only, they are not meant to be stored
+ */
+int getOutputSlotByHash(const int hash);
+float getOutputValueBySlot(const int slot);
 float getOutputValueByHash(const int hash);
 
+int getConfigSlotByHash(const int hash);
+float getConfigValueBySlot(const int slot);
+
 float getConfigValueByHash(const int hash);
 float getConfigValueByName(const char *name);
 /**
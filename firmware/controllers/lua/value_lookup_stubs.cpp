@@ -10,6 +10,22 @@
 #include "pch.h"
 #include "value_lookup.h"
 
+int getOutputSlotByHash(const int /*hash*/) {
+	return -1;
+}
+
+float getOutputValueBySlot(const int /*slot*/) {
+	return EFI_ERROR_CODE;
+}
+
+int getConfigSlotByHash(const int /*hash*/) {
+	return -1;
+}
+
+float getConfigValueBySlot(const int /*slot*/) {
+	return EFI_ERROR_CODE;
+}
+
 float getOutputValueByName(const char * /*name*/) {
 	return EFI_ERROR_CODE;
 }
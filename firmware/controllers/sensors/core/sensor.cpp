@@ -1,6 +1,8 @@
 #include "pch.h"
 #include "auto_generated_sensor.h"
 
+#include <atomic>
+
 // This struct represents one sensor in the registry.
 // It stores whether the sensor should use a mock value,
 // the value to use, and if not a pointer to the sensor that
@@ -235,6 +237,48 @@ void Sensor::setInvalidMockValue(SensorType type) {
 	}
 }
 
+/**
+ * Two snapshot buffers: publisher fills the one readers are not pointed at, then flips.
+ * s_snapshotSequence is odd while a publish is in progress, s_snapshotSequence / 2 counts
+ * completed publishes and its lowest bit selects the current buffer.
+ *
+ * An ISR which interrupts the publisher copies the current buffer which is not being written
+ * so it never retries. A reader which is itself interrupted long enough for the publisher to
+ * start writing into the buffer it copies from retries, same as a seqlock.
+ */
+static SensorSnapshot s_snapshots[2];
+static std::atomic<uint32_t> s_snapshotSequence{0};
+
+static SensorSnapshot& getSnapshotBuffer(uint32_t sequence) {
+	return s_snapshots[(sequence / 2) & 1];
+}
+
+/*static*/ void Sensor::publishSnapshot() {
+	uint32_t sequence = s_snapshotSequence.load();
+	// odd: the next buffer is being written
+	s_snapshotSequence.store(sequence + 1);
+
+	SensorSnapshot& next = getSnapshotBuffer(sequence + 2);
+	for (size_t i = 0; i < efi::size(s_sensorRegistry); i++) {
+		next.set(i, s_sensorRegistry[i].get());
+	}
+
+	s_snapshotSequence.store(sequence + 2);
+}
+
+/*static*/ void Sensor::getSnapshot(SensorSnapshot& dest) {
+	while (true) {
+		uint32_t sequence = s_snapshotSequence.load();
+		dest = getSnapshotBuffer(sequence);
+
+		// copied buffer is only written again once the publish after the next one starts
+		uint32_t completed = sequence & ~1u;
+		if (s_snapshotSequence.load() - completed < 3) {
+			return;
+		}
+	}
+}
+
 /*static*/ const char* Sensor::getSensorName(SensorType type) {
 	return getSensorType(type);
 }
@@ -51,6 +51,7 @@ using SensorResult = expected<float>;
 
 // Fwd declare - nobody outside of Sensor.cpp needs to see inside this type
 class SensorRegistryEntry;
+class SensorSnapshot;
 
 class Sensor {
 public:
@@ -141,6 +142,18 @@ public:
 	 */
 	static void resetAllMocks();
 
+	/*
+	 * Read every registered sensor once and publish the results as the current snapshot.
+	 * Called once per ADC cycle, from one thread only.
+	 */
+	static void publishSnapshot();
+
+	/*
+	 * Copy the most recently published snapshot. All values in the copy come from the same
+	 * publishSnapshot call, safe to call from any context including ISRs.
+	 */
+	static void getSnapshot(SensorSnapshot& dest);
+
 	/*
 	 * Inhibit sensor timeouts. Used if you're doing something that will block sensor updates, such as
 	 * erasing flash memory (which stalls the CPU on some MCUs)
@@ -213,4 +226,54 @@ private:
 	static SensorRegistryEntry *getEntryForType(SensorType type);
 };
 
+/**
+ * Readings of all sensor types taken at the same time, see Sensor::publishSnapshot.
+ * Stored as plain arrays so that a consumer reading many sensors touches one block of memory
+ * instead of going through the registry and a virtual get() per sensor.
+ */
+class SensorSnapshot {
+public:
+	SensorSnapshot() {
+		// nothing published yet reads as not configured
+		for (size_t i = 0; i < sensorCount; i++) {
+			m_codes[i] = UnexpectedCode::Configuration;
+		}
+	}
+
+	SensorResult get(SensorType type) const {
+		size_t index = static_cast<size_t>(type);
+		if (index >= sensorCount) {
+			return UnexpectedCode::Configuration;
+		}
+
+		if (m_valid[index]) {
+			return m_values[index];
+		}
+
+		return m_codes[index];
+	}
+
+	float getOrZero(SensorType type) const {
+		return get(type).value_or(0);
+	}
+
+private:
+	friend class Sensor;
+
+	static constexpr size_t sensorCount = static_cast<size_t>(SensorType::PlaceholderLast);
+
+	void set(size_t index, const SensorResult& result) {
+		m_valid[index] = result.Valid;
+		if (result) {
+			m_values[index] = result.Value;
+		} else {
+			m_codes[index] = result.Code;
+		}
+	}
+
+	float m_values[sensorCount] = {};
+	UnexpectedCode m_codes[sensorCount];
+	bool m_valid[sensorCount] = {};
+};
+
 SensorType findSensorTypeByName(const char *name);
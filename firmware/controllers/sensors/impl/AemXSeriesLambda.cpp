@@ -13,7 +13,7 @@ static constexpr efidur_t sensor_timeout = MS2NT(3 * WBO_TX_PERIOD_MS);
 
 AemXSeriesWideband::AemXSeriesWideband(uint8_t sensorIndex, SensorType type)
 	: CanSensorBase(
-		0,	// ID passed here doesn't matter since we override acceptFrame
+		CanListener::anyId,	// we override acceptFrame
 		type,
 		sensor_timeout
 	)
@@ -42,11 +42,9 @@ uint32_t AemXSeriesWideband::getAemCanId() const {
 }
 
 bool AemXSeriesWideband::acceptFrame(const size_t busIndex, const CANRxFrame& frame) const {
-#if !EFI_UNIT_TEST
 	if (busIndex != getWidebandBus()) {
 		return false;
 	}
-#endif
 
 	if (frame.DLC != 8) {
 		return false;
@@ -75,6 +73,22 @@ bool AemXSeriesWideband::acceptFrame(const size_t busIndex, const CANRxFrame& fr
 	return false;
 }
 
+void AemXSeriesWideband::addHwFilters(CanHwFilterSet& filters) const {
+	int bus = getWidebandBus();
+
+	switch (sensorType()) {
+	case RUSEFI:
+		// base ID and base ID + 1
+		filters.addStandard(bus, getReCanId(), CAN_SID_MASK & ~1);
+		break;
+	case AEM:
+		filters.addExtended(bus, getAemCanId());
+		break;
+	default:
+		break;
+	}
+}
+
 bool AemXSeriesWideband::isHeaterAllowed() {
 	return ((sensorType() == AEM) || (engine->engineState.heaterControlEnabled));
 }
@@ -18,6 +18,7 @@ public:
 	AemXSeriesWideband(uint8_t sensorIndex, SensorType type);
 
 	bool acceptFrame(const size_t busIndex, const CANRxFrame& frame) const override final;
+	void addHwFilters(CanHwFilterSet& filters) const override final;
 
 	void refreshState(void);
 
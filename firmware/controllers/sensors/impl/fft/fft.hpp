@@ -38,51 +38,156 @@ void rerrange(complex_type* data, const size_t num_elements)
     }
 }
 
-bool transform(complex_type* data, const size_t count)
+// Largest transform size, twiddle factors of all smaller sizes are a subset of this table
+#ifndef FFT_MAX_SIZE
+#define FFT_MAX_SIZE 1024
+#endif
+
+static constexpr float twoPi = 6.28318530718f;
+static constexpr size_t twiddleQuarter = FFT_MAX_SIZE / 4;
+
+// sin(2 * pi * k / FFT_MAX_SIZE) over the first quarter wave, the rest follows from symmetry
+static float twiddleSin[twiddleQuarter + 1];
+static bool twiddleReady = false;
+
+static void initTwiddles()
 {
-    double local_pi = -M_PI;
+    if (twiddleReady) {
+        return;
+    }
 
-    size_t next, match;
-    real_type sine;
-    real_type delta;
-    complex_type mult, factor, product;
+    for (size_t k = 0; k <= twiddleQuarter; ++k) {
+        twiddleSin[k] = sinf(twoPi * k / FFT_MAX_SIZE);
+    }
 
-    for (size_t i = 1; i < count; i <<= 1)
-    {
-        next = i << 1;
-        delta = local_pi / i;
-        sine = sin(0.5 * delta);
+    twiddleReady = true;
+}
 
-        mult = complex_type(-2.0 * sine * sine, sin(delta));
-        factor = 1.0;
+// exp(-2 * pi * i * k / n) where n is a power of two not larger than FFT_MAX_SIZE
+static inline complex_type twiddle(size_t k, size_t n)
+{
+    size_t index = (k * (FFT_MAX_SIZE / n)) % FFT_MAX_SIZE;
+    size_t quadrant = index / twiddleQuarter;
+    size_t rest = index % twiddleQuarter;
+
+    real_type s = twiddleSin[rest];
+    real_type c = twiddleSin[twiddleQuarter - rest];
+
+    switch (quadrant) {
+    case 0:
+        return complex_type(c, -s);
+    case 1:
+        return complex_type(-s, -c);
+    case 2:
+        return complex_type(-c, s);
+    default:
+        return complex_type(s, c);
+    }
+}
 
-        for (size_t j = 0; j < i; ++j)
+// radix-2 decimation in time, expects bit reversed input
+static void transform(complex_type* data, const size_t count)
+{
+    for (size_t len = 2; len <= count; len <<= 1)
+    {
+        size_t half = len >> 1;
+
+        for (size_t j = 0; j < half; ++j)
         {
-            for (size_t k = j; k < count; k += next)
+            complex_type factor = twiddle(j, len);
+
+            for (size_t k = j; k < count; k += len)
             {
-                match = k + i;
+                size_t match = k + half;
 
-                product = data[match] * factor;
+                complex_type product = data[match] * factor;
                 data[match] = data[k] - product;
                 data[k] += product;
             }
+        }
+    }
+}
+
+inline bool isPowerOfFour(const size_t num)
+{
+    return isPow(num) && (num & 0x55555555);
+}
 
-            factor = mult * factor + factor;
+static void rearrangeRadix4(complex_type* data, const size_t num_elements)
+{
+    size_t digits = 0;
+    for (size_t n = num_elements; n > 1; n >>= 2) {
+        digits++;
+    }
+
+    for (size_t i = 0; i < num_elements; ++i)
+    {
+        size_t reversed = 0;
+        size_t rest = i;
+        for (size_t d = 0; d < digits; ++d) {
+            reversed = (reversed << 2) | (rest & 3);
+            rest >>= 2;
+        }
+
+        if (reversed > i) {
+            std::swap(data[i], data[reversed]);
         }
     }
+}
 
-    return true;
+// radix-4 decimation in time, expects base-4 digit reversed input
+static void transformRadix4(complex_type* data, const size_t count)
+{
+    for (size_t len = 4; len <= count; len <<= 2)
+    {
+        size_t quarter = len >> 2;
+
+        for (size_t j = 0; j < quarter; ++j)
+        {
+            complex_type w1 = twiddle(j, len);
+            complex_type w2 = twiddle(2 * j, len);
+            complex_type w3 = twiddle(3 * j, len);
+
+            for (size_t k = j; k < count; k += len)
+            {
+                complex_type a = data[k];
+                complex_type b = data[k + quarter] * w1;
+                complex_type c = data[k + 2 * quarter] * w2;
+                complex_type d = data[k + 3 * quarter] * w3;
+
+                complex_type t0 = a + c;
+                complex_type t1 = a - c;
+                complex_type t2 = b + d;
+                // multiply by -i
+                complex_type t3 = complex_type((b - d).imag(), -(b - d).real());
+
+                data[k] = t0 + t2;
+                data[k + quarter] = t1 + t3;
+                data[k + 2 * quarter] = t0 - t2;
+                data[k + 3 * quarter] = t1 - t3;
+            }
+        }
+    }
 }
 
 static bool ffti(complex_type* data, const size_t size)
 {
-    if(!isPow(size)) {
+    if(!isPow(size) || size > FFT_MAX_SIZE) {
         return false;
     }
 
-    rerrange(data, size);
+    initTwiddles();
 
-    return transform(data, size);
+    if (isPowerOfFour(size)) {
+        // a quarter less complex multiplications than radix-2
+        rearrangeRadix4(data, size);
+        transformRadix4(data, size);
+    } else {
+        rerrange(data, size);
+        transform(data, size);
+    }
+
+    return true;
 }
 
 bool fft_adc_sample(float * w, float ratio, float sensitivity, const adcsample_t* data_in, complex_type* data_out, const size_t size)
@@ -0,0 +1,122 @@
+/**
+ * @file knock_sample_buffers.h
+ *
+ * Hand-over of software knock sample buffers between trigger callback, ADC interrupt and knock
+ * thread. Kept apart from ADC driver code so that it can be unit tested.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+enum class KnockBufferState : uint8_t {
+	Free,
+	Sampling,
+	// sampled, waiting for or under processing
+	Ready,
+};
+
+template <typename TSample>
+struct KnockSampleBuffer {
+	TSample* samples;
+	size_t sampleCount;
+	int8_t cylinderNumber;
+	int8_t channelNumber;
+	efitick_t sampleTime;
+	// order in which buffers were sampled, so that they are processed in the same order
+	uint32_t sequence;
+	volatile KnockBufferState state;
+};
+
+template <typename TSample, size_t TCount>
+class KnockSampleBuffers {
+public:
+	using buffer_t = KnockSampleBuffer<TSample>;
+
+	// storage is TCount consecutive buffers of bufferSize samples each
+	void init(TSample* storage, size_t bufferSize) {
+		for (size_t i = 0; i < TCount; i++) {
+			m_buffers[i].samples = storage + i * bufferSize;
+			m_buffers[i].state = KnockBufferState::Free;
+		}
+
+		m_sampling = nullptr;
+	}
+
+	/**
+	 * Call only while ADC is idle. Returns the buffer to sample next window into, nullptr if all
+	 * buffers are still waiting for processing.
+	 */
+	buffer_t* startSampling() {
+		// ADC is idle but buffer was never completed: conversion failed without error callback
+		// reaching us, don't lose the buffer forever
+		onSamplingError();
+
+		for (size_t i = 0; i < TCount; i++) {
+			buffer_t* buffer = &m_buffers[i];
+			if (buffer->state == KnockBufferState::Free) {
+				buffer->state = KnockBufferState::Sampling;
+				m_sampling = buffer;
+				return buffer;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Called from ADC completion interrupt
+	 * @return true if a buffer is now ready for processing
+	 */
+	bool onSamplingComplete() {
+		buffer_t* buffer = m_sampling;
+		if (!buffer) {
+			return false;
+		}
+
+		buffer->sequence = m_nextSequence++;
+		buffer->state = KnockBufferState::Ready;
+		m_sampling = nullptr;
+		return true;
+	}
+
+	// Called from ADC error interrupt, samples of failed conversion are of no use
+	void onSamplingError() {
+		buffer_t* buffer = m_sampling;
+		if (!buffer) {
+			return;
+		}
+
+		m_sampling = nullptr;
+		buffer->state = KnockBufferState::Free;
+	}
+
+	// oldest sampled buffer, nullptr if none
+	buffer_t* findReady() {
+		buffer_t* oldest = nullptr;
+
+		for (size_t i = 0; i < TCount; i++) {
+			buffer_t* buffer = &m_buffers[i];
+			if (buffer->state != KnockBufferState::Ready) {
+				continue;
+			}
+
+			if (!oldest || static_cast<int32_t>(buffer->sequence - oldest->sequence) < 0) {
+				oldest = buffer;
+			}
+		}
+
+		return oldest;
+	}
+
+	// Done with the buffer, another sample can be taken into it
+	void release(buffer_t* buffer) {
+		buffer->state = KnockBufferState::Free;
+	}
+
+private:
+	buffer_t m_buffers[TCount];
+	buffer_t* volatile m_sampling = nullptr;
+	uint32_t m_nextSequence = 0;
+};
@@ -7,6 +7,7 @@
 #include "knock_logic.h"
 #include "software_knock.h"
 #include "knock_config.h"
+#include "knock_sample_buffers.h"
 #include "ch.hpp"
 #include "error_handling.h"
 
@@ -27,20 +28,27 @@ static SpectrogramData* spectrogramData = &spectrogramData0;
 #endif //KNOCK_SPECTROGRAM
 
 
-static NO_CACHE adcsample_t sampleBuffer[1800];
-static int8_t currentCylinderNumber = 0;
-static int8_t channelNumber = 0;
-static efitick_t lastKnockSampleTime = 0;
-static Biquad knockFilter;
+// Double buffered: the next cylinder's window is sampled into one buffer while the
+// knock thread is still processing the other one
+#ifndef KNOCK_SAMPLE_BUFFER_COUNT
+#define KNOCK_SAMPLE_BUFFER_COUNT 2
+#endif
+
+#define KNOCK_SAMPLE_BUFFER_SIZE 1800
 
-static volatile bool knockIsSampling = false;
-static volatile bool knockNeedsProcess = false;
-static volatile size_t sampleCount = 0;
+static NO_CACHE adcsample_t sampleBuffers[KNOCK_SAMPLE_BUFFER_COUNT][KNOCK_SAMPLE_BUFFER_SIZE];
+
+static KnockSampleBuffers<adcsample_t, KNOCK_SAMPLE_BUFFER_COUNT> knockBuffers;
+using KnockSampleBufferT = decltype(knockBuffers)::buffer_t;
+
+static Biquad knockFilter;
 
 chibios_rt::BinarySemaphore knockSem(/* taken =*/ true);
 
 void onKnockSamplingComplete() {
-	knockNeedsProcess = true;
+	if (!knockBuffers.onSamplingComplete()) {
+		return;
+	}
 
 	// Notify the processing thread that it's time to process this sample
 	chSysLockFromISR();
@@ -48,6 +56,10 @@ void onKnockSamplingComplete() {
 	chSysUnlockFromISR();
 }
 
+void onKnockSamplingError() {
+	knockBuffers.onSamplingError();
+}
+
 void onStartKnockSampling(uint8_t cylinderNumber, float samplingSeconds, uint8_t channelIdx) {
 	if (!engineConfiguration->enableSoftwareKnock) {
 		return;
@@ -59,26 +71,27 @@ void onStartKnockSampling(uint8_t cylinderNumber, float samplingSeconds, uint8_t
 		return;
 	}
 
-	// If there's pending processing, skip this event
-	if (knockNeedsProcess) {
+	// If all buffers are still waiting for processing, skip this event
+	KnockSampleBufferT* buffer = knockBuffers.startSampling();
+	if (!buffer) {
 		return;
 	}
 
 	// Convert sampling time to number of samples
 	constexpr int sampleRate = KNOCK_SAMPLE_RATE;
-	sampleCount = 0xFFFFFFFE & static_cast<size_t>(clampF(100, samplingSeconds * sampleRate, efi::size(sampleBuffer)));
+	buffer->sampleCount = 0xFFFFFFFE & static_cast<size_t>(clampF(100, samplingSeconds * sampleRate, KNOCK_SAMPLE_BUFFER_SIZE));
 
 	// Select the appropriate conversion group - it will differ depending on which sensor this cylinder should listen on
 	auto conversionGroup = getKnockConversionGroup(channelIdx);
 
   //current chanel number for spectrum TS plugin
-	channelNumber = channelIdx;
+	buffer->channelNumber = channelIdx;
 
 	// Stash the current cylinder's number so we can store the result appropriately
-	currentCylinderNumber = cylinderNumber;
+	buffer->cylinderNumber = cylinderNumber;
 
-	adcStartConversionI(&KNOCK_ADC, conversionGroup, sampleBuffer, sampleCount);
-	lastKnockSampleTime = getTimeNowNt();
+	adcStartConversionI(&KNOCK_ADC, conversionGroup, buffer->samples, buffer->sampleCount);
+	buffer->sampleTime = getTimeNowNt();
 }
 
 class KnockThread : public ThreadController<UTILITY_THREAD_STACK_SIZE> {
@@ -91,6 +104,7 @@ static KnockThread kt;
 
 void initSoftwareKnock() {
 	if (engineConfiguration->enableSoftwareKnock) {
+		knockBuffers.init(&sampleBuffers[0][0], KNOCK_SAMPLE_BUFFER_SIZE);
 
 		float frequencyHz;
 
@@ -162,47 +176,27 @@ static uint8_t toDb(const float& voltage) {
 }
 #endif
 
-static void processLastKnockEvent() {
-	if (!knockNeedsProcess) {
-		return;
-	}
-
-	float sumSq = 0;
-
+static void processKnockEvent(const KnockSampleBufferT& buffer) {
 	// todo: reduce magic constants. engineConfiguration->adcVcc?
 	constexpr float ratio = 3.3f / 4095.0f;
+	constexpr float midScaleCounts = 4095.0f / 2;
 
-	size_t localCount = sampleCount;
+	size_t localCount = buffer.sampleCount;
+	const adcsample_t* sampleBuffer = buffer.samples;
 
-	// Prepare the steady state at vcc/2 so that there isn't a step
+	// Filter raw counts around vcc/2 instead of volts: the filter is linear so the scaling can be
+	// applied once to the sum. Zero state is the steady state at vcc/2, so there isn't a step
 	// when samples begin
-	// todo: reduce magic constants. engineConfiguration->adcVcc?
-	knockFilter.cookSteadyState(3.3f / 2);
-
-	// Compute the sum of squares
-	for (size_t i = 0; i < localCount; i++) {
-		float volts = ratio * sampleBuffer[i];
-
-		float filtered = knockFilter.filter(volts);
-//		if (i == localCount - 1 && engineConfiguration->debugMode == DBG_KNOCK) {
-//			engine->outputChannels.debugFloatField1 = volts;
-//			engine->outputChannels.debugFloatField2 = filtered;
-//		}
-
-		sumSq += filtered * filtered;
-	}
-
-	// take a local copy
-	auto lastKnockTime = lastKnockSampleTime;
-
-	// We're done with inspecting the buffer, another sample can be taken
-	knockNeedsProcess = false;
+	knockFilter.reset();
+	float sumSq = knockFilter.filterSumSquares(sampleBuffer, localCount, midScaleCounts) * (ratio * ratio);
 
 #ifdef KNOCK_SPECTROGRAM
 	if (engineConfiguration->enableKnockSpectrogram) {
 		ScopePerf perf(PE::KnockAnalyzer);
 
 		if (engineConfiguration->enableKnockSpectrogramFilter) {
+			// this one filters volts
+			knockFilter.cookSteadyState(3.3f / 2);
 			fft::fft_adc_sample_filtered(knockFilter, spectrogramData->window, ratio, engineConfiguration->knockSpectrumSensitivity, sampleBuffer, spectrogramData->fftBuffer, FFT_SIZE);
 		} else {
 			fft::fft_adc_sample(spectrogramData->window, ratio, engineConfiguration->knockSpectrumSensitivity, sampleBuffer, spectrogramData->fftBuffer, FFT_SIZE);
@@ -226,7 +220,7 @@ static void processLastKnockEvent() {
 			}
 		}
 
-		uint16_t compressedChannelCyl = uint16_t(channelNumber << 8 | currentCylinderNumber);
+		uint16_t compressedChannelCyl = uint16_t(buffer.channelNumber << 8 | buffer.cylinderNumber);
 
 		{
 		  chibios_rt::CriticalSectionLocker csl;
@@ -245,15 +239,20 @@ static void processLastKnockEvent() {
 	// clamp to reasonable range
 	db = clampF(-100, db, 100);
 
-	engine->module<KnockController>()->onKnockSenseCompleted(currentCylinderNumber, db, lastKnockTime);
+	engine->module<KnockController>()->onKnockSenseCompleted(buffer.cylinderNumber, db, buffer.sampleTime);
 }
 
 void KnockThread::ThreadTask() {
 	while (1) {
 		knockSem.wait();
 
-		ScopePerf perf(PE::SoftwareKnockProcess);
-		processLastKnockEvent();
+		// binary semaphore: more than one buffer could be ready by now
+		while (KnockSampleBufferT* buffer = knockBuffers.findReady()) {
+			ScopePerf perf(PE::SoftwareKnockProcess);
+			processKnockEvent(*buffer);
+
+			knockBuffers.release(buffer);
+		}
 	}
 }
 
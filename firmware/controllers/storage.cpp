@@ -70,6 +70,10 @@ bool storageAllowWriteID(StorageItemId id)
 #include "storage_sd.h"
 #endif
 
+#if EFI_LUA
+#include "lua_bytecode_cache.h"
+#endif
+
 #define STORAGE_MANAGER_POLL_INTERVAL_MS	100
 
 static constexpr size_t storagesCount = STORAGE_TOTAL;
@@ -95,6 +99,14 @@ static bool storageWriteID(uint32_t id) {
 	} else if (id == EFI_LTFT_RECORD_ID) {
 		engine->module<LongTermFuelTrim>()->store();
 		return true;
+	} else if (id == EFI_LTFT_JOURNAL_RECORD_ID) {
+		engine->module<LongTermFuelTrim>()->storeJournal();
+		return true;
+#if EFI_LUA
+	} else if (id == EFI_LUA_BYTECODE_RECORD_ID) {
+		luaBytecodeCacheWriteStorage();
+		return true;
+#endif // EFI_LUA
 	} else {
 		efiPrintf("Requested to write unknown record id %ld", id);
 		// to clear pending bit
@@ -109,6 +121,11 @@ static bool storageReadID(uint32_t id) {
 	if (id == EFI_LTFT_RECORD_ID) {
 		engine->module<LongTermFuelTrim>()->load();
 		return true;
+#if EFI_LUA
+	} else if (id == EFI_LUA_BYTECODE_INFO_RECORD_ID) {
+		luaBytecodeCacheReadStorage();
+		return true;
+#endif // EFI_LUA
 	} else {
 		efiPrintf("Requested to read unknown record id %ld", id);
 		// to clear pending bit
@@ -49,6 +49,11 @@ enum StorageItemId {
 	EFI_SETTINGS_RECORD_ID = 1,
 	EFI_SETTINGS_BACKUP_RECORD_ID = 2,
 	EFI_LTFT_RECORD_ID = 3,
+	// learned cells since last EFI_LTFT_RECORD_ID write
+	EFI_LTFT_JOURNAL_RECORD_ID = 4,
+	// script CRC and size of EFI_LUA_BYTECODE_RECORD_ID, records are read with exact size
+	EFI_LUA_BYTECODE_INFO_RECORD_ID = 5,
+	EFI_LUA_BYTECODE_RECORD_ID = 6,
 
 	EFI_STORAGE_TOTAL_ITEMS
 };
@@ -42,6 +42,12 @@ const char *SettingStorageSD::getIdFileName(size_t id) {
 	switch (id) {
 	case EFI_LTFT_RECORD_ID:
 		return "ltft.bin";
+	case EFI_LTFT_JOURNAL_RECORD_ID:
+		return "ltftj.bin";
+	case EFI_LUA_BYTECODE_INFO_RECORD_ID:
+		return "luabci.bin";
+	case EFI_LUA_BYTECODE_RECORD_ID:
+		return "luabc.bin";
 	default:
 		return nullptr;
 	}
@@ -1,9 +1,8 @@
 /**
  * @file event_queue.cpp
  * This is a data structure which keeps track of all pending events
- * Implemented as a linked list, which is fine since the number of
- * pending events is pretty low
- * todo: MAYBE migrate to a better data structure, but that's low priority
+ * Implemented as a binary min-heap so that insert and cancel from the trigger ISR
+ * take bounded O(log n) time even with many pending events
  *
  * this data structure is NOT thread safe
  *
@@ -16,6 +15,8 @@
 #include "event_queue.h"
 #include "efitime.h"
 
+#include <algorithm>
+
 #ifndef EFI_UNIT_TEST_VERBOSE_ACTION
 #define EFI_UNIT_TEST_VERBOSE_ACTION 0
 #elif EFI_UNIT_TEST_VERBOSE_ACTION
@@ -85,7 +86,7 @@ bool EventQueue::insertTask(scheduling_s *scheduling, efitick_t timeNt, action_s
 		}
 	}
 
-	assertListIsSorted();
+	assertHeapIsValid();
 	efiAssert(ObdCode::CUSTOM_ERR_ASSERT, action.getCallback() != nullptr, "NULL callback", false);
 
 // please note that simulator does not use this code at all - simulator uses signal_executor_sleep
@@ -100,73 +101,118 @@ bool EventQueue::insertTask(scheduling_s *scheduling, efitick_t timeNt, action_s
 		return false;
 	}
 
+	if (m_size >= efi::size(m_heap)) {
+		criticalError("EventQueue is full");
+		tryReturnScheduling(scheduling);
+		return false;
+	}
+
 	scheduling->setMomentNt(timeNt);
 	scheduling->action = action;
+	scheduling->queueOrder = m_insertCounter++;
 
-	if (!m_head || timeNt < m_head->getMomentNt()) {
-		// here we insert into head of the linked list
-		LL_PREPEND(m_head, scheduling);
-		assertListIsSorted();
-		return true;
-	} else {
-		// here we know we are not in the head of the list, let's find the position - linear search
-		scheduling_s *insertPosition = m_head;
-		while (insertPosition->next != nullptr && insertPosition->next->getMomentNt() < timeNt) {
-			insertPosition = insertPosition->next;
-		}
+	// append as the last leaf and bubble it up towards the root
+	size_t index = m_size++;
+	place(index, scheduling);
+	siftUp(index);
 
-		scheduling->next = insertPosition->next;
-		insertPosition->next = scheduling;
-		assertListIsSorted();
-		return false;
-	}
+	assertHeapIsValid();
+	return scheduling->queueIndex == 0;
 }
 
 void EventQueue::remove(scheduling_s* scheduling) {
-	assertListIsSorted();
+	assertHeapIsValid();
 
 	// Special case: event isn't scheduled, so don't cancel it
 	if (!scheduling->action) {
 		return;
 	}
 
-	// Special case: empty list, nothing to do
-	if (!m_head) {
+	// Special case: empty queue, nothing to do
+	if (m_size == 0) {
 		return;
 	}
 
-	// Special case: is the item to remove at the head?
-	if (scheduling == m_head) {
-		m_head = m_head->next;
-		scheduling->next = nullptr;
-		scheduling->action = {};
-	} else {
-		auto prev = m_head;	// keep track of the element before the one to remove, so we can link around it
-		auto current = prev->next;
-
-		// Find our element
-		while (current && current != scheduling) {
-			prev = current;
-			current = current->next;
-		}
+	size_t index = scheduling->queueIndex;
 
-		// Walked off the end, this is an error since this *should* have been scheduled
-		if (!current) {
-			firmwareError(ObdCode::OBD_PCM_Processor_Fault, "EventQueue::remove didn't find element");
-			return;
-		}
+	// Stale index, this is an error since this *should* have been scheduled
+	if (index >= m_size || m_heap[index] != scheduling) {
+		firmwareError(ObdCode::OBD_PCM_Processor_Fault, "EventQueue::remove didn't find element");
+		return;
+	}
+
+	removeAt(index);
 
-		efiAssertVoid(ObdCode::OBD_PCM_Processor_Fault, current == scheduling, "current not equal to scheduling");
+	// Clean the item to remove
+	scheduling->action = {};
 
-		// Link around the removed item
-		prev->next = current->next;
+	assertHeapIsValid();
+}
+
+bool EventQueue::isBefore(const scheduling_s *a, const scheduling_s *b) const {
+	efitick_t aNt = a->getMomentNt();
+	efitick_t bNt = b->getMomentNt();
+	if (aNt != bNt) {
+		return aNt < bNt;
+	}
+	// same moment: whoever was inserted first goes first, wrap-around safe
+	return static_cast<int32_t>(a->queueOrder - b->queueOrder) < 0;
+}
+
+void EventQueue::place(size_t index, scheduling_s *scheduling) {
+	m_heap[index] = scheduling;
+	scheduling->queueIndex = index;
+}
 
-		// Clean the item to remove
-		current->next = nullptr;
-		current->action = {};
+void EventQueue::siftUp(size_t index) {
+	scheduling_s *element = m_heap[index];
+	while (index > 0) {
+		size_t parent = (index - 1) / 2;
+		if (!isBefore(element, m_heap[parent])) {
+			break;
+		}
+		place(index, m_heap[parent]);
+		index = parent;
 	}
+	place(index, element);
+}
 
-	assertListIsSorted();
+void EventQueue::siftDown(size_t index) {
+	scheduling_s *element = m_heap[index];
+	while (true) {
+		size_t child = 2 * index + 1;
+		if (child >= m_size) {
+			break;
+		}
+		// pick the sooner of the two children
+		if (child + 1 < m_size && isBefore(m_heap[child + 1], m_heap[child])) {
+			child++;
+		}
+		if (!isBefore(m_heap[child], element)) {
+			break;
+		}
+		place(index, m_heap[child]);
+		index = child;
+	}
+	place(index, element);
+}
+
+/**
+ * Unlinks element at specified heap position, the last leaf takes its place
+ */
+void EventQueue::removeAt(size_t index) {
+	scheduling_s *removed = m_heap[index];
+	m_size--;
+
+	if (index != m_size) {
+		place(index, m_heap[m_size]);
+		// the former last leaf could belong either above or below this position
+		siftDown(index);
+		siftUp(index);
+	}
+
+	m_heap[m_size] = nullptr;
+	removed->queueIndex = 0;
 }
 
 /**
@@ -176,8 +222,9 @@ void EventQueue::remove(scheduling_s* scheduling) {
  * @return Get the timestamp of the soonest pending action, skipping all the actions in the past
  */
 expected<efitick_t> EventQueue::getNextEventTime(efitick_t nowNt) const {
-	if (m_head) {
-		if (m_head->getMomentNt() <= nowNt) {
+	if (m_size > 0) {
+		scheduling_s *head = m_heap[0];
+		if (head->getMomentNt() <= nowNt) {
 			/**
 			 * We are here if action timestamp is in the past. We should rarely be here since this 'getNextEventTime()' is
 			 * always invoked by 'scheduleTimerCallback' which is always invoked right after 'executeAllPendingActions' - but still,
@@ -188,7 +235,7 @@ expected<efitick_t> EventQueue::getNextEventTime(efitick_t nowNt) const {
 			 */
 			return nowNt + m_lateDelay;
 		} else {
-			return m_head->getMomentNt();
+			return head->getMomentNt();
 		}
 	}
 
@@ -209,7 +256,7 @@ int EventQueue::executeAll(efitick_t now) {
 
 	int executionCounter = 0;
 
-	assertListIsSorted();
+	assertHeapIsValid();
 
 	bool didExecute;
 	do {
@@ -221,15 +268,15 @@ int EventQueue::executeAll(efitick_t now) {
 }
 
 bool EventQueue::executeOne(efitick_t now) {
-	// Read the head every time - a previously executed event could
-	// have inserted something new at the head
-	scheduling_s* current = m_head;
-
 	// Queue is empty - bail
-	if (!current) {
+	if (m_size == 0) {
 		return false;
 	}
 
+	// Read the head every time - a previously executed event could
+	// have inserted something new at the head
+	scheduling_s* current = m_heap[0];
+
 	// If the next event is far in the future, we'll reschedule
 	// and execute it next time.
 	// We do this when the next event is close enough that the overhead of
@@ -261,9 +308,8 @@ extern bool unitTestBusyWaitHack;
 		UNIT_TEST_BUSY_WAIT_CALLBACK();
 	}
 
-	// step the head forward, unlink this element, clear scheduled flag
-	m_head = current->next;
-	current->next = nullptr;
+	// unlink this element from the heap, clear scheduled flag below
+	removeAt(0);
 
 	// Grab the action but clear it in the event so we can reschedule from the action's execution
 	auto const action{ std::move(current->action) };
@@ -288,61 +334,64 @@ extern bool unitTestBusyWaitHack;
 #endif
 	}
 
-	assertListIsSorted();
+	assertHeapIsValid();
 	return true;
 }
 
 int EventQueue::size() const {
-	scheduling_s *tmp;
-	int result;
-	LL_COUNT(m_head, tmp, result);
-	return result;
+	return m_size;
 }
 
-void EventQueue::assertListIsSorted() const {
+void EventQueue::assertHeapIsValid() const {
 #if EFI_UNIT_TEST || EFI_SIMULATOR
-	int counter = 0;
-	scheduling_s *current = m_head;
-	while (current != nullptr && current->next != nullptr) {
-		efiAssertVoid(ObdCode::CUSTOM_ERR_6623, current->getMomentNt() <= current->next->getMomentNt(), "list order");
-		current = current->next;
-		if (counter++ > 1'000'000'000)
-			criticalError("EventQueue: looks like a loop?!");
+	if (!validateHeap) {
+		return;
+	}
+
+	for (size_t i = 0; i < m_size; i++) {
+		efiAssertVoid(ObdCode::CUSTOM_ERR_6623, m_heap[i]->queueIndex == i, "heap index");
+		if (i > 0) {
+			efiAssertVoid(ObdCode::CUSTOM_ERR_6623, !isBefore(m_heap[i], m_heap[(i - 1) / 2]), "heap order");
+		}
 	}
 #endif // EFI_UNIT_TEST || EFI_SIMULATOR
 }
 
 scheduling_s * EventQueue::getHead() {
-	return m_head;
+	return m_size > 0 ? m_heap[0] : nullptr;
 }
 
-// todo: reduce code duplication with another 'getElementAtIndexForUnitText'
+/**
+ * O(size * log(size)) - only meant for unit tests
+ * @return element which would be executed 'index'-th
+ */
 scheduling_s *EventQueue::getElementAtIndexForUnitText(int index) {
-	scheduling_s * current;
-
-	LL_FOREACH(m_head, current)
-	{
-		if (index == 0) {
-			return current;
-		}
-		index--;
+	if (index < 0 || index >= (int)m_size) {
+		return nullptr;
 	}
 
-	return nullptr;
+	scheduling_s *sorted[EVENT_QUEUE_CAPACITY];
+	std::copy(m_heap, m_heap + m_size, sorted);
+	std::sort(sorted, sorted + m_size, [this](const scheduling_s *a, const scheduling_s *b) {
+		return isBefore(a, b);
+	});
+
+	return sorted[index];
 }
 
 void EventQueue::clear() {
 	// Flush the queue, resetting all scheduling_s as though we'd executed them
-	while(m_head) {
-		auto x = m_head;
-		// link next element to head
-		m_head = x->next;
+	for (size_t i = 0; i < m_size; i++) {
+		auto x = m_heap[i];
+		m_heap[i] = nullptr;
 
 		// Reset this element
 		x->setMomentNt(0);
-		x->next = nullptr;
+		x->queueIndex = 0;
 		x->action = {};
+
+		tryReturnScheduling(x);
 	}
 
-	m_head = nullptr;
+	m_size = 0;
 }
@@ -13,8 +13,14 @@
 
 #define QUEUE_LENGTH_LIMIT 1000
 
+#ifndef EVENT_QUEUE_CAPACITY
+// scheduling pool plus statically owned scheduling_s of a 12 cylinder engine with trailing sparks and some PWM
+#define EVENT_QUEUE_CAPACITY 192
+#endif
+
 /**
- * Execution sorted linked list
+ * Execution queue implemented as binary min-heap of pointers to scheduling_s
+ * Events with the same timestamp are executed in the order in which they were inserted
  */
 class EventQueue {
 public:
@@ -24,9 +30,12 @@ public:
 	explicit EventQueue(efidur_t lateDelay = 0);
 
 	/**
-	 * O(size) - linear search in sorted linked list
+	 * O(log(size)) - heap sift up
 	 */
 	bool insertTask(scheduling_s *scheduling, efitick_t timeX, action_s const& action);
+	/**
+	 * O(log(size)) - scheduling_s knows own position in the heap
+	 */
 	void remove(scheduling_s* scheduling);
 
 	int executeAll(efitick_t now);
@@ -40,12 +49,26 @@ public:
 
 	scheduling_s* getFreeScheduling();
 	void tryReturnScheduling(scheduling_s* sched);
+
+#if EFI_UNIT_TEST || EFI_SIMULATOR
+	// O(size) self-check after each change, off only for timing the queue itself
+	bool validateHeap = true;
+#endif // EFI_UNIT_TEST || EFI_SIMULATOR
 private:
-	void assertListIsSorted() const;
+	void assertHeapIsValid() const;
+	bool isBefore(const scheduling_s *a, const scheduling_s *b) const;
+	void place(size_t index, scheduling_s *scheduling);
+	void siftUp(size_t index);
+	void siftDown(size_t index);
+	void removeAt(size_t index);
+
 	/**
-	 * this list is sorted
+	 * m_heap[0] is the soonest event, for each index 'i' m_heap[(i - 1) / 2] is not later than m_heap[i]
 	 */
-	scheduling_s *m_head = nullptr;
+	scheduling_s *m_heap[EVENT_QUEUE_CAPACITY];
+	size_t m_size = 0;
+	// insertion counter, used to keep FIFO order of events with the same timestamp
+	uint32_t m_insertCounter = 0;
 	const efidur_t m_lateDelay;
 
 	scheduling_s* m_freelist = nullptr;
@@ -290,9 +290,13 @@ struct scheduling_s {
 	virtual_timer_t timer;
 #endif /* EFI_SIMULATOR */
 
-	// Scheduler implementation uses a sorted linked list of these scheduling records.
+	// Used by EventQueue to link free scheduling records of the pool.
 	scheduling_s *next = nullptr;
 
+	// EventQueue heap bookkeeping: position in the heap and insertion order for equal timestamps
+	uint32_t queueIndex = 0;
+	uint32_t queueOrder = 0;
+
 	action_s action;
 	/**
 	 * timestamp represented as 64-bit value of ticks since MCU start
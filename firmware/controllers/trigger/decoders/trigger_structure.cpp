@@ -99,6 +99,48 @@ void TriggerWaveform::initialize(operation_mode_e p_operationMode, SyncEdge p_sy
 #endif // EFI_UNIT_TEST
 }
 
+static uint32_t fingerprintMix(uint32_t hash, uint32_t value) {
+	// FNV-1a, byte by byte
+	for (int i = 0; i < 4; i++) {
+		hash ^= (value >> (8 * i)) & 0xFF;
+		hash *= 16777619;
+	}
+	return hash;
+}
+
+// rounded so that the last bit of float math does not make firmware and unit tests disagree
+static uint32_t fingerprintMix(uint32_t hash, float value) {
+	// NaN for unused gaps
+	int32_t rounded = std::isnan(value) ? INT32_MIN : (int32_t)std::lround(value * 1e5f);
+	return fingerprintMix(hash, (uint32_t)rounded);
+}
+
+uint32_t TriggerWaveform::getSyncFingerprint(trigger_type_e type) const {
+	uint32_t hash = 2166136261;
+	hash = fingerprintMix(hash, (uint32_t)type);
+	hash = fingerprintMix(hash, (uint32_t)operationMode);
+	hash = fingerprintMix(hash, (uint32_t)syncEdge);
+	hash = fingerprintMix(hash, (uint32_t)(useOnlyRisingEdges | useOnlyPrimaryForSync << 1
+		| isSynchronizationNeeded << 2 | needSecondTriggerInput << 3));
+
+	hash = fingerprintMix(hash, (uint32_t)gapTrackingLength);
+	for (int i = 0; i < gapTrackingLength && i < GAP_TRACKING_LENGTH; i++) {
+		hash = fingerprintMix(hash, synchronizationRatioFrom[i]);
+		hash = fingerprintMix(hash, synchronizationRatioTo[i]);
+	}
+
+	hash = fingerprintMix(hash, (uint32_t)getSize());
+	for (size_t i = 0; i < getSize(); i++) {
+		uint32_t states = isRiseEvent[i];
+		for (int channel = 0; channel < PWM_PHASE_MAX_WAVE_PER_PWM; channel++) {
+			states |= (wave.getChannelState(channel, i) == TriggerValue::RISE) << (channel + 1);
+		}
+		hash = fingerprintMix(hash, states);
+		hash = fingerprintMix(hash, wave.getSwitchTime(i));
+	}
+	return hash;
+}
+
 size_t TriggerWaveform::getSize() const {
 	return wave.phaseCount;
 }
@@ -364,6 +406,33 @@ angle_t TriggerWaveform::getSwitchAngle(int index) const {
 	return getCycleDuration() * wave.getSwitchTime(index);
 }
 
+static uint32_t toSyncGapFixed(float ratio) {
+	if (!(ratio > 0)) {
+		return 0;
+	}
+	float fixed = ratio * (1 << SYNC_GAP_RATIO_SHIFT) + 0.5f;
+	return fixed >= (float)UINT32_MAX ? UINT32_MAX : (uint32_t)fixed;
+}
+
+void TriggerWaveform::prepareSyncGapRatio(int gapIndex) {
+	syncGapRatioFromQ[gapIndex] = toSyncGapFixed(synchronizationRatioFrom[gapIndex]);
+	syncGapRatioToQ[gapIndex] = toSyncGapFixed(synchronizationRatioTo[gapIndex]);
+
+	uint32_t bit = 1u << gapIndex;
+	if (std::isnan(synchronizationRatioFrom[gapIndex])) {
+		// NaN means do not use this gap ratio
+		syncGapCheckMask &= ~bit;
+	} else {
+		syncGapCheckMask |= bit;
+	}
+}
+
+void TriggerWaveform::prepareSyncGapRatios() {
+	for (int gapIndex = 0; gapIndex < GAP_TRACKING_LENGTH; gapIndex++) {
+		prepareSyncGapRatio(gapIndex);
+	}
+}
+
 void TriggerWaveform::setTriggerSynchronizationGap2(float syncRatioFrom, float syncRatioTo) {
 	setTriggerSynchronizationGap3(/*gapIndex*/0, syncRatioFrom, syncRatioTo);
 }
@@ -373,6 +442,7 @@ void TriggerWaveform::setTriggerSynchronizationGap3(int gapIndex, float syncRati
 	criticalAssertVoid(gapIndex >= 0 && gapIndex < GAP_TRACKING_LENGTH, "gapIndex out of range");
 	synchronizationRatioFrom[gapIndex] = syncRatioFrom;
 	synchronizationRatioTo[gapIndex] = syncRatioTo;
+	prepareSyncGapRatio(gapIndex);
 	if (gapIndex == 0) {
 		// we have a special case here - only sync with one gap has this feature
 		this->syncRatioAvg = (int)efiRound((syncRatioFrom + syncRatioTo) * 0.5f, 1.0f);
@@ -18,6 +18,9 @@
 #define TRIGGER_GAP_DEVIATION_LOW (1.0f - TRIGGER_GAP_DEVIATION)
 #define TRIGGER_GAP_DEVIATION_HIGH (1.0f + TRIGGER_GAP_DEVIATION)
 
+// gap ratio ranges are checked as Q16 fixed point, see TriggerWaveform#syncGapRatioFromQ
+#define SYNC_GAP_RATIO_SHIFT 16
+
 #if EFI_ENABLE_ASSERTS
 #define assertAngleRange(angle, msg, code) if (angle > 10000000 || angle < -10000000) { firmwareError(code, "angle range %s %d", msg, (int)angle);angle = 0;}
 #else
@@ -94,6 +97,19 @@ public:
 	float synchronizationRatioFrom[GAP_TRACKING_LENGTH];
 	float synchronizationRatioTo[GAP_TRACKING_LENGTH];
 
+	/**
+	 * Same ranges in Q16 fixed point so that the decoder compares tooth durations without float math.
+	 * Ratios above 65535 saturate, NaN ranges have their bit cleared in syncGapCheckMask.
+	 * Maintained by setTriggerSynchronizationGap3() and prepareSyncGapRatios()
+	 */
+	uint32_t syncGapRatioFromQ[GAP_TRACKING_LENGTH];
+	uint32_t syncGapRatioToQ[GAP_TRACKING_LENGTH];
+	/**
+	 * bit per gap index which has a ratio range to check
+	 */
+	uint32_t syncGapCheckMask = 0;
+	static_assert(GAP_TRACKING_LENGTH <= 32, "syncGapCheckMask has a bit per gap");
+
 
 	/**
 	 * used by NoiselessTriggerDecoder (See TriggerCentral::handleShaftSignal())
@@ -202,6 +218,10 @@ public:
 	  setTriggerSynchronizationGap3(index, syncRatio * TRIGGER_GAP_DEVIATION_LOW, syncRatio * TRIGGER_GAP_DEVIATION_HIGH);
 	}
 	void setTriggerSynchronizationGap2(float syncRatioFrom, float syncRatioTo);
+	/**
+	 * Refreshes fixed point gap ranges after synchronizationRatioFrom/To were written directly, like gap overrides do
+	 */
+	void prepareSyncGapRatios();
 	void setSecondTriggerSynchronizationGap(float syncRatio);
 	void setSecondTriggerSynchronizationGap2(float syncRatioFrom, float syncRatioTo);
 	void setThirdTriggerSynchronizationGap(float syncRatio);
@@ -230,11 +250,19 @@ public:
 	 */
 	int triggerShapeSynchPointIndex;
 
+	/**
+	 * Sync point comes from the first of: same shape as last time, baked table, trigger simulation
+	 */
 	void initializeSyncPoint(
 			TriggerDecoderBase& state,
 			const TriggerConfiguration& triggerConfiguration
 		);
 
+	/**
+	 * Hash of everything the sync point search depends on: events, gaps and sync flags
+	 */
+	uint32_t getSyncFingerprint(trigger_type_e type) const;
+
 	uint16_t findAngleIndex(TriggerFormDetails *details, angle_t angle) const;
 
 	TriggerWheel getWheel(size_t index);
@@ -244,6 +272,7 @@ public:
 	 */
 	angle_t getSwitchAngle(int index) const;
 private:
+	void prepareSyncGapRatio(int gapIndex);
 
 	/**
 	 * This variable is used to confirm that events are added in the right order.
@@ -254,6 +283,14 @@ private:
 	 * this is part of performance optimization
 	 */
 	operation_mode_e operationMode;
+
+	/**
+	 * Sync point of the last successful initializeSyncPoint, most configuration changes
+	 * which trigger shape re-initialization do not change the shape itself
+	 */
+	bool hasKnownSyncPoint = false;
+	uint32_t knownSyncFingerprint = 0;
+	int knownSyncPointIndex = 0;
 };
 
 /**
@@ -32,6 +32,7 @@
  * decoder uses TriggerStimulatorHelper in findTriggerZeroEventIndex
  */
 #include "trigger_simulator.h"
+#include "trigger_sync_points_generated.h"
 
 #ifndef NOISE_RATIO_THRESHOLD
 #define NOISE_RATIO_THRESHOLD 3000
@@ -70,7 +71,7 @@ void TriggerDecoderBase::resetState() {
 	setShaftSynchronized(false);
 	toothed_previous_time = 0;
 
-	setArrayValues(toothDurations, 0);
+	toothDurations.reset();
 
 	synchronizationCounter = 0;
 	totalTriggerErrorCounter = 0;
@@ -109,9 +110,59 @@ bool printTriggerDebug = false;
 bool printTriggerTrace = false;
 #endif /* ! EFI_PROD_CODE */
 
+#if EFI_UNIT_TEST
+bool useBakedTriggerSyncPoints = false;
+#endif
+
+static const BakedTriggerSyncPoint bakedTriggerSyncPoints[] = {
+	BAKED_TRIGGER_SYNC_POINTS
+	// terminator, never matches a real trigger
+	{ trigger_type_e::TT_UNUSED, 0, 0 }
+};
+
+int findBakedTriggerSyncPoint(trigger_type_e type, uint32_t fingerprint) {
+	for (const auto& baked : bakedTriggerSyncPoints) {
+		if (baked.type == type && baked.fingerprint == fingerprint && type != trigger_type_e::TT_UNUSED) {
+			return baked.syncIndex;
+		}
+	}
+	return -1;
+}
+
 void TriggerWaveform::initializeSyncPoint(TriggerDecoderBase& state,
 			const TriggerConfiguration& triggerConfiguration) {
-	triggerShapeSynchPointIndex = state.findTriggerZeroEventIndex(*this, triggerConfiguration);
+	// gap overrides write synchronizationRatioFrom/To directly
+	prepareSyncGapRatios();
+
+	if (shapeDefinitionError) {
+		// let the simulation path report it
+		triggerShapeSynchPointIndex = state.findTriggerZeroEventIndex(*this, triggerConfiguration);
+		return;
+	}
+
+	uint32_t fingerprint = getSyncFingerprint(triggerConfiguration.TriggerType.type);
+	if (hasKnownSyncPoint && knownSyncFingerprint == fingerprint) {
+		triggerShapeSynchPointIndex = knownSyncPointIndex;
+		return;
+	}
+
+	int bakedIndex = findBakedTriggerSyncPoint(triggerConfiguration.TriggerType.type, fingerprint);
+#if EFI_UNIT_TEST
+	if (!useBakedTriggerSyncPoints) {
+		bakedIndex = -1;
+	}
+#endif
+
+	if (bakedIndex >= 0) {
+		triggerShapeSynchPointIndex = bakedIndex;
+	} else {
+		// custom wheels, gap overrides and shapes newer than the baked table
+		triggerShapeSynchPointIndex = state.findTriggerZeroEventIndex(*this, triggerConfiguration);
+	}
+
+	hasKnownSyncPoint = !shapeDefinitionError && triggerShapeSynchPointIndex != EFI_ERROR_CODE;
+	knownSyncFingerprint = fingerprint;
+	knownSyncPointIndex = triggerShapeSynchPointIndex;
 }
 
 void TriggerFormDetails::prepareEventAngles(TriggerWaveform *shape) {
@@ -622,9 +673,7 @@ expected<TriggerDecodeResult> TriggerDecoderBase::decodeTriggerEvent(
 			nextTriggerEvent();
 		}
 
-		for (int i = triggerShape.gapTrackingLength; i > 0; i--) {
-			toothDurations[i] = toothDurations[i - 1];
-		}
+		toothDurations.advance();
 
 		toothed_previous_time = nowNt;
 
@@ -700,29 +749,25 @@ bool TriggerDecoderBase::isSyncPoint(const TriggerWaveform& triggerShape, trigge
 		return triggerSyncGapRatio < secondGap;
 	}
 
+	// This is transformed to avoid a division and float math
+	// toothDurations[i] / toothDurations[i+1] > from
+	// is an equivalent comparison to
+	// toothDurations[i] << 16 > toothDurations[i+1] * fromQ16
+	// and there is no early exit: every tracked gap is evaluated, failures are collected as bits
+	// and gaps we do not check are masked out in the end.
+	uint32_t failedGaps = 0;
 	for (int i = 0; i < triggerShape.gapTrackingLength; i++) {
-		auto from = triggerShape.synchronizationRatioFrom[i];
-		auto to = triggerShape.synchronizationRatioTo[i];
-
-		if (std::isnan(from)) {
-			// don't check this gap, skip it
-			continue;
-		}
+		uint64_t current = (uint64_t)toothDurations[i] << SYNC_GAP_RATIO_SHIFT;
+		uint64_t previous = toothDurations[i + 1];
 
-		// This is transformed to avoid a division and use a cheaper multiply instead
-		// toothDurations[i] / toothDurations[i+1] > from
-		// is an equivalent comparison to
-		// toothDurations[i] > toothDurations[i+1] * from
 		bool isGapCondition =
-			  (toothDurations[i] > toothDurations[i + 1] * from
-			&& toothDurations[i] < toothDurations[i + 1] * to);
+			  (current > previous * triggerShape.syncGapRatioFromQ[i])
+			& (current < previous * triggerShape.syncGapRatioToQ[i]);
 
-		if (!isGapCondition) {
-			return false;
-		}
+		failedGaps |= (uint32_t)!isGapCondition << i;
 	}
 
-	return true;
+	return (failedGaps & triggerShape.syncGapCheckMask) == 0;
 }
 
 /**
@@ -79,6 +79,44 @@ struct TriggerDecodeResult {
 	uint32_t CurrentIndex;
 };
 
+/**
+ * Tooth duration history: index zero is the current tooth and previous durations are following.
+ * Moving to the next tooth only moves the head, so the cost per edge does not depend on gap tracking length.
+ */
+class ToothDurations {
+public:
+	uint32_t& operator[](size_t age) {
+		return m_durations[(m_head + age) & DURATION_MASK];
+	}
+
+	uint32_t operator[](size_t age) const {
+		return m_durations[(m_head + age) & DURATION_MASK];
+	}
+
+	/**
+	 * current duration becomes previous one; until overwritten, current duration reads the same value
+	 */
+	void advance() {
+		uint32_t current = m_durations[m_head];
+		m_head = (m_head - 1) & DURATION_MASK;
+		m_durations[m_head] = current;
+	}
+
+	void reset() {
+		setArrayValues(m_durations, 0);
+		m_head = 0;
+	}
+
+private:
+	// power of two to wrap with a mask
+	static constexpr size_t DURATION_COUNT = 32;
+	static constexpr size_t DURATION_MASK = DURATION_COUNT - 1;
+	static_assert(DURATION_COUNT >= GAP_TRACKING_LENGTH + 1, "need current and each tracked gap previous duration");
+
+	uint32_t m_durations[DURATION_COUNT];
+	size_t m_head = 0;
+};
+
 /**
  * @see TriggerWaveform for trigger wheel shape definition
  */
@@ -135,7 +173,7 @@ public:
 	/**
 	 * current duration at index zero and previous durations are following
 	 */
-	uint32_t toothDurations[GAP_TRACKING_LENGTH + 1];
+	ToothDurations toothDurations;
 
 	efitick_t toothed_previous_time;
 
@@ -242,3 +280,22 @@ public:
 };
 
 angle_t getEngineCycle(operation_mode_e operationMode);
+
+/**
+ * Sync point of a built-in trigger shape as found by trigger simulation, see trigger_sync_points_generated.h
+ */
+struct BakedTriggerSyncPoint {
+	trigger_type_e type;
+	uint32_t fingerprint;
+	uint16_t syncIndex;
+};
+
+/**
+ * @return sync point index or -1 if this exact shape was not baked
+ */
+int findBakedTriggerSyncPoint(trigger_type_e type, uint32_t fingerprint);
+
+#if EFI_UNIT_TEST
+// unit tests default to trigger simulation since some look at 'initState' it leaves behind
+extern bool useBakedTriggerSyncPoints;
+#endif
@@ -0,0 +1,116 @@
+//
+// was generated automatically by rusEFI unit tests, see trigger_sync_points.cpp
+// run 'make trigger_sync_points' in unit_tests after changing trigger shapes
+//
+// trigger type, shape fingerprint, sync point index
+//
+
+#pragma once
+
+#define BAKED_TRIGGER_SYNC_POINTS \
+	{ trigger_type_e::TT_FORD_ASPIRE, 0x6f7bef3f, 4 }, \
+	{ trigger_type_e::TT_DODGE_NEON_1995, 0x602ed7a4, 0 }, \
+	{ trigger_type_e::TT_MAZDA_MIATA_NA, 0x7d2ab442, 4 }, \
+	{ trigger_type_e::TT_VVT_FORD_COYOTE, 0x8a4a920c, 12 }, \
+	{ trigger_type_e::TT_GM_7X, 0x23d21284, 0 }, \
+	{ trigger_type_e::TT_DAIHATSU_3_CYL, 0x95b3ad0e, 0 }, \
+	{ trigger_type_e::TT_MAZDA_SOHC_4, 0xc6dd95fb, 0 }, \
+	{ trigger_type_e::TT_TOOTHED_WHEEL_60_2, 0x0416af04, 0 }, \
+	{ trigger_type_e::TT_TOOTHED_WHEEL_60_2, 0xb4c4080b, 0 }, \
+	{ trigger_type_e::TT_TOOTHED_WHEEL_36_1, 0xd5fdd69a, 0 }, \
+	{ trigger_type_e::TT_TOOTHED_WHEEL_36_1, 0x7617a595, 0 }, \
+	{ trigger_type_e::TT_MERCEDES_2_SEGMENT, 0xf6253b06, 0 }, \
+	{ trigger_type_e::TT_NARROW_SINGLE_TOOTH, 0x63ff2870, 0 }, \
+	{ trigger_type_e::TT_NARROW_SINGLE_TOOTH, 0x4f70bab3, 0 }, \
+	{ trigger_type_e::TT_SUBARU_EZ30, 0x9975280a, 1 }, \
+	{ trigger_type_e::TT_VVT_MAZDA_SKYACTIV, 0x0aa518b4, 2 }, \
+	{ trigger_type_e::TT_DODGE_NEON_2003_CAM, 0x629e2f7e, 6 }, \
+	{ trigger_type_e::TT_MAZDA_DOHC_1_4, 0x1d4e7c9e, 0 }, \
+	{ trigger_type_e::TT_ONE_PLUS_ONE, 0x91e2c41c, 0 }, \
+	{ trigger_type_e::TT_VVT_TOYOTA_3_TOOTH, 0x246cd4ba, 0 }, \
+	{ trigger_type_e::TT_VVT_TOYOTA_3_TOOTH, 0x6ced6e65, 0 }, \
+	{ trigger_type_e::TT_HALF_MOON, 0xfca7194e, 0 }, \
+	{ trigger_type_e::TT_HALF_MOON, 0x85129ca5, 0 }, \
+	{ trigger_type_e::TT_DODGE_RAM, 0x2fb35c7f, 16 }, \
+	{ trigger_type_e::TT_60_2_WRONG_POLARITY, 0x5f143f1f, 114 }, \
+	{ trigger_type_e::TT_BENELLI_TRE, 0xa1f21219, 0 }, \
+	{ trigger_type_e::TT_DODGE_STRATUS, 0x12d9774a, 0 }, \
+	{ trigger_type_e::TT_36_2_2_2, 0xc764e2e7, 1 }, \
+	{ trigger_type_e::TT_NISSAN_SR20VE, 0x3148516e, 2 }, \
+	{ trigger_type_e::TT_2JZ_3_34_SIMULATION_ONLY, 0xcb22df44, 0 }, \
+	{ trigger_type_e::TT_ROVER_K, 0x2a1a5bfa, 8 }, \
+	{ trigger_type_e::TT_GM_24x_5, 0x79372546, 40 }, \
+	{ trigger_type_e::TT_HONDA_CBR_600, 0x4fe36141, 0 }, \
+	{ trigger_type_e::TT_NISSAN_K11, 0xcbc9f4a4, 2 }, \
+	{ trigger_type_e::TT_CHRYSLER_NGC_36_2_2, 0x1a0531de, 30 }, \
+	{ trigger_type_e::TT_3_1_CAM, 0x87ef81c1, 0 }, \
+	{ trigger_type_e::TT_DODGE_NEON_2003_CRANK, 0xce3944cd, 33 }, \
+	{ trigger_type_e::TT_MIATA_VVT, 0x590f059c, 3 }, \
+	{ trigger_type_e::TT_MITSU_4G63_CAM, 0x90b58435, 0 }, \
+	{ trigger_type_e::TT_MAZDA_MIATA_VVT_TEST, 0x332f699e, 12 }, \
+	{ trigger_type_e::TT_SUBARU_7_6, 0x6fc5cf6c, 28 }, \
+	{ trigger_type_e::TT_JEEP_18_2_2_2, 0xcfb535e3, 24 }, \
+	{ trigger_type_e::TT_12_TOOTH_CRANK, 0x91ef6e85, 1 }, \
+	{ trigger_type_e::TT_UNUSED_39, 0xdc666bc1, 0 }, \
+	{ trigger_type_e::TT_JEEP_4_CYL, 0xf53012a0, 16 }, \
+	{ trigger_type_e::TT_FIAT_IAW_P8, 0xa1cdc96d, 0 }, \
+	{ trigger_type_e::TT_FORD_ST170, 0xa29c6c53, 4 }, \
+	{ trigger_type_e::TT_VVT_MIATA_NB, 0x2d254ff1, 1 }, \
+	{ trigger_type_e::TT_RENIX_44_2_2, 0x098692b6, 40 }, \
+	{ trigger_type_e::TT_RENIX_66_2_2_2, 0xa0e7f166, 40 }, \
+	{ trigger_type_e::TT_HONDA_K_CRANK_12_1, 0x4ff35d45, 2 }, \
+	{ trigger_type_e::TT_VVT_BOSCH_QUICK_START, 0x80c0e0f6, 1 }, \
+	{ trigger_type_e::TT_TOOTHED_WHEEL_36_2, 0x6f2cdab4, 0 }, \
+	{ trigger_type_e::TT_TOOTHED_WHEEL_36_2, 0xb9ef4007, 0 }, \
+	{ trigger_type_e::TT_SUBARU_SVX, 0x7e674d93, 11 }, \
+	{ trigger_type_e::TT_SUZUKI_K6A, 0xb4e5a05d, 13 }, \
+	{ trigger_type_e::TT_VVT_SUBARU_7_WITHOUT_6, 0x26cf4008, 6 }, \
+	{ trigger_type_e::TT_NISSAN_MR18_CAM_VVT, 0xd5dbe407, 0 }, \
+	{ trigger_type_e::TT_TRI_TACH, 0x05dd69c2, 0 }, \
+	{ trigger_type_e::TT_GM_60_2_2_2, 0xc6ba7ac1, 106 }, \
+	{ trigger_type_e::TT_SKODA_FAVORIT, 0xeacb2d51, 4 }, \
+	{ trigger_type_e::TT_VVT_BARRA_3_PLUS_1, 0xfffdbdd7, 4 }, \
+	{ trigger_type_e::TT_KAWA_KX450F, 0xf980ded5, 0 }, \
+	{ trigger_type_e::TT_NISSAN_VQ35, 0x430018db, 2 }, \
+	{ trigger_type_e::TT_VVT_NISSAN_VQ35, 0x3f7eba5d, 10 }, \
+	{ trigger_type_e::TT_NISSAN_VQ30, 0xe7aee284, 0 }, \
+	{ trigger_type_e::TT_NISSAN_QR25, 0x5c5fa705, 2 }, \
+	{ trigger_type_e::TT_VVT_MITSUBISHI_3A92, 0xb657c5c5, 4 }, \
+	{ trigger_type_e::TT_SUBARU_SVX_CRANK_1, 0x0e657f31, 11 }, \
+	{ trigger_type_e::TT_SUBARU_SVX_CAM_VVT, 0x3b5a0afa, 11 }, \
+	{ trigger_type_e::TT_FORD_TFI_PIP, 0x43bf358c, 2 }, \
+	{ trigger_type_e::TT_SUZUKI_G13B, 0xe363317d, 2 }, \
+	{ trigger_type_e::TT_HONDA_K_CAM_4_1, 0xc86b3093, 0 }, \
+	{ trigger_type_e::TT_NISSAN_MR18_CRANK, 0xc27cccd7, 2 }, \
+	{ trigger_type_e::TT_TOOTHED_WHEEL_32_2, 0x42e1b461, 0 }, \
+	{ trigger_type_e::TT_TOOTHED_WHEEL_32_2, 0x44172d46, 0 }, \
+	{ trigger_type_e::TT_36_2_1, 0x40db25da, 32 }, \
+	{ trigger_type_e::TT_36_2_1_1, 0x71ab1e95, 0 }, \
+	{ trigger_type_e::TT_3_TOOTH_CRANK, 0x86fc1cfc, 1 }, \
+	{ trigger_type_e::TT_VVT_TOYOTA_4_1, 0x66ecd27f, 0 }, \
+	{ trigger_type_e::TT_VVT_TOYOTA_4_1, 0x7d911f10, 0 }, \
+	{ trigger_type_e::TT_GM_24x_3, 0xfd804ce6, 40 }, \
+	{ trigger_type_e::TT_60_2_2_F3R, 0x53787cfc, 2 }, \
+	{ trigger_type_e::TT_MITSU_4G63_CRANK, 0xcac9a196, 0 }, \
+	{ trigger_type_e::TT_60DEG_TOOTH, 0xa4cf0d7d, 0 }, \
+	{ trigger_type_e::TT_VVT_MITSUBISHI_4G69, 0xfb8df8e0, 0 }, \
+	{ trigger_type_e::TT_VVT_MITSU_6G72, 0x151a3a0c, 7 }, \
+	{ trigger_type_e::TT_6_TOOTH_CRANK, 0xaf9d0dc2, 1 }, \
+	{ trigger_type_e::TT_DAIHATSU_4_CYL, 0x549a92d1, 0 }, \
+	{ trigger_type_e::TT_VVT_MAZDA_L, 0x626bc0dc, 6 }, \
+	{ trigger_type_e::TT_DEV, 0x482fa3ef, 12 }, \
+	{ trigger_type_e::TT_NISSAN_HR, 0xb80e217f, 19 }, \
+	{ trigger_type_e::TT_ARCTIC_CAT, 0xb80fd9ce, 22 }, \
+	{ trigger_type_e::TT_NISSAN_HR_CAM_IN, 0x694aa932, 2 }, \
+	{ trigger_type_e::TT_HONDA_J30A2_24_1_1, 0x1ef605c6, 13 }, \
+	{ trigger_type_e::TT_CUSTOM_1, 0xefb663f0, 0 }, \
+	{ trigger_type_e::TT_CUSTOM_1, 0x813e0fb3, 0 }, \
+	{ trigger_type_e::TT_CUSTOM_2, 0x722e6f6d, 0 }, \
+	{ trigger_type_e::TT_CUSTOM_2, 0x77913e56, 0 }, \
+	{ trigger_type_e::TT_CHRYSLER_PHASER, 0xee92bb2b, 20 }, \
+	{ trigger_type_e::TT_JEEP_EVD_36_2_2, 0xf89ba599, 36 }, \
+	{ trigger_type_e::TT_JEEPRENIX_66_2_2_2, 0x1a0dc599, 2 }, \
+	{ trigger_type_e::TT_SUBARU_7_6_CRANK, 0xa1fbc4db, 2 }, \
+	{ trigger_type_e::TT_SUZUKI_G16B, 0x504ee4f2, 14 }, \
+	{ trigger_type_e::TT_UNUSED_96, 0xbe9ba991, 2 }, \
+
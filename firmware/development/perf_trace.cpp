@@ -133,6 +133,61 @@ void perfTraceEnable() {
 	s_isTracing = true;
 }
 
+uint32_t perfTraceGetTimestamp() {
+#if EFI_PROD_CODE
+	return port_rt_get_counter_value();
+#else
+	return 0;
+#endif // EFI_PROD_CODE
+}
+
+// zero initialized entry is a valid empty one
+static PerfStatsEntry s_stats[static_cast<size_t>(PE::Count)];
+
+void perfStatsRecord(PE event, uint32_t ticks) {
+	size_t idx = static_cast<size_t>(event);
+	if (idx >= efi::size(s_stats)) {
+		return;
+	}
+
+#if EFI_PROD_CODE
+	// Same event could be recorded from both thread and ISR, and we can't use
+	// chSysLock here for the same reasons as perfEventImpl
+	uint32_t prim = __get_PRIMASK();
+	__disable_irq();
+#endif // EFI_PROD_CODE
+
+	s_stats[idx].record(ticks);
+
+#if EFI_PROD_CODE
+	if (!prim) {
+		__enable_irq();
+	}
+#endif // EFI_PROD_CODE
+}
+
+void perfStatsReset() {
+	for (size_t i = 0; i < efi::size(s_stats); i++) {
+#if EFI_PROD_CODE
+		// chSysLock would leave zero-latency ISRs free to record into a half reset entry
+		uint32_t prim = __get_PRIMASK();
+		__disable_irq();
+#endif // EFI_PROD_CODE
+
+		s_stats[i].reset();
+
+#if EFI_PROD_CODE
+		if (!prim) {
+			__enable_irq();
+		}
+#endif // EFI_PROD_CODE
+	}
+}
+
+const PerfStatsEntry* perfStatsGet() {
+	return s_stats;
+}
+
 const BigBufferHandle perfTraceGetBuffer() {
 	// stop tracing if you try to get the buffer early
 	stopTrace();
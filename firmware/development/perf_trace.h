@@ -92,8 +92,56 @@ enum class PE : uint8_t {
 	// enum_end_tag
 	// The tag above is consumed by PerfTraceTool.java
 	// please note that the tool requires a comma at the end of last value
+
+	// not an event: number of PE values, keep last
+	Count,
 };
 
+// Histogram bucket 0 counts everything shorter than 2^PERF_STATS_FIRST_BUCKET_LOG2 ticks,
+// each following bucket covers twice the range of the previous one, last bucket is open ended
+#define PERF_STATS_BUCKET_COUNT 12
+#define PERF_STATS_FIRST_BUCKET_LOG2 6
+
+// Always-on duration statistics of one PE interval, in CPU cycle counter ticks.
+// Binary layout is sent as is by TS_PERF_STATS_GET_BUFFER
+struct PerfStatsEntry {
+	uint32_t count;
+	uint32_t minTicks;
+	uint32_t maxTicks;
+	uint32_t histogram[PERF_STATS_BUCKET_COUNT];
+
+	void reset() {
+		count = 0;
+		minTicks = 0;
+		maxTicks = 0;
+		for (size_t i = 0; i < PERF_STATS_BUCKET_COUNT; i++) {
+			histogram[i] = 0;
+		}
+	}
+
+	void record(uint32_t ticks) {
+		if (count == 0 || ticks < minTicks) {
+			minTicks = ticks;
+		}
+		if (ticks > maxTicks) {
+			maxTicks = ticks;
+		}
+		count++;
+		histogram[getBucket(ticks)]++;
+	}
+
+	static size_t getBucket(uint32_t ticks) {
+		if (ticks < (1 << PERF_STATS_FIRST_BUCKET_LOG2)) {
+			return 0;
+		}
+		size_t log2 = 31 - __builtin_clz(ticks);
+		size_t bucket = log2 - PERF_STATS_FIRST_BUCKET_LOG2 + 1;
+		return bucket < PERF_STATS_BUCKET_COUNT ? bucket : PERF_STATS_BUCKET_COUNT - 1;
+	}
+};
+
+static_assert(sizeof(PerfStatsEntry) == 12 + 4 * PERF_STATS_BUCKET_COUNT);
+
 void perfEventBegin(PE event);
 void perfEventEnd(PE event);
 void perfEventInstantGlobal(PE event);
@@ -104,21 +152,33 @@ void perfTraceEnable();
 // Retrieve the trace buffer
 const BigBufferHandle perfTraceGetBuffer();
 
+// CPU cycle counter, zero where not available
+uint32_t perfTraceGetTimestamp();
+
+// Add one begin -> end interval of given duration to the statistics of the event
+void perfStatsRecord(PE event, uint32_t ticks);
+void perfStatsReset();
+// Statistics of all events indexed by PE value, static_cast<size_t>(PE::Count) entries
+const PerfStatsEntry* perfStatsGet();
+
 #if ENABLE_PERF_TRACE
 class ScopePerf
 {
 public:
 	ScopePerf(PE event) : m_event(event) {
 		perfEventBegin(event);
+		m_start = perfTraceGetTimestamp();
 	}
 
 	~ScopePerf()
 	{
+		perfStatsRecord(m_event, perfTraceGetTimestamp() - m_start);
 		perfEventEnd(m_event);
 	}
 
 private:
 	const PE m_event;
+	uint32_t m_start;
 };
 
 #else /* if ENABLE_PERF_TRACE */
@@ -89,6 +89,16 @@ expected<float> adcGetRawVoltage(const char *msg, adc_channel_e hwChannel) {
 	return unexpected;
 }
 
+void adcGetRawVoltages(const adc_channel_e* hwChannels, size_t count, float* volts, uint8_t* valid) {
+	// same as adcGetRawVoltage, with Vcc scaling looked up once for all channels
+	float voltsPerCount = engineConfiguration->adcVcc / ADC_MAX_VALUE;
+
+	for (size_t i = 0; i < count; i++) {
+		volts[i] = voltsPerCount * adcGetRawValue("sensor", hwChannels[i]);
+		valid[i] = boardGetAnalogInputDiagnostic(hwChannels[i], volts[i]) == 0;
+	}
+}
+
 // voltage in ECU universe, with all input dividers and OpAmps gains taken into account, voltage at ECU connector pin
 expected<float> adcGetScaledVoltage(const char *msg, adc_channel_e hwChannel) {
 	auto rawVoltage = adcGetRawVoltage(msg, hwChannel);
@@ -190,6 +200,9 @@ void adcInputsUpdateSubscribers(efitick_t nowNt) {
 
 		protectedGpio_check(nowNt);
 	}
+
+	// everything derived from this ADC cycle is in, make it visible as one consistent set
+	Sensor::publishSnapshot();
 }
 
 void addFastAdcChannel(const char*, adc_channel_e hwChannel) {
@@ -280,6 +293,13 @@ __attribute__((weak)) expected<float> adcGetRawVoltage(const char*, adc_channel_
 	return expected(0.0f);
 }
 
+__attribute__((weak)) void adcGetRawVoltages(const adc_channel_e*, size_t count, float* volts, uint8_t* valid) {
+	for (size_t i = 0; i < count; i++) {
+		volts[i] = 0;
+		valid[i] = true;
+	}
+}
+
 // voltage in ECU universe, with all input dividers and OpAmps gains taken into account, voltage at ECU connector pin
 __attribute__((weak)) expected<float> adcGetScaledVoltage(const char*, adc_channel_e) {
 	return expected(0.0f);
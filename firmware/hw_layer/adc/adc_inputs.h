@@ -113,6 +113,7 @@ AdcToken enableFastAdcChannel(const char* msg, adc_channel_e channel);
 adcsample_t getFastAdc(AdcToken token);
 const ADCConversionGroup* getKnockConversionGroup(uint8_t channelIdx);
 void onKnockSamplingComplete();
+void onKnockSamplingError();
 
 // Slow ADC stuff
 float getMCUInternalTemperature(void);
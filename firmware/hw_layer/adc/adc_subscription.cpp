@@ -16,7 +16,57 @@
 
 #else
 
-static AdcSubscriptionEntry s_entries[16];
+#include "biquad_bank.h"
+
+static constexpr size_t subscriptionCount = 16;
+
+static AdcSubscriptionEntry s_entries[subscriptionCount];
+
+/**
+ * Active subscriptions packed as structure of arrays, so that each tick reads all channels in one
+ * pass and filters all of them in one go without walking empty entries.
+ * Rebuilt by the update thread on the first tick after any subscription change.
+ */
+static struct {
+	size_t count;
+	uint8_t entryIndex[subscriptionCount];
+	adc_channel_e channel[subscriptionCount];
+	float voltsPerAdcVolt[subscriptionCount];
+	FunctionalSensorBase* sensor[subscriptionCount];
+	BiquadBank<subscriptionCount> filters;
+} s_active;
+
+static volatile bool s_activeNeedsRebuild = false;
+
+static void rebuildActive() {
+	// clear request first, a subscription changed while we rebuild would request another rebuild
+	s_activeNeedsRebuild = false;
+
+	// keep filter state of lanes which stay subscribed
+	for (size_t lane = 0; lane < s_active.count; lane++) {
+		s_active.filters.storeState(lane, s_entries[s_active.entryIndex[lane]].Filter);
+	}
+
+	s_active.count = 0;
+	s_active.filters.clear();
+
+	for (size_t i = 0; i < efi::size(s_entries); i++) {
+		auto& entry = s_entries[i];
+		FunctionalSensorBase* sensor = entry.Sensor;
+
+		if (!sensor) {
+			// Skip unconfigured entries
+			continue;
+		}
+
+		size_t lane = s_active.count++;
+		s_active.entryIndex[lane] = i;
+		s_active.channel[lane] = entry.Channel;
+		s_active.voltsPerAdcVolt[lane] = entry.VoltsPerAdcVolt;
+		s_active.sensor[lane] = sensor;
+		s_active.filters.add(entry.Filter);
+	}
+}
 
 static AdcSubscriptionEntry* findEntry(FunctionalSensorBase* sensor) {
 	for (size_t i = 0; i < efi::size(s_entries); i++) {
@@ -96,6 +146,7 @@ TODO: this code is similar to initIfValid, what is the plan? shall we extract he
 
 	// Set the sensor last - it's the field we use to determine whether this entry is in use
 	entry->Sensor = &sensor;
+	s_activeNeedsRebuild = true;
 	return entry;
 }
 
@@ -119,6 +170,7 @@ TODO: this code is similar to initIfValid, what is the plan? shall we extract he
 
 	entry->VoltsPerAdcVolt = 0;
 	entry->Channel = EFI_ADC_NONE;
+	s_activeNeedsRebuild = true;
 }
 
 /*static*/ void AdcSubscription::UnsubscribeSensor(FunctionalSensorBase& sensor, adc_channel_e channel) {
@@ -141,31 +193,44 @@ void AdcSubscription::ResetFilters() {
 void AdcSubscription::UpdateSubscribers(efitick_t nowNt) {
 	ScopePerf perf(PE::AdcSubscriptionUpdateSubscribers);
 
-	for (size_t i = 0; i < efi::size(s_entries); i++) {
-		auto &entry = s_entries[i];
+	if (s_activeNeedsRebuild) {
+		rebuildActive();
+	}
 
-		if (!entry.Sensor) {
-			// Skip unconfigured entries
-			continue;
-		}
+	size_t count = s_active.count;
+	// filter bank runs all lanes, keep the unused ones at zero
+	float volts[subscriptionCount] = {};
+	uint8_t valid[subscriptionCount] = {};
+	float filtered[subscriptionCount];
 
-		auto mcuVolts = adcGetRawVoltage("sensor", entry.Channel);
-		if (mcuVolts) {
-			entry.sensorVolts = mcuVolts.value_or(0) * entry.VoltsPerAdcVolt;
+	adcGetRawVoltages(s_active.channel, count, volts, valid);
+
+	for (size_t lane = 0; lane < count; lane++) {
+		volts[lane] *= s_active.voltsPerAdcVolt[lane];
+	}
+
+	for (size_t lane = 0; lane < count; lane++) {
+		auto& entry = s_entries[s_active.entryIndex[lane]];
+
+		if (valid[lane]) {
+			entry.sensorVolts = volts[lane];
 
 			// On the very first update, preload the filter as if we've been
 			// seeing this value for a long time.  This prevents a slow ramp-up
 			// towards the correct value just after startup
 			if (!entry.HasUpdated) {
-				entry.Filter.cookSteadyState(entry.sensorVolts);
+				s_active.filters.cookSteadyState(lane, volts[lane]);
 				entry.HasUpdated = true;
 			}
+		}
+	}
 
-			float filtered = entry.Filter.filter(entry.sensorVolts);
-
-			entry.Sensor->postRawValue(filtered, nowNt);
-		} else {
+	// invalid lanes keep their filter state and are not posted
+	s_active.filters.filter(volts, valid, filtered);
 
+	for (size_t lane = 0; lane < count; lane++) {
+		if (valid[lane]) {
+			s_active.sensor[lane]->postRawValue(filtered[lane], nowNt);
 		}
 	}
 }
@@ -24,6 +24,9 @@
 // voltage in MCU universe, from zero to Vref
 expected<float> adcGetRawVoltage(const char *msg, adc_channel_e channel);
 
+// adcGetRawVoltage for many channels in one pass, valid[i] is zero where adcGetRawVoltage would be unexpected
+void adcGetRawVoltages(const adc_channel_e* channels, size_t count, float* volts, uint8_t* valid);
+
 // voltage in ECU universe, with all input dividers and OpAmps gains taken into account, voltage at ECU connector pin
 expected<float> adcGetScaledVoltage(const char *msg, adc_channel_e channel);
 
@@ -19,6 +19,7 @@
 #include "can.h"
 #include "can_hw.h"
 #include "can_msg_tx.h"
+#include "can_hw_filter.h"
 #include "string.h"
 #include "mpu_util.h"
 
@@ -56,8 +57,25 @@ public:
 		}
 	}
 
+#if EFI_CAN_HW_FILTERS
+	// consumers were registered or removed: frames for a new consumer must not be dropped
+	void onHwFiltersChanged() {
+		m_filtersDirty = true;
+		if (m_device) {
+			updateHwFilters();
+		}
+	}
+#endif // EFI_CAN_HW_FILTERS
+
 	void ThreadTask() override {
 		while (true) {
+#if EFI_CAN_HW_FILTERS
+			// configuration changes do not register anything, catch up with these periodically
+			if (m_filtersDirty || m_filterTimer.hasElapsedSec(1)) {
+				updateHwFilters();
+			}
+#endif // EFI_CAN_HW_FILTERS
+
 			// Block until we get a message
 			msg_t result = canReceiveTimeout(m_device, CAN_ANY_MAILBOX, &m_buffer, CAN_RX_TIMEOUT);
 
@@ -74,9 +92,45 @@ public:
 	}
 
 private:
+#if EFI_CAN_HW_FILTERS
+	// Runs on RX thread and on whatever thread registers a consumer, only touches the hardware
+	// when the wanted set has changed
+	void updateHwFilters() {
+		chibios_rt::MutexLocker lock(m_filterMutex);
+		m_filtersDirty = false;
+		m_filterTimer.reset();
+
+		size_t filterCount = canHwGetFilterCount(m_device);
+		if (filterCount < 2) {
+			// not supported, driver default accepts everything
+			return;
+		}
+
+		m_filters.reset(m_index);
+		collectCanHwFilters(m_filters);
+
+		if (m_hasProgrammedFilters && m_filters.getChecksum() == m_programmedChecksum) {
+			return;
+		}
+
+		m_filters.reduce(filterCount);
+		canHwSetFilters(m_device, m_filters.get(), m_filters.size());
+
+		m_programmedChecksum = m_filters.getChecksum();
+		m_hasProgrammedFilters = true;
+	}
+
+	chibios_rt::Mutex m_filterMutex;
+	Timer m_filterTimer;
+	volatile bool m_filtersDirty = true;
+	CanHwFilterSet m_filters;
+	uint32_t m_programmedChecksum = 0;
+	bool m_hasProgrammedFilters = false;
+#endif // EFI_CAN_HW_FILTERS
+
 	const size_t m_index;
 	CANRxFrame m_buffer;
-	CANDriver* m_device;
+	CANDriver* m_device = nullptr;
 };
 
 CCM_OPTIONAL static CanRead canRead1(0);
@@ -86,6 +140,16 @@ CCM_OPTIONAL static CanRead canRead3(2);
 #endif
 static CanWrite canWrite CCM_OPTIONAL;
 
+void canHwFiltersChanged() {
+#if EFI_CAN_HW_FILTERS
+	canRead1.onHwFiltersChanged();
+	canRead2.onHwFiltersChanged();
+#if (EFI_CAN_BUS_COUNT >= 3)
+	canRead3.onHwFiltersChanged();
+#endif
+#endif // EFI_CAN_HW_FILTERS
+}
+
 #if EFI_PROD_CODE
 static CANDriver* getCanDevice(size_t index)
 {
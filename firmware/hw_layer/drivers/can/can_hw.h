@@ -18,5 +18,7 @@ void setCanVss(int type);
 void stopCanPins();
 void startCanPins();
 bool getIsCanEnabled(void);
+// CAN consumers changed, reprogram hardware acceptance filters now
+void canHwFiltersChanged();
 
 #endif /* EFI_CAN_SUPPORT */
@@ -178,6 +178,7 @@ public:
 
 	CanListener* request() override;
 	bool acceptFrame(const size_t busIndex, const CANRxFrame& frame) const override;
+	void addHwFilters(CanHwFilterSet& filters) const override;
 
 	int init() override;
 	int config(uint32_t bus, uint32_t base, uint16_t period);
@@ -242,11 +243,11 @@ private:
 };
 
 MsIoBox::MsIoBox()
-	: CanListener(0), m_bus(0), m_base(0), m_period(20) {
+	: CanListener(anyId), m_bus(0), m_base(0), m_period(20) {
 }
 
 MsIoBox::MsIoBox(uint32_t bus, uint32_t base, uint16_t period)
-	: CanListener(0), m_bus(bus), m_base(base), m_period(period) {
+	: CanListener(anyId), m_bus(bus), m_base(base), m_period(period) {
 	/* init state */
 	state = MSIOBOX_WAIT_INIT;
 	stateTimer.reset();
@@ -295,6 +296,13 @@ bool MsIoBox::acceptFrame(const size_t busIndex, const CANRxFrame& frame) const
 	return false;
 }
 
+void MsIoBox::addHwFilters(CanHwFilterSet& filters) const {
+	/* same as acceptFrame: (base + 8) to (base + 14) */
+	for (uint32_t id = m_base + 8; id <= m_base + 14; id++) {
+		filters.addStandard(CanHwFilterSet::anyBus, id);
+	}
+}
+
 /* Ping iobox */
 int MsIoBox::ping() {
 	CanTxTyped<iobox_ping> frame(CanCategory::CAN_IOBOX, m_base + CAN_IOBOX_PING, false, 0);
@@ -20,6 +20,17 @@
 /* Local definitions.														*/
 /*==========================================================================*/
 
+/**
+ * Deepest update() path is TLE9104 re-init after chip reset:
+ * update() -> updateStatus() -> chip_init() -> updateDiagState() -> read_reg() -> spi_rw()
+ * -> spiAcquireBus()/spiStart()/spiPolledExchange(). Six driver frames plus ChibiOS mutex and
+ * SPI/DMA start are estimated at about 250 bytes with -O2, interrupt context is on top of that
+ * (PORT_INT_REQUIRED_STACK). Twice that keeps room for a new driver or debug build.
+ */
+#ifndef GPIOCHIPS_THREAD_STACK_SIZE
+#define GPIOCHIPS_THREAD_STACK_SIZE 512
+#endif
+
 /*==========================================================================*/
 /* Exported variables.														*/
 /*==========================================================================*/
@@ -36,10 +47,22 @@ struct gpiochip {
 	const char			*name;
 	/* optional names of each gpio */
 	const char			**gpio_names;
+	/* last call to update() from shared gpiochips thread */
+	efitick_t			last_update_nt;
 };
 
 static gpiochip chips[BOARD_EXT_GPIOCHIPS];
 
+/* index + 1 of the chip each external pin belongs to, 0 if none */
+static uint8_t chip_by_pin[BRAIN_PIN_LAST - BRAIN_PIN_ONCHIP_LAST];
+static_assert(BOARD_EXT_GPIOCHIPS < 0xff);
+
+#if EFI_PROD_CODE
+/* wakes shared gpiochips thread, see gpiochips_requestUpdate() */
+static BSEMAPHORE_DECL(gpiochips_wake, true);
+static THD_WORKING_AREA(gpiochips_thread_wa, GPIOCHIPS_THREAD_STACK_SIZE);
+#endif
+
 #if EFI_PROD_CODE
 
 /* TODO: move inside gpio chip driver? */
@@ -95,14 +118,21 @@ static external_hardware_pwm extPwms[5];
  */
 static gpiochip *gpiochip_find(brain_pin_e pin)
 {
-	for (int i = 0; i < BOARD_EXT_GPIOCHIPS; i++) {
-		gpiochip *chip = &chips[i];
+	if ((pin <= BRAIN_PIN_ONCHIP_LAST) || (pin > BRAIN_PIN_LAST))
+		return nullptr;
 
-		if ((pin >= chip->base) && (pin < (chip->base + chip->size)))
-			return chip;
-	}
+	uint8_t index = chip_by_pin[pin - BRAIN_PIN_ONCHIP_LAST - 1];
 
-	return nullptr;
+	return index ? &chips[index - 1] : nullptr;
+}
+
+/**
+ * @brief Point pins of chip to given chips[] index + 1, 0 to forget them
+ */
+static void gpiochip_mapPins(const gpiochip *chip, uint8_t value)
+{
+	for (size_t i = 0; i < chip->size; i++)
+		chip_by_pin[(chip->base + i) - BRAIN_PIN_ONCHIP_LAST - 1] = value;
 }
 
 #if EFI_PROD_CODE
@@ -120,6 +150,38 @@ static external_hardware_pwm* gpiochip_getNextPwmDevice() {
 
 #endif
 
+#if EFI_PROD_CODE
+
+/**
+ * @brief Shared thread for chips with update_interval_ms set
+ * @details Pad writes only change shadow registers of a chip and request an update, so all writes
+ * since last pass go out with one exchange per chip, together with diagnostic readout.
+ * Chips are not batched per SPI bus: each update() still acquires the bus and does its own polled
+ * exchange, no DMA chaining across chips. Only TLE6240, DRV8860 and TLE9104 are served here,
+ * TLE8888, MC33810 and L9779 keep their own threads for their state machines and watchdogs.
+ */
+static THD_FUNCTION(gpiochips_thread, p)
+{
+	(void)p;
+
+	chRegSetThreadName("gpiochips");
+
+	while (1) {
+		efidur_t next_poll = gpiochips_update(getTimeNowNt());
+
+#if CH_DBG_THREADS_PROFILING && CH_DBG_FILL_THREADS
+		/* high-water mark of all update() calls so far, see GPIOCHIPS_THREAD_STACK_SIZE */
+		if (CountFreeStackSpace(gpiochips_thread_wa) < EXPECTED_REMAINING_STACK) {
+			firmwareError(ObdCode::STACK_USAGE_MISC, "stack: gpiochips");
+		}
+#endif
+
+		chBSemWaitTimeout(&gpiochips_wake, TIME_US2I(NT2US(next_poll)));
+	}
+}
+
+#endif
+
 /*==========================================================================*/
 /* Exported functions.														*/
 /*==========================================================================*/
@@ -224,6 +286,8 @@ int gpiochip_register(brain_pin_e base, const char *name, GpioChip& gpioChip, si
 	chip->base = base;
 	chip->size = size;
 	chip->gpio_names = nullptr;
+	chip->last_update_nt = 0;
+	gpiochip_mapPins(chip, chip - chips + 1);
 
 	// TODO: this cast seems wrong?
 	return (int)base;
@@ -248,6 +312,7 @@ int gpiochip_unregister(brain_pin_e base)
 		return -106;
 
 	/* unregister chip */
+	gpiochip_mapPins(chip, 0);
 	chip->name = nullptr;
 	chip->chip = nullptr;
 	chip->base = Gpio::Unassigned;
@@ -296,6 +361,7 @@ int gpiochips_init(void) {
 			    // todo: adjust unit tests to validate this fatal
 			    criticalError("Failed to init chip %d: %d", i, ret);
 			#else
+    			gpiochip_mapPins(chip, 0);
     			chip->base = Gpio::Unassigned;
       #endif
 		} else {
@@ -303,6 +369,19 @@ int gpiochips_init(void) {
 		}
 	}
 
+#if EFI_PROD_CODE
+	bool needs_thread = false;
+	for (int i = 0; i < BOARD_EXT_GPIOCHIPS; i++) {
+		if ((chips[i].base != Gpio::Unassigned) && (chips[i].chip->update_interval_ms > 0))
+			needs_thread = true;
+	}
+
+	if (needs_thread) {
+		chThdCreateStatic(gpiochips_thread_wa, sizeof(gpiochips_thread_wa),
+						  PRIO_GPIOCHIP, gpiochips_thread, nullptr);
+	}
+#endif
+
 	return pins_added;
 }
 
@@ -387,6 +466,65 @@ brain_pin_diag_e gpiochips_getDiag(brain_pin_e pin) {
 	return chip->chip->getDiag(pin - chip->base);
 }
 
+/**
+ * @brief Request update() of gpiochip
+ * @details for chips served by shared gpiochips thread. Several requests before the thread gets to
+ * the chip result in single update() call.
+ */
+
+void gpiochips_requestUpdate(GpioChip& chip)
+{
+	chip.update_pending = true;
+
+#if EFI_PROD_CODE
+	/* Entering a reentrant critical zone.*/
+	chibios_rt::CriticalSectionLocker csl;
+
+	chBSemSignalI(&gpiochips_wake);
+	if (!port_is_isr_context()) {
+		/**
+		 * chBSemSignalI above requires rescheduling
+		 * interrupt handlers have implicit rescheduling
+		 */
+		chSchRescheduleS();
+	}
+#endif
+}
+
+/**
+ * @brief Call update() of chips with pending writes or with poll interval elapsed
+ * @details chips are updated in registration order
+ * returns time until next chip poll is due
+ */
+
+efidur_t gpiochips_update(efitick_t nowNt)
+{
+	efidur_t next_poll = MS2NT(1000);
+
+	for (int i = 0; i < BOARD_EXT_GPIOCHIPS; i++) {
+		gpiochip *chip = &chips[i];
+
+		if ((chip->base == Gpio::Unassigned) || (chip->chip->update_interval_ms <= 0))
+			continue;
+
+		efidur_t interval = MS2NT(chip->chip->update_interval_ms);
+		efidur_t since_update = nowNt - chip->last_update_nt;
+
+		if (chip->chip->update_pending || (since_update >= interval)) {
+			/* clear first: write during update() should cause one more */
+			chip->chip->update_pending = false;
+			chip->last_update_nt = nowNt;
+			since_update = 0;
+
+			chip->chip->update();
+		}
+
+		next_poll = std::min(next_poll, interval - since_update);
+	}
+
+	return next_poll;
+}
+
 /**
  * @brief Get total pin count allocated for external gpio chips.
  * @details Will also include unused pins for chips that was registered
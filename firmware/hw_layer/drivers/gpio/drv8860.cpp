@@ -25,8 +25,6 @@
 
 #define DRIVER_NAME				"drv8860"
 
-static bool drv_task_ready = false;
-
 typedef enum {
 	DRV8860_DISABLED = 0,
 	DRV8860_WAIT_INIT,
@@ -42,16 +40,13 @@ typedef enum {
 /* Driver local variables and types.										*/
 /*==========================================================================*/
 
-/* OS */
-SEMAPHORE_DECL(drv8860_wake, 10 /* or BOARD_DRV8860_COUNT ? */);
-static THD_WORKING_AREA(drv8860_thread_1_wa, 256);
-
 /* Driver */
 struct Drv8860 : public GpioChip {
 	int init() override;
 
 	int writePad(size_t pin, int value) override;
 	brain_pin_diag_e getDiag(size_t pin) override;
+	int update() override;
 
 	// Internal helpers
 	int chip_init();
@@ -59,7 +54,6 @@ struct Drv8860 : public GpioChip {
 	void spi_send(uint16_t tx);
 
 	void update_outputs();
-	int wake_driver();
 
 	const drv8860_config		*cfg;
 	/* cached output state - state last send to chip */
@@ -135,50 +129,6 @@ int Drv8860::chip_init() {
 	return 0;
 }
 
-/**
- * @brief DRV8860 chip driver wakeup.
- * @details Wake up driver. Will cause output register update.
- */
-
-int Drv8860::wake_driver() {
-	/* Entering a reentrant critical zone.*/
-	chibios_rt::CriticalSectionLocker csl;
-
-	chSemSignalI(&drv8860_wake);
-
-	return 0;
-}
-
-/*==========================================================================*/
-/* Driver thread.															*/
-/*==========================================================================*/
-
-static THD_FUNCTION(drv8860_driver_thread, p) {
-	int i;
-	msg_t msg;
-
-	(void)p;
-
-	chRegSetThreadName(DRIVER_NAME);
-
-	while (1) {
-		msg = chSemWaitTimeout(&drv8860_wake, TIME_MS2I(DRV8860_POLL_INTERVAL_MS));
-
-		/* should we care about msg == MSG_TIMEOUT? */
-		(void)msg;
-
-		for (i = 0; i < BOARD_DRV8860_COUNT; i++) {
-			auto chip = &chips[i];
-			if ((chip->cfg == NULL) ||
-				(chip->drv_state == DRV8860_DISABLED) ||
-				(chip->drv_state == DRV8860_FAILED))
-				continue;
-
-			chip->update_outputs();
-		}
-	}
-}
-
 /*==========================================================================*/
 /* Driver interrupt handlers.												*/
 /*==========================================================================*/
@@ -199,7 +149,20 @@ int Drv8860::writePad(size_t pin, int value) {
 	else
 		o_state &= ~(1 << pin);
 	/* TODO: unlock */
-	wake_driver();
+	gpiochips_requestUpdate(*this);
+
+	return 0;
+}
+
+/**
+ * @brief DRV8860 update from shared gpiochips thread.
+ */
+
+int Drv8860::update() {
+	if (drv_state != DRV8860_READY)
+		return 0;
+
+	update_outputs();
 
 	return 0;
 }
@@ -218,12 +181,6 @@ int Drv8860::init() {
 
 	drv_state = DRV8860_READY;
 
-	if (!drv_task_ready) {
-		chThdCreateStatic(drv8860_thread_1_wa, sizeof(drv8860_thread_1_wa),
-						  PRIO_GPIOCHIP, drv8860_driver_thread, NULL);
-		drv_task_ready = true;
-	}
-
 	return 0;
 }
 
@@ -254,6 +211,7 @@ int drv8860_add(brain_pin_e base, unsigned int index, const drv8860_config *cfg)
 	chip.o_state = 0;
 	chip.o_state_cached = 0;
 	chip.drv_state = DRV8860_WAIT_INIT;
+	chip.update_interval_ms = DRV8860_POLL_INTERVAL_MS;
 
 	/* register, return gpio chip base */
 	ret = gpiochip_register(base, DRIVER_NAME, chip, DRV8860_OUTPUTS);
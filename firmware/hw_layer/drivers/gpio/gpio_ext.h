@@ -31,6 +31,8 @@ struct GpioChip {
 	virtual brain_pin_diag_e getDiag(size_t /*pin*/) { return PIN_OK; }
 	virtual int deinit() { return 0; }
 	virtual void debug() { }
+	/* exchange output and diagnostic registers with chip, called from shared gpiochips thread */
+	virtual int update() { return 0; }
 
 	/* chip needs reinitialization due to some critical issue */
 	bool						need_init = 0;
@@ -38,6 +40,11 @@ struct GpioChip {
 	int             alive_cnt = 0;
 
 	int statusCode;
+
+	/* shared gpiochips thread calls update() at least this often, 0 for chips running own thread */
+	int							update_interval_ms = 0;
+	/* outputs were written since last update(), see gpiochips_requestUpdate() */
+	volatile bool				update_pending = false;
 };
 
 int gpiochips_getPinOffset(brain_pin_e pin);
@@ -46,6 +53,7 @@ const char *gpiochips_getPinName(brain_pin_e pin);
 
 /* register/unregister GPIO chip */
 int gpiochip_register(brain_pin_e base, const char *name, GpioChip& chip, size_t size);
+int gpiochip_unregister(brain_pin_e base);
 
 /* Set individual names for pins */
 int gpiochips_setPinNames(brain_pin_e base, const char **names);
@@ -58,6 +66,11 @@ int gpiochips_writePad(brain_pin_e pin, int value);
 int gpiochips_readPad(brain_pin_e pin);
 brain_pin_diag_e gpiochips_getDiag(brain_pin_e pin);
 
+/* ask shared gpiochips thread to call chip update(), can be called from ISR */
+void gpiochips_requestUpdate(GpioChip& chip);
+/* one pass of shared gpiochips thread, returns time until next poll is due */
+efidur_t gpiochips_update(efitick_t nowNt);
+
 void gpiochips_debug();
 
 #if EFI_PROD_CODE
@@ -46,8 +46,6 @@
 
 #define DRIVER_NAME				"tle6240"
 
-static bool drv_task_ready = false;
-
 typedef enum {
 	TLE6240_DISABLED = 0,
 	TLE6240_WAIT_INIT,
@@ -76,17 +74,13 @@ typedef enum {
 /* Driver local variables and types.										*/
 /*==========================================================================*/
 
-/* OS */
-SEMAPHORE_DECL(tle6240_wake, 10 /* or BOARD_TLE6240_COUNT ? */);
-static THD_WORKING_AREA(tle6240_thread_1_wa, 256);
-
 /* Driver */
 struct Tle6240 : public GpioChip {
 	int init() override;
 
 	int writePad(size_t pin, int value) override;
 	brain_pin_diag_e getDiag(size_t pin) override;
-
+	int update() override;
 
 	// internal functions
 	int spi_rw(uint16_t tx, uint16_t *rx);
@@ -302,65 +296,6 @@ err_gpios:
 	return ret;
 }
 
-/**
- * @brief TLE6240 chip driver wakeup.
- * @details Wake up driver. Will cause output register and
- * diagnostic update.
- */
-
-static int tle6240_wake_driver()
-{
-	/* Entering a reentrant critical zone.*/
-	chibios_rt::CriticalSectionLocker csl;
-
-	chSemSignalI(&tle6240_wake);
-	if (!port_is_isr_context()) {
-		/**
-		 * chSemSignalI above requires rescheduling
-		 * interrupt handlers have implicit rescheduling
-		 */
-		chSchRescheduleS();
-	}
-
-	return 0;
-}
-
-/*==========================================================================*/
-/* Driver thread.															*/
-/*==========================================================================*/
-
-static THD_FUNCTION(tle6240_driver_thread, p)
-{
-	int i;
-	msg_t msg;
-
-	(void)p;
-
-	chRegSetThreadName(DRIVER_NAME);
-
-	while(1) {
-		msg = chSemWaitTimeout(&tle6240_wake, TIME_MS2I(TLE6240_POLL_INTERVAL_MS));
-
-		/* should we care about msg == MSG_TIMEOUT? */
-		(void)msg;
-
-		for (i = 0; i < BOARD_TLE6240_COUNT; i++) {
-			int ret;
-			Tle6240& chip = chips[i];
-
-			if (!chip.cfg ||
-				(chip.drv_state == TLE6240_DISABLED) ||
-				(chip.drv_state == TLE6240_FAILED))
-				continue;
-
-			ret = chip.update_output_and_diag();
-			if (ret) {
-				/* set state to TLE6240_FAILED? */
-			}
-		}
-	}
-}
-
 /*==========================================================================*/
 /* Driver interrupt handlers.												*/
 /*==========================================================================*/
@@ -397,12 +332,25 @@ int Tle6240::writePad(unsigned int pin, int value)
 			palClearPort(cfg->direct_io[n].port,
 					   PAL_PORT_BIT(cfg->direct_io[n].pad));
 	} else {
-		tle6240_wake_driver();
+		gpiochips_requestUpdate(*this);
 	}
 
 	return 0;
 }
 
+/**
+ * @brief TLE6240 update from shared gpiochips thread.
+ * @details Uploads output register, diagnostic comes back in the same exchange.
+ */
+
+int Tle6240::update()
+{
+	if (drv_state != TLE6240_READY)
+		return 0;
+
+	return update_output_and_diag();
+}
+
 brain_pin_diag_e Tle6240::getDiag(size_t pin)
 {
 	int val;
@@ -433,12 +381,6 @@ int Tle6240::init()
 
 	drv_state = TLE6240_READY;
 
-	if (!drv_task_ready) {
-		chThdCreateStatic(tle6240_thread_1_wa, sizeof(tle6240_thread_1_wa),
-						  PRIO_GPIOCHIP, tle6240_driver_thread, nullptr);
-		drv_task_ready = true;
-	}
-
 	return 0;
 }
 
@@ -473,6 +415,7 @@ int tle6240_add(brain_pin_e base, unsigned int index, const tle6240_config *cfg)
 	chip->o_state_cached = 0;
 	chip->o_direct_mask = 0;
 	chip->drv_state = TLE6240_WAIT_INIT;
+	chip->update_interval_ms = TLE6240_POLL_INTERVAL_MS;
 	for (i = 0; i < TLE6240_DIRECT_OUTPUTS; i++) {
 		if (cfg->direct_io[i].port != 0)
 			chip->o_direct_mask |= (1 << ((i < 4) ? i : (i + 4)));
@@ -22,8 +22,6 @@
 /* TODO: align with WD settings */
 #define TLE9104_POLL_INTERVAL_MS	100
 
-static bool drv_task_ready = false;
-
 typedef enum {
 	TLE9104_DISABLED = 0,
 	TLE9104_WAIT_INIT,
@@ -67,6 +65,7 @@ struct Tle9104 : public GpioChip {
 	int writePad(size_t pin, int value) override;
 	brain_pin_diag_e getDiag(size_t pin) override;
 	void debug() override;
+	int update() override;
 
 	int updateDiagState();
 	int updateStatus();
@@ -289,55 +288,8 @@ int Tle9104::chip_init() {
 	return 0;
 }
 
-/*==========================================================================*/
-/* Driver thread.															*/
-/*==========================================================================*/
-
-SEMAPHORE_DECL(tle9104_wake, 10 /* or BOARD_TLE9104_COUNT ? */);
-static THD_WORKING_AREA(tle9104_thread_1_wa, 256);
-
 static IgnVoltageGatekeeper gatekeeper;
 
-static THD_FUNCTION(tle9104_driver_thread, p) {
-	int i;
-	msg_t msg;
-
-	(void)p;
-
-	chRegSetThreadName(DRIVER_NAME);
-
-	while(1) {
-  	if (!gatekeeper.haveVoltage()) {
-  	  chThdSleepMilliseconds(300);
-      return;
-    }
-
-		msg = chSemWaitTimeout(&tle9104_wake, TIME_MS2I(TLE9104_POLL_INTERVAL_MS));
-
-		/* should we care about msg == MSG_TIMEOUT? */
-		(void)msg;
-
-		for (i = 0; i < BOARD_TLE9104_COUNT; i++) {
-			int ret;
-			Tle9104& chip = chips[i];
-
-			if (!chip.cfg ||
-				(chip.drv_state == TLE9104_DISABLED) ||
-				(chip.drv_state == TLE9104_FAILED))
-				continue;
-
-			ret = chip.updateDiagState();
-			if (ret) {
-				/* set state to TLE6240_FAILED? */
-			}
-			ret = chip.updateStatus();
-			if (ret) {
-				/* set state to TLE6240_FAILED? */
-			}
-		}
-	}
-}
-
 /*==========================================================================*/
 /* Driver exported functions.												*/
 /*==========================================================================*/
@@ -356,6 +308,23 @@ int Tle9104::writePad(size_t pin, int value) {
 	return 0;
 }
 
+/**
+ * @brief TLE9104 update from shared gpiochips thread.
+ * @details Outputs are direct driven, so this is diagnostic and status poll only.
+ */
+int Tle9104::update() {
+	if ((drv_state != TLE9104_READY) || !gatekeeper.haveVoltage()) {
+		return 0;
+	}
+
+	int ret = updateDiagState();
+	if (ret) {
+		return ret;
+	}
+
+	return updateStatus();
+}
+
 int Tle9104::updateDiagState() {
 	int ret;
 
@@ -542,12 +511,6 @@ int Tle9104::init() {
 	// Set hardware enable
 	m_en.setValue(true);
 
-	if (!drv_task_ready) {
-		chThdCreateStatic(tle9104_thread_1_wa, sizeof(tle9104_thread_1_wa),
-						  PRIO_GPIOCHIP, tle9104_driver_thread, nullptr);
-		drv_task_ready = true;
-	}
-
 	return 0;
 }
 
@@ -561,6 +524,7 @@ int tle9104_add(Gpio base, int index, const tle9104_config* cfg) {
 
 	chip.cfg = cfg;
 	chip.drv_state = TLE9104_WAIT_INIT;
+	chip.update_interval_ms = TLE9104_POLL_INTERVAL_MS;
 
 	return gpiochip_register(base, DRIVER_NAME, chip, 4);
 }
@@ -357,7 +357,11 @@ static void prepareLogFileName() {
 	if (engineConfiguration->sdTriggerLog) {
 		strcat(ptr, ".teeth");
 	} else {
+#if EFI_MLG_DELTA_LOG
+		strcat(ptr, DOT_MLD);
+#else
 		strcat(ptr, DOT_MLG);
+#endif // EFI_MLG_DELTA_LOG
 	}
 }
 
@@ -712,6 +716,11 @@ static int sdLogger(FIL *fd) {
 	// in next write (assume same size as current) will cross LOGGER_MAX_FILE_SIZE boundary
 	// TODO: use f_tell() instead ?
 	if (logBuffer.writen() + ret > LOGGER_MAX_FILE_SIZE) {
+		if (!engineConfiguration->sdTriggerLog) {
+			// delta log holds back a block of records
+			MLG::finishFileLogging(logBuffer);
+			logBuffer.flush();
+		}
 		logBuffer.stop();
 		sdLoggerCloseFile(fd);
 
@@ -738,6 +747,17 @@ static void sdLoggerStart()
 
 static void sdLoggerStop()
 {
+	if (sdLoggerInitDone && !sdLoggerFailed) {
+		if (!engineConfiguration->sdTriggerLog) {
+			// delta log holds back a block of records
+			MLG::finishFileLogging(logBuffer);
+		}
+		// stop() forgets the file before its own flush
+		logBuffer.flush();
+		logBuffer.stop();
+	}
+	sdLoggerInitDone = false;
+
 	sdLoggerCloseFile(&resources.fd);
 #if EFI_TOOTH_LOGGER
 	// TODO: cache this config option untill sdLoggerStop()
@@ -998,17 +1018,20 @@ static int mlgLogger() {
 static int sdTriggerLogger() {
 	size_t toWrite = 0;
 #if EFI_TOOTH_LOGGER
-	auto buffer = GetToothLoggerBufferBlocking();
+	const composite_logger_s* entries;
+	size_t count = GetToothLoggerDataBlocking(&entries, BIG_BUFFER_SIZE / sizeof(composite_logger_s));
 
-	// can return nullptr
-	if (buffer) {
-		toWrite = buffer->nextIdx * sizeof(composite_logger_s);
-		logBuffer.write(reinterpret_cast<const char*>(buffer->buffer), toWrite);
+	// can return zero
+	if (count) {
+		toWrite = count * sizeof(composite_logger_s);
+		logBuffer.write(reinterpret_cast<const char*>(entries), toWrite);
 		if (logBuffer.failed) {
+			// hand the entries back anyway, a pending DisableToothLogger() waits for that
+			ConsumeToothLoggerData(0);
 			return -1;
 		}
 
-		ReturnToothLoggerBuffer(buffer);
+		ConsumeToothLoggerData(count);
 	}
 #endif /* EFI_TOOTH_LOGGER */
 	return toWrite;
@@ -12,6 +12,8 @@
 #include "tunerstudio_io.h"
 
 #define DOT_MLG ".mlg"
+// delta compressed log, see mlg_delta.h
+#define DOT_MLD ".mld"
 
 // see also SD_STATUS
 typedef enum {
@@ -226,6 +226,17 @@ void canHwRecover(const size_t, CANDriver *)
 	/* TODO: */
 }
 
+size_t canHwGetFilterCount(CANDriver*)
+{
+	// no acceptance filter support, driver accepts every frame
+	return 0;
+}
+
+void canHwSetFilters(CANDriver*, const CanHwFilter*, size_t)
+{
+	// nothing to program with zero filters
+}
+
 #endif /* EFI_CAN_SUPPORT */
 
 bool mcuCanFlashWhileRunning() {
@@ -52,6 +52,11 @@ bool isValidCanRxPin(brain_pin_e pin);
 CANDriver* detectCanDevice(brain_pin_e pinRx, brain_pin_e pinTx);
 void canHwInfo(CANDriver* cand);
 void canHwRecover(const size_t busIndex, CANDriver *cand);
+struct CanHwFilter;
+// Number of hardware acceptance filters of this device, 0 if not supported
+size_t canHwGetFilterCount(CANDriver* cand);
+// Replace acceptance filters of this device, at most canHwGetFilterCount() of them
+void canHwSetFilters(CANDriver* cand, const CanHwFilter* filters, size_t count);
 #endif // HAL_USE_CAN
 
 // Serial
@@ -401,6 +401,7 @@ static void knockCompletionCallback(ADCDriver* adcp) {
 }
 
 static void knockErrorCallback(ADCDriver*, adcerror_t) {
+	onKnockSamplingError();
 }
 
 static const uint32_t smpr1 =
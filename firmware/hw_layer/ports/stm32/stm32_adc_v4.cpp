@@ -220,6 +220,7 @@ static void knockCompletionCallback(ADCDriver* adcp) {
 }
 
 static void knockErrorCallback(ADCDriver*, adcerror_t) {
+	onKnockSamplingError();
 }
 
 static const uint32_t smpr1 =
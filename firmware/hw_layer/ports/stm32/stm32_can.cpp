@@ -10,6 +10,8 @@
 
 #if EFI_CAN_SUPPORT
 
+#include "can_hw_filter.h"
+
 
 // Values below calculated with http://www.bittiming.can-wiki.info/
 // Pick ST micro bxCAN
@@ -443,4 +445,83 @@ void canHwRecover(const size_t busIndex, CANDriver *cand)
 #endif
 }
 
+#if STM32_CAN_USE_CAN1 || STM32_CAN_USE_CAN2
+// bxCAN: CAN1 and CAN2 share filter banks which live in CAN1, CAN2SB is the first bank of CAN2
+static size_t getCan2StartBank() {
+	return (CAN1->FMR & CAN_FMR_CAN2SB) >> CAN_FMR_CAN2SB_Pos;
+}
+#endif
+
+size_t canHwGetFilterCount(CANDriver* cand) {
+#if STM32_CAN_USE_CAN1
+	if (cand == &CAND1) {
+		return getCan2StartBank();
+	}
+#endif
+#if STM32_CAN_USE_CAN2
+	if (cand == &CAND2) {
+		return STM32_CAN_MAX_FILTERS - getCan2StartBank();
+	}
+#endif
+
+	// TODO: CAN3 has separate filter banks, FDCAN keeps filter lists in message RAM
+	UNUSED(cand);
+	return 0;
+}
+
+void canHwSetFilters(CANDriver* cand, const CanHwFilter* filters, size_t count) {
+#if STM32_CAN_USE_CAN1 || STM32_CAN_USE_CAN2
+	size_t bankCount = canHwGetFilterCount(cand);
+	if (bankCount == 0) {
+		return;
+	}
+	criticalAssertVoid(count <= bankCount, "too many CAN filters");
+
+	size_t firstBank = 0;
+#if STM32_CAN_USE_CAN2
+	if (cand == &CAND2) {
+		firstBank = getCan2StartBank();
+	}
+#endif
+
+	chibios_rt::CriticalSectionLocker csl;
+
+	// filters of both CAN1 and CAN2 are inactive while in init mode, keep it short
+	CAN1->FMR |= CAN_FMR_FINIT;
+
+	for (size_t i = 0; i < bankCount; i++) {
+		size_t bank = firstBank + i;
+		uint32_t bit = 1 << bank;
+
+		CAN1->FA1R &= ~bit;
+
+		if (i >= count) {
+			continue;
+		}
+
+		const CanHwFilter& filter = filters[i];
+
+		// single 32 bit id/mask filter, to FIFO 0
+		CAN1->FM1R &= ~bit;
+		CAN1->FS1R |= bit;
+		CAN1->FFA1R &= ~bit;
+
+		// same layout as CAN_RIxR: STID in 31:21, EXID in 31:3, IDE is always compared
+		if (filter.isExtended) {
+			CAN1->sFilterRegister[bank].FR1 = (filter.id << 3) | CAN_RI0R_IDE;
+			CAN1->sFilterRegister[bank].FR2 = (filter.mask << 3) | CAN_RI0R_IDE;
+		} else {
+			CAN1->sFilterRegister[bank].FR1 = filter.id << 21;
+			CAN1->sFilterRegister[bank].FR2 = (filter.mask << 21) | CAN_RI0R_IDE;
+		}
+
+		CAN1->FA1R |= bit;
+	}
+
+	CAN1->FMR &= ~CAN_FMR_FINIT;
+#else
+	UNUSED(cand);UNUSED(filters);UNUSED(count);
+#endif
+}
+
 #endif /* EFI_CAN_SUPPORT */
@@ -0,0 +1,60 @@
+// this section was generated automatically by rusEFI tool config_definition_base-all.jar based on (unknown script) controllers/lua/lua_state.txt
+// by class com.rusefi.output.CHeaderConsumer
+// begin
+#pragma once
+#include "rusefi_types.h"
+// start of lua_state_s
+struct lua_state_s {
+	/**
+	 * Lua: heap used
+	 * units: bytes
+	 * offset 0
+	 */
+	uint32_t luaHeapUsedBytes = (uint32_t)0;
+	/**
+	 * Lua: lost to slot rounding
+	 * units: bytes
+	 * offset 4
+	 */
+	uint32_t luaSlabSlackBytes = (uint32_t)0;
+	/**
+	 * Lua: free in slab pages
+	 * units: bytes
+	 * offset 8
+	 */
+	uint32_t luaSlabFreeBytes = (uint32_t)0;
+	/**
+	 * Lua: slab class slots used
+	 * units: %
+	 * offset 12
+	 */
+	uint8_t luaSlabClassUsage[7] = {};
+	/**
+	 * need 4 byte alignment
+	 * units: units
+	 * offset 19
+	 */
+	uint8_t alignmentFill_at_19[1] = {};
+	/**
+	 * Lua: heap after last GC cycle
+	 * units: bytes
+	 * offset 20
+	 */
+	uint32_t luaHeapAfterGcBytes = (uint32_t)0;
+	/**
+	 * Lua: GC time last tick
+	 * units: us
+	 * offset 24
+	 */
+	uint32_t luaGcStepTime = (uint32_t)0;
+	/**
+	 * Lua: GC cycles completed
+	 * units: count
+	 * offset 28
+	 */
+	uint32_t luaGcCycles = (uint32_t)0;
+};
+static_assert(sizeof(lua_state_s) == 32);
+
+// end
+// this section was generated automatically by rusEFI tool config_definition_base-all.jar based on (unknown script) controllers/lua/lua_state.txt
\ No newline at end of file
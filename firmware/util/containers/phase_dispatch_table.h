@@ -0,0 +1,154 @@
+/**
+ * @file phase_dispatch_table.h
+ *
+ * Per-cylinder events bucketed by engine phase so that trigger tooth handlers only
+ * range-check events which could be due before the next tooth instead of every cylinder.
+ *
+ * Each bucket holds a bitmask of event indices, each event lives in exactly one bucket.
+ * Candidates are a superset of the events within [currentPhase, nextPhase), callers still
+ * run the exact isPhaseInRange check.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+template <size_t TEventCount, size_t TBucketCount = 72>
+class PhaseDispatchTable {
+	static_assert(TEventCount <= 32, "event mask is 32 bits");
+	static_assert(TBucketCount < 255, "bucket index is 8 bits");
+
+public:
+	using mask_t = uint32_t;
+
+	// both 360 and 720 degree engine cycles fit into this range
+	static constexpr float cycleDegrees = 720;
+
+	PhaseDispatchTable() {
+		clear();
+	}
+
+	void clear() {
+		for (size_t i = 0; i < TBucketCount; i++) {
+			m_buckets[i] = 0;
+		}
+		for (size_t i = 0; i < TEventCount; i++) {
+			m_eventBucket[i] = noBucket;
+		}
+	}
+
+	/**
+	 * Moves event into the bucket of its new angle.
+	 * New bucket bit is set before old one is cleared so that a reader from higher priority
+	 * context never misses the event.
+	 */
+	void setAngle(size_t eventIndex, float angle) {
+		if (eventIndex >= TEventCount) {
+			return;
+		}
+
+		uint8_t bucket = getBucket(angle);
+		uint8_t oldBucket = m_eventBucket[eventIndex];
+		if (bucket == oldBucket) {
+			return;
+		}
+
+		mask_t bit = mask_t{1} << eventIndex;
+
+		chibios_rt::CriticalSectionLocker csl;
+		m_buckets[bucket] |= bit;
+		if (oldBucket != noBucket) {
+			m_buckets[oldBucket] &= ~bit;
+		}
+		m_eventBucket[eventIndex] = bucket;
+	}
+
+	void remove(size_t eventIndex) {
+		if (eventIndex >= TEventCount) {
+			return;
+		}
+
+		uint8_t oldBucket = m_eventBucket[eventIndex];
+		if (oldBucket == noBucket) {
+			return;
+		}
+
+		chibios_rt::CriticalSectionLocker csl;
+		m_buckets[oldBucket] &= ~(mask_t{1} << eventIndex);
+		m_eventBucket[eventIndex] = noBucket;
+	}
+
+	/**
+	 * @return mask of events which might be within [currentPhase, nextPhase), same wraparound rules as isPhaseInRange
+	 */
+	mask_t getCandidates(float currentPhase, float nextPhase) const {
+		size_t from = getBucket(currentPhase);
+		size_t to = getBucket(nextPhase);
+
+		if (!(nextPhase > currentPhase) && to >= from) {
+			// wraparound range which covers (almost) whole cycle
+			return getAll();
+		}
+
+		mask_t result = 0;
+		for (size_t bucket = from; ; bucket = (bucket + 1) % TBucketCount) {
+			result |= m_buckets[bucket];
+			if (bucket == to) {
+				break;
+			}
+		}
+		return result;
+	}
+
+	/**
+	 * Same as getCandidates for the range shifted by 360 degrees, useful for wasted spark on odd cylinder engines
+	 */
+	mask_t getCandidatesShifted360(float currentPhase, float nextPhase) const {
+		return getCandidates(shift360(currentPhase), shift360(nextPhase));
+	}
+
+	mask_t getAll() const {
+		mask_t result = 0;
+		for (size_t i = 0; i < TBucketCount; i++) {
+			result |= m_buckets[i];
+		}
+		return result;
+	}
+
+	/**
+	 * Invokes callback with index of each event in mask, lowest index first
+	 */
+	template <typename TFunc>
+	static void forEach(mask_t mask, TFunc callback) {
+		while (mask) {
+			size_t eventIndex = __builtin_ctz(mask);
+			// clear lowest set bit
+			mask &= mask - 1;
+			callback(eventIndex);
+		}
+	}
+
+private:
+	static constexpr uint8_t noBucket = 0xFF;
+
+	static float shift360(float phase) {
+		return phase >= cycleDegrees / 2 ? phase - cycleDegrees / 2 : phase + cycleDegrees / 2;
+	}
+
+	static uint8_t getBucket(float angle) {
+		// also catches NaN
+		if (!(angle > 0)) {
+			return 0;
+		}
+		if (angle >= cycleDegrees) {
+			return TBucketCount - 1;
+		}
+		size_t bucket = angle * (TBucketCount / cycleDegrees);
+		// float rounding just below cycleDegrees could land on TBucketCount
+		return bucket < TBucketCount ? bucket : TBucketCount - 1;
+	}
+
+	mask_t m_buckets[TBucketCount];
+	uint8_t m_eventBucket[TEventCount];
+};
@@ -0,0 +1,150 @@
+/**
+ * @file spsc_ring.h
+ *
+ * Lock-free single producer, single consumer ring over caller provided storage.
+ * Producer never waits: when the ring is full the new element is dropped and counted as an overrun.
+ * Consumer can peek at the longest contiguous run of elements and consume any part of it,
+ * so data can be streamed straight from the ring without an intermediate copy.
+ *
+ * If there are several producers (for example different interrupts) they have to be serialized by the caller.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+template <typename T>
+class SpscRing {
+public:
+	/**
+	 * Storage has to outlive the ring. One slot is kept empty to tell full from empty.
+	 * Not safe while producer or consumer are active.
+	 */
+	void init(T* storage, size_t slotCount) {
+		m_storage = storage;
+		m_slotCount = storage ? slotCount : 0;
+		reset();
+	}
+
+	/**
+	 * Drops all unread elements and clears the overrun counter.
+	 * Not safe while producer or consumer are active.
+	 */
+	void reset() {
+		m_head.store(0, std::memory_order_relaxed);
+		m_tail.store(0, std::memory_order_relaxed);
+		m_overrunCount.store(0, std::memory_order_relaxed);
+	}
+
+	size_t capacity() const {
+		return m_slotCount ? m_slotCount - 1 : 0;
+	}
+
+	// producer side
+
+	/**
+	 * @return false if ring is full (or has no storage) and value was dropped
+	 */
+	bool push(const T& value) {
+		size_t head = m_head.load(std::memory_order_relaxed);
+		size_t next = advance(head, 1);
+
+		if (m_slotCount == 0 || next == m_tail.load(std::memory_order_acquire)) {
+			m_overrunCount.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		m_storage[head] = value;
+		// publish the element only once it's written
+		m_head.store(next, std::memory_order_release);
+		return true;
+	}
+
+	// consumer side
+
+	/**
+	 * @param data set to the oldest unread element
+	 * @return number of unread elements in one contiguous run starting at data, at most maxCount
+	 */
+	size_t peek(const T** data, size_t maxCount) const {
+		size_t tail = m_tail.load(std::memory_order_relaxed);
+		size_t head = m_head.load(std::memory_order_acquire);
+
+		// stop at the end of storage, the rest is available with the next peek
+		size_t count = head >= tail ? head - tail : m_slotCount - tail;
+
+		*data = m_storage + tail;
+		return count < maxCount ? count : maxCount;
+	}
+
+	/**
+	 * Releases elements returned by peek back to the producer
+	 */
+	void consume(size_t count) {
+		if (m_slotCount == 0) {
+			// nothing was ever peeked, don't move tail past head
+			return;
+		}
+
+		size_t tail = m_tail.load(std::memory_order_relaxed);
+		m_tail.store(advance(tail, count), std::memory_order_release);
+	}
+
+	/**
+	 * Copies out up to maxCount oldest elements, across the end of storage if needed
+	 */
+	size_t read(T* dest, size_t maxCount) {
+		size_t total = 0;
+
+		while (total < maxCount) {
+			const T* data;
+			size_t count = peek(&data, maxCount - total);
+			if (count == 0) {
+				break;
+			}
+
+			for (size_t i = 0; i < count; i++) {
+				dest[total + i] = data[i];
+			}
+
+			consume(count);
+			total += count;
+		}
+
+		return total;
+	}
+
+	// either side
+
+	size_t size() const {
+		size_t tail = m_tail.load(std::memory_order_acquire);
+		size_t head = m_head.load(std::memory_order_acquire);
+		return head >= tail ? head - tail : m_slotCount - tail + head;
+	}
+
+	bool isEmpty() const {
+		return size() == 0;
+	}
+
+	// elements dropped because ring was full
+	uint32_t getOverrunCount() const {
+		return m_overrunCount.load(std::memory_order_relaxed);
+	}
+
+private:
+	size_t advance(size_t index, size_t count) const {
+		index += count;
+		return index >= m_slotCount ? index - m_slotCount : index;
+	}
+
+	T* m_storage = nullptr;
+	size_t m_slotCount = 0;
+
+	// next slot to write, only written by producer
+	std::atomic<size_t> m_head{0};
+	// next slot to read, only written by consumer
+	std::atomic<size_t> m_tail{0};
+	std::atomic<uint32_t> m_overrunCount{0};
+};
@@ -51,6 +51,15 @@ struct type_list<base_t, tail_t...> {
         return 1 + decltype(others)::count();
     }
 
+    /*
+     * Number of (unmocked) types for which filter_t<T>::value is true
+     */
+    template<template<typename> class filter_t>
+    static consteval size_t count_if() {
+        return decltype(first)::template count_if<filter_t>() +
+               decltype(others)::template count_if<filter_t>();
+    }
+
     /*
      * Returns whether has_t exists in the type list
      *
@@ -80,6 +89,25 @@ struct type_list<base_t, tail_t...> {
         others.apply_all(f);
     }
 
+    /*
+     * Same as apply_all, but only for types where filter_t<T>::value is true, where T is the
+     * unmocked type. Calls for other types are dropped at compile time, so this is for hot paths
+     * where most types would end up in an empty function.
+     *
+     * tl.apply_if<has_foo>([](auto & m) { m.foo(); });
+     */
+    template<template<typename> class filter_t, typename func_t>
+    void constexpr apply_if(func_t const & f) {
+        first.template apply_if<filter_t>(f);
+        others.template apply_if<filter_t>(f);
+    }
+
+    template<template<typename> class filter_t, typename func_t>
+    void constexpr apply_if(func_t const & f) const {
+        first.template apply_if<filter_t>(f);
+        others.template apply_if<filter_t>(f);
+    }
+
     // Applies an accumulator function over the sequence of elements.
     // The specified seed value is used as the initial accumulator value,
     // and the specified function is used to select the result value.
@@ -141,6 +169,11 @@ public:
         return 1;
     }
 
+    template<template<typename> class filter_t>
+    static consteval size_t count_if() {
+        return filter_t<base_t>::value ? 1 : 0;
+    }
+
     template<typename func_t>
     void constexpr apply_all(func_t const & f) {
         f(me);
@@ -151,6 +184,20 @@ public:
         f(me);
     }
 
+    template<template<typename> class filter_t, typename func_t>
+    void constexpr apply_if(func_t const & f) {
+        if constexpr (filter_t<base_t>::value) {
+            f(me);
+        }
+    }
+
+    template<template<typename> class filter_t, typename func_t>
+    void constexpr apply_if(func_t const & f) const {
+        if constexpr (filter_t<base_t>::value) {
+            f(me);
+        }
+    }
+
     template<typename return_t, typename func_t>
     decltype(auto) aggregate(func_t const& accumulator, return_t seed) {
         return accumulator(me, seed);
@@ -237,6 +284,11 @@ public:
         return 1;
     }
 
+    template<template<typename> class filter_t>
+    static consteval size_t count_if() {
+        return filter_t<base_t>::value ? 1 : 0;
+    }
+
     template<typename func_t>
     void constexpr apply_all(func_t const & f) {
         f(*me);
@@ -247,6 +299,20 @@ public:
         f(*me);
     }
 
+    template<template<typename> class filter_t, typename func_t>
+    void constexpr apply_if(func_t const & f) {
+        if constexpr (filter_t<base_t>::value) {
+            f(*me);
+        }
+    }
+
+    template<template<typename> class filter_t, typename func_t>
+    void constexpr apply_if(func_t const & f) const {
+        if constexpr (filter_t<base_t>::value) {
+            f(*me);
+        }
+    }
+
     template<typename return_t, typename func_t>
     decltype(auto) aggregate(func_t const& accumulator, return_t seed) {
         return accumulator(*me, seed);
@@ -0,0 +1,85 @@
+/**
+ * @file axis_lookup.h
+ *
+ * Table axis lookups which can be computed once and reused by every table sharing the same axis,
+ * for example per-cylinder fuel and ignition trims.
+ *
+ * See also libfirmware interpolation.h
+ */
+
+#pragma once
+
+#include <type_traits>
+#include <rusefi/interpolation.h>
+#include "efi_ratio.h"
+#include "efi_scaled_channel.h"
+
+// bracketing bin index and fraction within that bin
+using AxisLookup = priv::BinResult;
+
+template <typename TBin, int TSize>
+AxisLookup lookupAxis(float value, const TBin (&bins)[TSize]) {
+	// scaled bins are handled by priv::getBin scaling the value once instead of each bin
+	return priv::getBin(value, bins);
+}
+
+namespace priv {
+template <typename VType, unsigned RNum, unsigned CNum>
+float interpolateRaw(const VType (&table)[RNum][CNum], const AxisLookup& row, const AxisLookup& col) {
+	// Orient the table such that (0, 0) is the bottom left corner
+	float lowerLeft  = table[row.Idx    ][col.Idx    ];
+	float upperRight = table[row.Idx + 1][col.Idx + 1];
+	float lowerRight = table[row.Idx    ][col.Idx + 1];
+	float upperLeft  = table[row.Idx + 1][col.Idx    ];
+
+	float left  = upperLeft * row.Frac + lowerLeft * (1 - row.Frac);
+	float right = upperRight * row.Frac + lowerRight * (1 - row.Frac);
+
+	return right * col.Frac + left * (1 - col.Frac);
+}
+} // namespace priv
+
+/**
+ * Same as interpolate3d but with axis lookups already done
+ */
+template <typename VType, unsigned RNum, unsigned CNum>
+float interpolate3d(const VType (&table)[RNum][CNum], const AxisLookup& row, const AxisLookup& col) {
+	static_assert(std::is_arithmetic_v<VType>);
+	return priv::interpolateRaw(table, row, col);
+}
+
+/**
+ * scaled_channel table: interpolate raw storage values and apply scaling once instead of once per cell
+ */
+template <typename TValue, int TMult, int TDiv, unsigned RNum, unsigned CNum>
+float interpolate3d(const scaled_channel<TValue, TMult, TDiv> (&table)[RNum][CNum], const AxisLookup& row, const AxisLookup& col) {
+	static_assert(sizeof(scaled_channel<TValue, TMult, TDiv>) == sizeof(TValue));
+	auto& raw = *reinterpret_cast<const TValue (*)[RNum][CNum]>(&table);
+	return priv::interpolateRaw(raw, row, col) / efi::ratio<TMult, TDiv>::asFloat();
+}
+
+/**
+ * Remembers the lookup for the last value on one axis.
+ * Owner should invalidate() once per fast callback so that axis edits are picked up.
+ */
+class AxisLookupCache {
+public:
+	void invalidate() {
+		m_bins = nullptr;
+	}
+
+	template <typename TBin, int TSize>
+	AxisLookup get(float value, const TBin (&bins)[TSize]) {
+		if (m_bins != &bins || value != m_value) {
+			m_result = lookupAxis(value, bins);
+			m_bins = &bins;
+			m_value = value;
+		}
+		return m_result;
+	}
+
+private:
+	const void *m_bins = nullptr;
+	float m_value = 0;
+	AxisLookup m_result{};
+};
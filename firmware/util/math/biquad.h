@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include <cstddef>
+
 class Biquad {
 public:
 	Biquad();
@@ -22,7 +24,35 @@ public:
 	void configureLowpass(float samplingFrequency, float cutoffFrequency, float Q = 0.54f);
 	void configureHighpass(float samplingFrequency, float cutoffFrequency, float Q = 0.54f);
 
+	/**
+	 * Filters a block of raw samples, (sample - offset), and returns the sum of squares of the output.
+	 * Same as filter() per sample, but with coefficients and state kept in registers for the whole block
+	 * and without the per sample verbose check. Filter state carries over between blocks.
+	 */
+	template <typename TSample>
+	float filterSumSquares(const TSample* samples, size_t count, float offset) {
+		const float la0 = a0, la1 = a1, la2 = a2, lb1 = b1, lb2 = b2;
+		float lz1 = z1;
+		float lz2 = z2;
+		float sumSq = 0;
+
+		for (size_t i = 0; i < count; i++) {
+			float input = samples[i] - offset;
+			float result = input * la0 + lz1;
+			lz1 = input * la1 + lz2 - lb1 * result;
+			lz2 = input * la2 - lb2 * result;
+			sumSq += result * result;
+		}
+
+		z1 = lz1;
+		z2 = lz2;
+		return sumSq;
+	}
+
 private:
+	template <size_t TCount>
+	friend class BiquadBank;
+
 	float a0, a1, a2, b1, b2;
 	float z1, z2;
 };
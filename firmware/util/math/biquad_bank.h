@@ -0,0 +1,122 @@
+/**
+ * @file biquad_bank.h
+ *
+ * Many independent biquad filters, one lane per input, stored as structure of arrays.
+ * Filtering all lanes is one tight loop without per filter branches or calls which compilers
+ * vectorize where the target has float SIMD.
+ *
+ * Coefficients and state are loaded from/stored to regular Biquad instances so that
+ * filters are still configured with Biquad::configureLowpass and friends.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "biquad.h"
+
+template <size_t TCount>
+class BiquadBank {
+public:
+	BiquadBank() {
+		clear();
+	}
+
+	/**
+	 * Removes all lanes, unused lanes are zeroed so that they filter to zero
+	 */
+	void clear() {
+		m_count = 0;
+		for (size_t lane = 0; lane < TCount; lane++) {
+			a0[lane] = a1[lane] = a2[lane] = b1[lane] = b2[lane] = 0;
+			z1[lane] = z2[lane] = 0;
+		}
+	}
+
+	size_t size() const {
+		return m_count;
+	}
+
+	/**
+	 * Appends a lane with coefficients and state of given filter
+	 * @return lane index, or -1 if the bank is full
+	 */
+	int add(const Biquad& filter) {
+		if (m_count >= TCount) {
+			return -1;
+		}
+
+		size_t lane = m_count++;
+		a0[lane] = filter.a0;
+		a1[lane] = filter.a1;
+		a2[lane] = filter.a2;
+		b1[lane] = filter.b1;
+		b2[lane] = filter.b2;
+		z1[lane] = filter.z1;
+		z2[lane] = filter.z2;
+		return lane;
+	}
+
+	/**
+	 * Copies lane state back, for example before the bank is rebuilt
+	 */
+	void storeState(size_t lane, Biquad& filter) const {
+		filter.z1 = z1[lane];
+		filter.z2 = z2[lane];
+	}
+
+	// same as Biquad::cookSteadyState
+	void cookSteadyState(size_t lane, float steadyStateInput) {
+		float Y = steadyStateInput * (a0[lane] + a1[lane] + a2[lane]) / (1 + b1[lane] + b2[lane]);
+
+		z2[lane] = steadyStateInput * a2[lane] - Y * b2[lane];
+		z1[lane] = z2[lane] + steadyStateInput * a1[lane] - Y * b1[lane];
+	}
+
+	/**
+	 * Runs one sample through every lane, same as Biquad::filter per lane.
+	 * Lanes with active[lane] == 0 output garbage and keep their state, as if filter was not called.
+	 * input and output have to hold TCount elements, not just size().
+	 */
+	void filter(const float* __restrict input, const uint8_t* active, float* __restrict output) {
+		// inactive lanes are rare, park their state instead of branching in the main loop
+		float savedZ1[TCount];
+		float savedZ2[TCount];
+		bool anyInactive = false;
+		for (size_t lane = 0; lane < m_count; lane++) {
+			savedZ1[lane] = z1[lane];
+			savedZ2[lane] = z2[lane];
+			anyInactive |= !active[lane];
+		}
+
+		// all TCount lanes: fixed trip count is what lets compilers vectorize without remainder handling
+		for (size_t lane = 0; lane < TCount; lane++) {
+			float in = input[lane];
+			float result = in * a0[lane] + z1[lane];
+			z1[lane] = in * a1[lane] + z2[lane] - b1[lane] * result;
+			z2[lane] = in * a2[lane] - b2[lane] * result;
+			output[lane] = result;
+		}
+
+		if (anyInactive) {
+			for (size_t lane = 0; lane < m_count; lane++) {
+				if (!active[lane]) {
+					z1[lane] = savedZ1[lane];
+					z2[lane] = savedZ2[lane];
+				}
+			}
+		}
+	}
+
+private:
+	size_t m_count = 0;
+
+	float a0[TCount];
+	float a1[TCount];
+	float a2[TCount];
+	float b1[TCount];
+	float b2[TCount];
+	float z1[TCount];
+	float z2[TCount];
+};
@@ -51,5 +51,6 @@ public class StateDictionaryFactory {
         stateDictionary.register(live_data_e.LDS_short_term_fuel_trim_state, "short_term_fuel_trim");
         stateDictionary.register(live_data_e.LDS_vvl_controller_state, "vvl_controller_state");
         stateDictionary.register(live_data_e.LDS_live_data_rotational_idle, "live_data_rotational_idle");
+        stateDictionary.register(live_data_e.LDS_lua_state, "lua_heap");
     }
 }
\ No newline at end of file
@@ -50,4 +50,5 @@ public enum live_data_e {
 	LDS_short_term_fuel_trim_state,
 	LDS_vvl_controller_state,
 	LDS_live_data_rotational_idle,
+	LDS_lua_state,
 }
@@ -24,7 +24,16 @@ public class GetConfigValueConsumerTest {
     state.readBufferedReader(test, getConfigValueConsumer);
 
     assertEquals(
-"float getConfigValueByHash(const int hash) {\n" +
+"int getConfigSlotByHash(const int hash) {\n" +
+    "\treturn -1;\n" +
+    "}\n" +
+    "float getConfigValueBySlot(const int slot) {\n" +
+    "\treturn EFI_ERROR_CODE;\n" +
+    "}\n" +
+    "float getConfigValueByHash(const int hash) {\n" +
+    "\tint slot = getConfigSlotByHash(hash);\n" +
+    "\tif (slot >= 0)\n" +
+    "\t\treturn getConfigValueBySlot(slot);\n" +
     "\treturn EFI_ERROR_CODE;\n" +
     "}\n" +
     "float getConfigValueByName(const char *name) {\n" +
@@ -69,17 +78,32 @@ public class GetConfigValueConsumerTest {
         "#include \"pch.h\"\n" +
         "#include \"board_lookup.h\"\n" +
         "#include \"value_lookup.h\"\n" +
-        "float getConfigValueByHash(const int hash) {\n" +
-        "\tswitch(hash) {\n" +
+        "static const int configHashBySlot[2] = {\n" +
+        "\t-672272162, -1237776078,\n" +
+        "};\n" +
+        "static const uint16_t configSeedByBucket[1] = {\n" +
+        "\t0,\n" +
+        "};\n" +
+        "int getConfigSlotByHash(const int hash) {\n" +
+        "\treturn perfectHashLookup(hash, configHashBySlot, configSeedByBucket);\n" +
+        "}\n" +
+        "float getConfigValueBySlot(const int slot) {\n" +
+        "\tswitch(slot) {\n" +
         "// iat.config.tempC_1\n" +
-        "\t\tcase -672272162:\n" +
+        "\t\tcase 0:\n" +
         "\t\t\treturn config->iat.config.tempC_1;\n" +
         "// iat.adcChannel\n" +
-        "\t\tcase -1237776078:\n" +
+        "\t\tcase 1:\n" +
         "\t\t\treturn config->iat.adcChannel;\n" +
         "\t}\n" +
         "\treturn EFI_ERROR_CODE;\n" +
         "}\n" +
+        "float getConfigValueByHash(const int hash) {\n" +
+        "\tint slot = getConfigSlotByHash(hash);\n" +
+        "\tif (slot >= 0)\n" +
+        "\t\treturn getConfigValueBySlot(slot);\n" +
+        "\treturn EFI_ERROR_CODE;\n" +
+        "}\n" +
         "float getConfigValueByName(const char *name) {\n" +
         "\tint hash = djb2lowerCase(name);\n" +
         "\treturn getConfigValueByHash(hash);\n" +
@@ -102,17 +126,32 @@ public class GetConfigValueConsumerTest {
         "}\n", getConfigValueConsumer.getContent());
 
 
-    assertEquals("float getConfigValueByHash(const int hash) {\n" +
-        "\tswitch(hash) {\n" +
+    assertEquals("static const int configHashBySlot[2] = {\n" +
+        "\t-672272162, -1237776078,\n" +
+        "};\n" +
+        "static const uint16_t configSeedByBucket[1] = {\n" +
+        "\t0,\n" +
+        "};\n" +
+        "int getConfigSlotByHash(const int hash) {\n" +
+        "\treturn perfectHashLookup(hash, configHashBySlot, configSeedByBucket);\n" +
+        "}\n" +
+        "float getConfigValueBySlot(const int slot) {\n" +
+        "\tswitch(slot) {\n" +
         "// iat.config.tempC_1\n" +
-        "\t\tcase -672272162:\n" +
+        "\t\tcase 0:\n" +
         "\t\t\treturn config->iat.config.tempC_1;\n" +
         "// iat.adcChannel\n" +
-        "\t\tcase -1237776078:\n" +
+        "\t\tcase 1:\n" +
         "\t\t\treturn config->iat.adcChannel;\n" +
         "\t}\n" +
         "\treturn EFI_ERROR_CODE;\n" +
         "}\n" +
+        "float getConfigValueByHash(const int hash) {\n" +
+        "\tint slot = getConfigSlotByHash(hash);\n" +
+        "\tif (slot >= 0)\n" +
+        "\t\treturn getConfigValueBySlot(slot);\n" +
+        "\treturn EFI_ERROR_CODE;\n" +
+        "}\n" +
         "float getConfigValueByName(const char *name) {\n" +
         "\tint hash = djb2lowerCase(name);\n" +
         "\treturn getConfigValueByHash(hash);\n" +
@@ -178,53 +217,69 @@ public class GetConfigValueConsumerTest {
         "#include \"pch.h\"\n" +
         "#include \"board_lookup.h\"\n" +
         "#include \"value_lookup.h\"\n" +
-        "float getConfigValueByHash(const int hash) {\n" +
-        "\tswitch(hash) {\n" +
+        "static const int configHashBySlot[14] = {\n" +
+        "\t1694412179, -617915487, -685727673, -298185774, 382574846, -1832527325, -1120008897, 581685574,\n" +
+        "\t1819278123, -1144186889, -653172717, -1571463185, -1925174695, 727098956,\n" +
+        "};\n" +
+        "static const uint16_t configSeedByBucket[4] = {\n" +
+        "\t35, 4, 5, 14,\n" +
+        "};\n" +
+        "int getConfigSlotByHash(const int hash) {\n" +
+        "\treturn perfectHashLookup(hash, configHashBySlot, configSeedByBucket);\n" +
+        "}\n" +
+        "float getConfigValueBySlot(const int slot) {\n" +
+        "\tswitch(slot) {\n" +
         "// clt.config.tempC_1\n" +
-        "\t\tcase -1832527325:\n" +
+        "\t\tcase 5:\n" +
         "\t\t\treturn config->clt.config.tempC_1;\n" +
         "// clt.config.map.sensor.highValue\n" +
-        "\t\tcase 1819278123:\n" +
+        "\t\tcase 8:\n" +
         "\t\t\treturn config->clt.config.map.sensor.highValue;\n" +
         "// clt.config.map.sensor.hwChannel\n" +
-        "\t\tcase 581685574:\n" +
+        "\t\tcase 7:\n" +
         "\t\t\treturn config->clt.config.map.sensor.hwChannel;\n" +
         "// clt.config.injector.flow\n" +
-        "\t\tcase 382574846:\n" +
+        "\t\tcase 4:\n" +
         "\t\t\treturn config->clt.config.injector.flow;\n" +
         "// clt.config.bias_resistor\n" +
-        "\t\tcase -653172717:\n" +
+        "\t\tcase 10:\n" +
         "\t\t\treturn config->clt.config.bias_resistor;\n" +
         "// clt.adcChannel\n" +
-        "\t\tcase -1144186889:\n" +
+        "\t\tcase 9:\n" +
         "\t\t\treturn config->clt.adcChannel;\n" +
         "// issue_294_31\n" +
-        "\t\tcase -1571463185:\n" +
+        "\t\tcase 11:\n" +
         "\t\t\treturn config->issue_294_31;\n" +
         "// baseFuel\n" +
-        "\t\tcase 727098956:\n" +
+        "\t\tcase 13:\n" +
         "\t\t\treturn config->baseFuel;\n" +
         "// afr_type\n" +
-        "\t\tcase -1120008897:\n" +
+        "\t\tcase 6:\n" +
         "\t\t\treturn config->afr_type;\n" +
         "// speedToRpmRatio\n" +
-        "\t\tcase -685727673:\n" +
+        "\t\tcase 2:\n" +
         "\t\t\treturn config->speedToRpmRatio;\n" +
         "// afr_typet\n" +
-        "\t\tcase 1694412179:\n" +
+        "\t\tcase 0:\n" +
         "\t\t\treturn config->afr_typet;\n" +
         "// vehicleSpeedKph\n" +
-        "\t\tcase -1925174695:\n" +
+        "\t\tcase 12:\n" +
         "\t\t\treturn config->vehicleSpeedKph;\n" +
         "// isForcedInduction\n" +
-        "\t\tcase -617915487:\n" +
+        "\t\tcase 1:\n" +
         "\t\t\treturn config->isForcedInduction;\n" +
         "// enableFan1WithAc\n" +
-        "\t\tcase -298185774:\n" +
+        "\t\tcase 3:\n" +
         "\t\t\treturn config->enableFan1WithAc;\n" +
         "\t}\n" +
         "\treturn EFI_ERROR_CODE;\n" +
         "}\n" +
+        "float getConfigValueByHash(const int hash) {\n" +
+        "\tint slot = getConfigSlotByHash(hash);\n" +
+        "\tif (slot >= 0)\n" +
+        "\t\treturn getConfigValueBySlot(slot);\n" +
+        "\treturn EFI_ERROR_CODE;\n" +
+        "}\n" +
         "float getConfigValueByName(const char *name) {\n" +
         "\tint hash = djb2lowerCase(name);\n" +
         "\treturn getConfigValueByHash(hash);\n" +
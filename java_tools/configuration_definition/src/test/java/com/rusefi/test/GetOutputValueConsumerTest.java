@@ -6,6 +6,7 @@ import com.rusefi.util.LazyFile;
 import org.junit.jupiter.api.Test;
 
 import static com.rusefi.AssertCompatibility.assertEquals;
+import static com.rusefi.AssertCompatibility.assertThrows;
 
 /**
  * @see LiveDataProcessorTest for most integrated test
@@ -30,22 +31,37 @@ public class GetOutputValueConsumerTest {
     "#include \"pch.h\"\n" +
     "#include \"board_lookup.h\"\n" +
     "#include \"value_lookup.h\"\n" +
-    "float getOutputValueByHash(const int hash) {\n" +
-    "\tswitch(hash) {\n" +
+    "static const int outputHashBySlot[3] = {\n" +
+    "\t-298185774, -1571463185, -709106787,\n" +
+    "};\n" +
+    "static const uint16_t outputSeedByBucket[1] = {\n" +
+    "\t0,\n" +
+    "};\n" +
+    "int getOutputSlotByHash(const int hash) {\n" +
+    "\treturn perfectHashLookup(hash, outputHashBySlot, outputSeedByBucket);\n" +
+    "}\n" +
+    "float getOutputValueBySlot(const int slot) {\n" +
+    "\tswitch(slot) {\n" +
     "#if EFI_BOOST_CONTROL\n" +
     "// issue_294_31\n" +
-    "\t\tcase -1571463185:\n" +
+    "\t\tcase 1:\n" +
     "\t\t\treturn engine->outputChannels->issue_294_31;\n" +
     "// enableFan1WithAc\n" +
-    "\t\tcase -298185774:\n" +
+    "\t\tcase 0:\n" +
     "\t\t\treturn engine->outputChannels->enableFan1WithAc;\n" +
     "// hwChannel\n" +
-    "\t\tcase -709106787:\n" +
+    "\t\tcase 2:\n" +
     "\t\t\treturn engine->outputChannels->hwChannel;\n" +
     "#endif\n" +
     "\t}\n" +
     "\treturn EFI_ERROR_CODE;\n" +
     "}\n" +
+    "float getOutputValueByHash(const int hash) {\n" +
+    "\tint slot = getOutputSlotByHash(hash);\n" +
+    "\tif (slot >= 0)\n" +
+    "\t\treturn getOutputValueBySlot(slot);\n" +
+    "\treturn EFI_ERROR_CODE;\n" +
+    "}\n" +
     "float getOutputValueByName(const char *name) {\n" +
     "\tint hash = djb2lowerCase(name);\n" +
     "\treturn getOutputValueByHash(hash);\n" +
@@ -74,27 +90,56 @@ public class GetOutputValueConsumerTest {
     "#include \"pch.h\"\n" +
     "#include \"board_lookup.h\"\n" +
     "#include \"value_lookup.h\"\n" +
-    "float getOutputValueByHash(const int hash) {\n" +
-    "\tswitch(hash) {\n" +
+    "static const int outputHashBySlot[4] = {\n" +
+    "\t-381519965, -1270448973, -1429286498, -344048084,\n" +
+    "};\n" +
+    "static const uint16_t outputSeedByBucket[1] = {\n" +
+    "\t7,\n" +
+    "};\n" +
+    "int getOutputSlotByHash(const int hash) {\n" +
+    "\treturn perfectHashLookup(hash, outputHashBySlot, outputSeedByBucket);\n" +
+    "}\n" +
+    "float getOutputValueBySlot(const int slot) {\n" +
+    "\tswitch(slot) {\n" +
     "// isPrime\n" +
-    "\t\tcase -1429286498:\n" +
+    "\t\tcase 2:\n" +
     "\t\t\treturn engine->module<FuelPumpController>()->isPrime;\n" +
     "// engineTurnedRecently\n" +
-    "\t\tcase -1270448973:\n" +
+    "\t\tcase 1:\n" +
     "\t\t\treturn engine->module<FuelPumpController>()->engineTurnedRecently;\n" +
     "// isFuelPumpOn\n" +
-    "\t\tcase -344048084:\n" +
+    "\t\tcase 3:\n" +
     "\t\t\treturn engine->module<FuelPumpController>()->isFuelPumpOn;\n" +
     "// ignitionOn\n" +
-    "\t\tcase -381519965:\n" +
+    "\t\tcase 0:\n" +
     "\t\t\treturn engine->module<FuelPumpController>()->ignitionOn;\n" +
     "\t}\n" +
     "\treturn EFI_ERROR_CODE;\n" +
     "}\n" +
+    "float getOutputValueByHash(const int hash) {\n" +
+    "\tint slot = getOutputSlotByHash(hash);\n" +
+    "\tif (slot >= 0)\n" +
+    "\t\treturn getOutputValueBySlot(slot);\n" +
+    "\treturn EFI_ERROR_CODE;\n" +
+    "}\n" +
     "float getOutputValueByName(const char *name) {\n" +
     "\tint hash = djb2lowerCase(name);\n" +
     "\treturn getOutputValueByHash(hash);\n" +
     "}\n",
             outputValueConsumer.getContent());
     }
+
+    @Test
+    public void hashCollisionFailsGeneration() {
+        // "rpmAz" and "rpmC8" have the same djb2 hash, one of them would not get a Lua handle
+        String test = "struct_no_prefix ts_outputs_s\n" +
+                "int rpmAz;\n" +
+                "int rpmC8;\n" +
+                "end_struct\n";
+        ReaderStateImpl state = new ReaderStateImpl();
+
+        GetOutputValueConsumer outputValueConsumer = new GetOutputValueConsumer(null, LazyFile.REAL);
+        state.readBufferedReader(test, (outputValueConsumer));
+        assertThrows(IllegalStateException.class, outputValueConsumer::getContent);
+    }
 }
@@ -140,15 +140,25 @@ public class GetConfigValueConsumer implements ConfigurationConsumer {
 
     @NotNull
     public String getCompleteGetterBody() {
+        PerfectHash perfectHash = GetOutputValueConsumer.getPerfectHash(variables);
+
         StringBuilder switchBody = new StringBuilder();
 
-        StringBuilder getterBody = GetOutputValueConsumer.getGetters(switchBody, variables);
+        GetOutputValueConsumer.getGetters(switchBody, variables, perfectHash);
 
-        String fullSwitch = GetOutputValueConsumer.wrapSwitchStatement(switchBody);
+        String fullSwitch = GetOutputValueConsumer.wrapSwitchStatement("slot", switchBody);
 
-        return "float getConfigValueByHash(const int hash) {\n" +
+        return perfectHash.getCppTables("config") +
+                "int getConfigSlotByHash(const int hash) {\n" +
+                perfectHash.getCppLookup("config") +
+                "}\n" +
+                "float getConfigValueBySlot(const int slot) {\n" +
                 fullSwitch +
-                getterBody + GET_METHOD_FOOTER +
+                "\treturn EFI_ERROR_CODE;\n" +
+                "}\n" +
+                "float getConfigValueByHash(const int hash) {\n" +
+                GetOutputValueConsumer.getSlotLookup("Config") +
+                GET_METHOD_FOOTER +
             "\treturn getConfigValueByHash(hash);\n" +
             "}\n";
     }
@@ -12,7 +12,6 @@ import java.util.*;
 import java.util.concurrent.atomic.AtomicInteger;
 import java.util.stream.Collectors;
 
-import static com.rusefi.output.GetConfigValueConsumer.getCompareName;
 import static com.rusefi.output.SdCardFieldsContent.getNamePrefix;
 
 /**
@@ -82,18 +81,28 @@ public class GetOutputValueConsumer implements ConfigurationConsumer {
     }
 
     public String getContent() {
+        PerfectHash perfectHash = getPerfectHash(getterPairs);
+
         StringBuilder switchBody = new StringBuilder();
 
-        StringBuilder getterBody = getGetters(switchBody, getterPairs);
+        getGetters(switchBody, getterPairs, perfectHash);
 
-        String fullSwitch = wrapSwitchStatement(switchBody);
+        String fullSwitch = wrapSwitchStatement("slot", switchBody);
 
         return
                 GetConfigValueConsumer.getHeader(getClass()) +
                 additionalHeaders +
-                "float getOutputValueByHash(const int hash) {\n" +
+                perfectHash.getCppTables("output") +
+                "int getOutputSlotByHash(const int hash) {\n" +
+                perfectHash.getCppLookup("output") +
+                "}\n" +
+                "float getOutputValueBySlot(const int slot) {\n" +
                 fullSwitch +
-                getterBody + "\treturn EFI_ERROR_CODE;\n" +
+                "\treturn EFI_ERROR_CODE;\n" +
+                "}\n" +
+                "float getOutputValueByHash(const int hash) {\n" +
+                getSlotLookup("Output") +
+                "\treturn EFI_ERROR_CODE;\n" +
                     "}\n" +
                     "float getOutputValueByName(const char *name) {\n" +
                     "\tint hash = djb2lowerCase(name);\n" +
@@ -102,32 +111,55 @@ public class GetOutputValueConsumer implements ConfigurationConsumer {
                 ;
     }
 
+    @NotNull
+    static String getSlotLookup(String kind) {
+        return "\tint slot = get" + kind + "SlotByHash(hash);\n" +
+            "\tif (slot >= 0)\n" +
+            "\t\treturn get" + kind + "ValueBySlot(slot);\n";
+    }
+
     @NotNull
     static String wrapSwitchStatement(StringBuilder switchBody) {
+        return wrapSwitchStatement("hash", switchBody);
+    }
+
+    @NotNull
+    static String wrapSwitchStatement(String variable, StringBuilder switchBody) {
         String fullSwitch = switchBody.length() == 0 ? "" :
                 (
 
-                        "\tswitch(hash) {\n" + switchBody + "\t}\n");
+                        "\tswitch(" + variable + ") {\n" + switchBody + "\t}\n");
         return fullSwitch;
     }
 
-    static void BuildGetters(String conditional, List<VariableRecord> getterPairs, StringBuilder switchBody, StringBuilder getterBody, HashMap<Integer, AtomicInteger> hashConflicts ) {
+    /**
+     * Perfect hash over all names. Lua getOutputHandle/getCalibrationHandle only know slots, so every
+     * name needs one: names with colliding hashes fail generation instead of silently losing their handle.
+     */
+    @NotNull
+    static PerfectHash getPerfectHash(List<VariableRecord> getterPairs) {
+        Map<Integer, List<String>> namesByHash = new LinkedHashMap<>();
+        for (VariableRecord pair : getterPairs) {
+            namesByHash.computeIfAbsent(HashUtil.hash(pair.getUserName()), hash -> new ArrayList<>()).add(pair.getUserName());
+        }
+        for (List<String> names : namesByHash.values()) {
+            if (names.size() > 1)
+                throw new IllegalStateException("Name hash collision, please rename one of " + names);
+        }
+        int[] keys = namesByHash.keySet().stream().mapToInt(Integer::intValue).toArray();
+        return new PerfectHash(keys);
+    }
+
+    static void BuildGetters(String conditional, List<VariableRecord> getterPairs, StringBuilder switchBody, PerfectHash perfectHash) {
         if (conditional != null) {
             switchBody.append("#if " + conditional + "\n");
         }
 
         for (VariableRecord pair : getterPairs) {
-            String returnLine = "\t\treturn " + pair.getFullName() + ";\n";
-
             int hash = HashUtil.hash(pair.getUserName());
-            if (hashConflicts.get(hash).get() == 1) {
-                switchBody.append("// " + pair.getUserName() + "\n");
-                switchBody.append("\t\tcase " + hash + ":\n");
-                switchBody.append("\t" + returnLine);
-            } else {
-                getterBody.append(getCompareName(pair.getUserName()));
-                getterBody.append(returnLine);
-            }
+            switchBody.append("// " + pair.getUserName() + "\n");
+            switchBody.append("\t\tcase " + perfectHash.getSlot(hash) + ":\n");
+            switchBody.append("\t\t\treturn " + pair.getFullName() + ";\n");
         }
 
         if (conditional != null) {
@@ -135,12 +167,7 @@ public class GetOutputValueConsumer implements ConfigurationConsumer {
         }
     }
 
-    @NotNull
-    static StringBuilder getGetters(StringBuilder switchBody, List<VariableRecord> getterPairs) {
-        StringBuilder getterBody = new StringBuilder();
-
-        HashMap<Integer, AtomicInteger> hashConflicts = getHashConflicts(getterPairs);
-
+    static void getGetters(StringBuilder switchBody, List<VariableRecord> getterPairs, PerfectHash perfectHash) {
         Map<java.util.Optional<String>, List<VariableRecord>> byConditional = getterPairs.stream().collect(
             Collectors.groupingBy(
                 v -> java.util.Optional.ofNullable(v.getConditional())
@@ -157,12 +184,9 @@ public class GetOutputValueConsumer implements ConfigurationConsumer {
                 e.getKey().orElse(null),
                 e.getValue(),
                 switchBody,
-                getterBody,
-                hashConflicts
+                perfectHash
             )
         );
-
-        return getterBody;
     }
 
     @NotNull
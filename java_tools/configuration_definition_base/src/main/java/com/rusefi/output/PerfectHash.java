@@ -0,0 +1,135 @@
+package com.rusefi.output;
+
+import java.util.*;
+
+/**
+ * Minimal perfect hash over field name hashes: every key gets its own slot in [0, keyCount) and
+ * firmware finds it with two mixes and one compare, see perfectHashLookup in value_lookup.h
+ * <p>
+ * Keys are spread into buckets of about {@link #KEYS_PER_BUCKET}, then for each bucket, biggest first,
+ * we search for a seed which moves all bucket keys into free slots.
+ *
+ * @see GetOutputValueConsumer
+ * @see GetConfigValueConsumer
+ */
+public class PerfectHash {
+    public static final int KEYS_PER_BUCKET = 4;
+    // seeds are stored as uint16_t
+    private static final int MAX_SEED = 0xFFFF;
+    private static final int VALUES_PER_LINE = 8;
+
+    private final int[] keyBySlot;
+    private final int[] seedByBucket;
+    private final Map<Integer, Integer> slotByKey = new HashMap<>();
+
+    /**
+     * @param keys have to be unique
+     */
+    public PerfectHash(int[] keys) {
+        int keyCount = keys.length;
+        int bucketCount = Math.max(1, (keyCount + KEYS_PER_BUCKET - 1) / KEYS_PER_BUCKET);
+
+        List<List<Integer>> buckets = new ArrayList<>();
+        for (int i = 0; i < bucketCount; i++)
+            buckets.add(new ArrayList<>());
+        for (int key : keys)
+            buckets.get(Integer.remainderUnsigned(mix(key, 0), bucketCount)).add(key);
+
+        List<Integer> order = new ArrayList<>();
+        for (int i = 0; i < bucketCount; i++)
+            order.add(i);
+        order.sort(Comparator.comparingInt((Integer b) -> -buckets.get(b).size()).thenComparingInt(b -> b));
+
+        keyBySlot = new int[keyCount];
+        seedByBucket = new int[bucketCount];
+        boolean[] occupied = new boolean[keyCount];
+
+        for (int bucket : order) {
+            List<Integer> bucketKeys = buckets.get(bucket);
+            if (bucketKeys.isEmpty())
+                continue;
+
+            int seed = findSeed(bucketKeys, occupied);
+            seedByBucket[bucket] = seed;
+            for (int key : bucketKeys) {
+                int slot = getSlot(key, seed, keyCount);
+                occupied[slot] = true;
+                keyBySlot[slot] = key;
+                slotByKey.put(key, slot);
+            }
+        }
+    }
+
+    private static int findSeed(List<Integer> bucketKeys, boolean[] occupied) {
+        for (int seed = 0; seed < MAX_SEED; seed++) {
+            Set<Integer> slots = new HashSet<>();
+            boolean fits = true;
+            for (int key : bucketKeys) {
+                int slot = getSlot(key, seed, occupied.length);
+                if (occupied[slot] || !slots.add(slot)) {
+                    fits = false;
+                    break;
+                }
+            }
+            if (fits)
+                return seed;
+        }
+        throw new IllegalStateException("No perfect hash seed for " + bucketKeys);
+    }
+
+    private static int getSlot(int key, int seed, int keyCount) {
+        return Integer.remainderUnsigned(mix(key, seed + 1), keyCount);
+    }
+
+    /**
+     * Has to match perfectHashMix in value_lookup.h
+     */
+    public static int mix(int key, int seed) {
+        int x = key ^ (seed * 0x9E3779B9);
+        x ^= x >>> 16;
+        x *= 0x85EBCA6B;
+        x ^= x >>> 13;
+        x *= 0xC2B2AE35;
+        x ^= x >>> 16;
+        return x;
+    }
+
+    public int getSlot(int key) {
+        return slotByKey.get(key);
+    }
+
+    public int size() {
+        return keyBySlot.length;
+    }
+
+    /**
+     * @param prefix for example "output" for outputHashBySlot and outputSeedByBucket
+     */
+    public String getCppTables(String prefix) {
+        if (size() == 0)
+            return "";
+        return getCppArray("int", prefix + "HashBySlot", keyBySlot) +
+            getCppArray("uint16_t", prefix + "SeedByBucket", seedByBucket);
+    }
+
+    private static String getCppArray(String type, String name, int[] values) {
+        StringBuilder sb = new StringBuilder("static const " + type + " " + name + "[" + values.length + "] = {\n");
+        for (int i = 0; i < values.length; i++) {
+            if (i % VALUES_PER_LINE == 0)
+                sb.append("\t");
+            sb.append(values[i]).append(",");
+            sb.append(i % VALUES_PER_LINE == VALUES_PER_LINE - 1 || i == values.length - 1 ? "\n" : " ");
+        }
+        sb.append("};\n");
+        return sb.toString();
+    }
+
+    /**
+     * @return body of the slot by hash function
+     */
+    public String getCppLookup(String prefix) {
+        if (size() == 0)
+            return "\treturn -1;\n";
+        return "\treturn perfectHashLookup(hash, " + prefix + "HashBySlot, " + prefix + "SeedByBucket);\n";
+    }
+}
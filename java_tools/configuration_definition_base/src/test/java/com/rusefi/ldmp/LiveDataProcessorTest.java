@@ -105,61 +105,77 @@ public class LiveDataProcessorTest {
                 "#if WB_THINGY\n" +
                 "#include <wb.h>\n" +
                 "#endif\n" +
-                "float getOutputValueByHash(const int hash) {\n" +
-                "\tswitch(hash) {\n" +
+                "static const int outputHashBySlot[16] = {\n" +
+                "\t-427776066, -1390672637, 1346769218, 1477961803, 612295801, 612331738, 747357955, 1126615849,\n" +
+                "\t1346769217, 1680936043, 1087480456, -1296201087, -607543232, -1605036797, 316857724, -607543231,\n" +
+                "};\n" +
+                "static const uint16_t outputSeedByBucket[4] = {\n" +
+                "\t25, 0, 4, 698,\n" +
+                "};\n" +
+                "int getOutputSlotByHash(const int hash) {\n" +
+                "\treturn perfectHashLookup(hash, outputHashBySlot, outputSeedByBucket);\n" +
+                "}\n" +
+                "float getOutputValueBySlot(const int slot) {\n" +
+                "\tswitch(slot) {\n" +
                 "// oootempC\n" +
-                "\t\tcase 1477961803:\n" +
+                "\t\tcase 3:\n" +
                 "\t\t\treturn engine->outputChannels.oootempC;\n" +
                 "// oooesr\n" +
-                "\t\tcase 316857724:\n" +
+                "\t\tcase 14:\n" +
                 "\t\t\treturn engine->outputChannels.oooesr;\n" +
                 "// lua.fuelMult\n" +
-                "\t\tcase -1390672637:\n" +
+                "\t\tcase 1:\n" +
                 "\t\t\treturn engine->outputChannels.lua.fuelMult;\n" +
                 "// lua.clutchUpState\n" +
-                "\t\tcase -427776066:\n" +
+                "\t\tcase 0:\n" +
                 "\t\t\treturn engine->outputChannels.lua.clutchUpState;\n" +
                 "// lua.brakePedalState\n" +
-                "\t\tcase -1296201087:\n" +
+                "\t\tcase 11:\n" +
                 "\t\t\treturn engine->outputChannels.lua.brakePedalState;\n" +
                 "// lua.disableDecelerationFuelCutOff\n" +
-                "\t\tcase 1680936043:\n" +
+                "\t\tcase 9:\n" +
                 "\t\t\treturn engine->outputChannels.lua.disableDecelerationFuelCutOff;\n" +
                 "// lua.torqueReductionState\n" +
-                "\t\tcase -1605036797:\n" +
+                "\t\tcase 13:\n" +
                 "\t\t\treturn engine->outputChannels.lua.torqueReductionState;\n" +
                 "// zoooTC\n" +
-                "\t\tcase 747357955:\n" +
+                "\t\tcase 6:\n" +
                 "\t\t\treturn engine->zutputChannels.zoooTC;\n" +
                 "#if WB_THINGY\n" +
                 "// wb1tempC\n" +
-                "\t\tcase 1087480456:\n" +
+                "\t\tcase 10:\n" +
                 "\t\t\treturn engine->wbo1.tempC;\n" +
                 "// wb1bitName1\n" +
-                "\t\tcase -607543232:\n" +
+                "\t\tcase 12:\n" +
                 "\t\t\treturn engine->wbo1.bitName1;\n" +
                 "// wb1bitName2\n" +
-                "\t\tcase -607543231:\n" +
+                "\t\tcase 15:\n" +
                 "\t\t\treturn engine->wbo1.bitName2;\n" +
                 "// wb1esr\n" +
-                "\t\tcase 612295801:\n" +
+                "\t\tcase 4:\n" +
                 "\t\t\treturn engine->wbo1.esr;\n" +
                 "// wb2tempC\n" +
-                "\t\tcase 1126615849:\n" +
+                "\t\tcase 7:\n" +
                 "\t\t\treturn engine->wbo2.tempC;\n" +
                 "// wb2bitName1\n" +
-                "\t\tcase 1346769217:\n" +
+                "\t\tcase 8:\n" +
                 "\t\t\treturn engine->wbo2.bitName1;\n" +
                 "// wb2bitName2\n" +
-                "\t\tcase 1346769218:\n" +
+                "\t\tcase 2:\n" +
                 "\t\t\treturn engine->wbo2.bitName2;\n" +
                 "// wb2esr\n" +
-                "\t\tcase 612331738:\n" +
+                "\t\tcase 5:\n" +
                 "\t\t\treturn engine->wbo2.esr;\n" +
                 "#endif\n" +
                 "\t}\n" +
                 "\treturn EFI_ERROR_CODE;\n" +
                 "}\n" +
+                "float getOutputValueByHash(const int hash) {\n" +
+                "\tint slot = getOutputSlotByHash(hash);\n" +
+                "\tif (slot >= 0)\n" +
+                "\t\treturn getOutputValueBySlot(slot);\n" +
+                "\treturn EFI_ERROR_CODE;\n" +
+                "}\n" +
                 "float getOutputValueByName(const char *name) {\n" +
                 "\tint hash = djb2lowerCase(name);\n" +
                 "\treturn getOutputValueByHash(hash);\n" +
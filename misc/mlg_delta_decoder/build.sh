@@ -0,0 +1,7 @@
+#!/bin/bash
+
+FW=../../firmware
+
+g++ -O2 -std=c++20 -I$FW/console/binary_mlg_log -I$FW/controllers/system \
+	mlg_delta_decode.cpp $FW/console/binary_mlg_log/mlg_delta_decoder.cpp $FW/console/binary_mlg_log/mlg_lz.cpp \
+	-o mlg_delta_decode
@@ -0,0 +1,57 @@
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "mlg_delta_decoder.h"
+
+class FileWriter : public Writer {
+public:
+	FileWriter(std::ofstream& dst) : m_dst(dst) { }
+
+	size_t write(const char* buffer, size_t count) override {
+		m_dst.write(buffer, count);
+		return count;
+	}
+
+	size_t flush() override {
+		m_dst.flush();
+		return 0;
+	}
+
+private:
+	std::ofstream& m_dst;
+};
+
+int main(int argc, char** argv)
+{
+	if (argc != 3) {
+		std::cerr << "Usage: " << argv[0] << " input.mld output.mlg" << std::endl;
+		return 1;
+	}
+
+	std::ifstream src(argv[1], std::ios::binary);
+	if (!src) {
+		std::cerr << "Unable to open " << argv[1] << std::endl;
+		return 1;
+	}
+
+	std::vector<uint8_t> data((std::istreambuf_iterator<char>(src)), std::istreambuf_iterator<char>());
+
+	std::ofstream dst(argv[2], std::ios::binary);
+	FileWriter writer(dst);
+
+	size_t recordCount;
+	bool ok = MLG::Delta::decode(data.data(), data.size(), writer, &recordCount);
+	writer.flush();
+
+	std::cout << recordCount << " records" << std::endl;
+
+	if (!ok) {
+		// power loss while logging leaves an incomplete last block, everything before it is still good
+		std::cerr << "Damaged or truncated log, converted as much as possible" << std::endl;
+		return 2;
+	}
+
+	return 0;
+}
@@ -42,6 +42,7 @@
 #define EFI_MCP_3208 FALSE
 #define EFI_MCP_3208 FALSE
 #define EFI_CAN_SERIAL FALSE
+#define EFI_CAN_HW_FILTERS FALSE
 #define EFI_TS_SCATTER FALSE
 #define EFI_SOFTWARE_KNOCK FALSE
 #define _HAS_STATIC_RTTI FALSE
@@ -173,6 +174,7 @@
 #define EFI_SIGNAL_EXECUTOR_ONE_TIMER FALSE
 #define EFI_TUNER_STUDIO_VERBOSE FALSE
 #define EFI_FILE_LOGGING TRUE
+#define EFI_MLG_DELTA_LOG FALSE
 #define EFI_WARNING_LED FALSE
 #define EFI_VEHICLE_SPEED TRUE
 #define EFI_TCU FALSE
@@ -6,6 +6,9 @@ inline bool isValidCanTxPin(brain_pin_e) { return true; }
 inline bool isValidCanRxPin(brain_pin_e) { return true; }
 inline void canHwInfo(CANDriver*) { return; }
 inline void canHwRecover(const size_t, CANDriver *) { return; }
+struct CanHwFilter;
+inline size_t canHwGetFilterCount(CANDriver*) { return 0; }
+inline void canHwSetFilters(CANDriver*, const CanHwFilter*, size_t) { return; }
 #endif // HAL_USE_CAN
 
  bool mcuCanFlashWhileRunning() ;
@@ -113,9 +113,9 @@ static void runToothLoggerTest() {
 
 	{
 		// no data yet
-		CompositeBuffer * toothBuffer = GetToothLoggerBufferNonblocking();
-		if (toothBuffer != nullptr) {
-			criticalError("nullptr buffer expected");
+		const composite_logger_s* entries;
+		if (GetToothLoggerDataNonblocking(&entries, toothLoggerReadyEntries) != 0) {
+			criticalError("no entries expected");
 		}
 	}
 
@@ -127,14 +127,13 @@ static void runToothLoggerTest() {
 	}
 
 	{
-		CompositeBuffer * toothBuffer = GetToothLoggerBufferNonblocking();
-		criticalAssertVoid(toothBuffer != nullptr, "filled buffer expected");
+		const composite_logger_s* entries = nullptr;
+		size_t count = GetToothLoggerDataNonblocking(&entries, toothLoggerReadyEntries);
+		criticalAssertVoid(count == toothLoggerReadyEntries, "full chunk expected");
+		criticalAssertVoid(entries != nullptr, "Payload reference expected");
+		criticalAssertVoid(GetToothLoggerOverrunCount() == 0, "no overrun expected");
 
-		size_t size = toothBuffer->nextIdx * sizeof(composite_logger_s);
-		criticalAssertVoid(size != 0, "Positive payload size expected");
-
-		const uint8_t* ptr = reinterpret_cast<const uint8_t*>(toothBuffer->buffer);
-		criticalAssertVoid(ptr != nullptr, "Payload reference expected");
+		ConsumeToothLoggerData(count);
 	}
 #endif // EFI_TOOTH_LOGGER
 }
@@ -8,6 +8,9 @@
 
 #include "pch.h"
 #include <stdlib.h>
+#include "parallel_test_runner.h"
+#include "engine_benchmark.h"
+#include "trigger_sync_points.h"
 
 bool hasInitGtest = false;
 
@@ -19,16 +22,31 @@ GTEST_API_ int main(int argc, char **argv) {
     return 0;
   }
 
-  if (argc == 2 && strcmp(argv[1], "replay_log") == 0) {
-    void runLogReplay();
-	// feed real log sensor data into our logic
-    runLogReplay();
+  if (argc >= 2 && strcmp(argv[1], "replay_log") == 0) {
+    void runLogReplay(const char *logFileName);
+	// feed real log sensor data into our logic, compare recomputed outputs with logged
+    runLogReplay(argc > 2 ? argv[2] : "replay.mlg");
     return 0;
   }
 
+  if (argc >= 2 && strcmp(argv[1], "benchmark") == 0) {
+	// engine throughput in virtual time, key=value arguments
+    return runEngineBenchmark(argc - 2, argv + 2);
+  }
+
+  if (argc >= 2 && strcmp(argv[1], "trigger_sync_points") == 0) {
+	// firmware looks these up instead of simulating built-in trigger shapes
+    return writeTriggerSyncPoints(argc > 2 ? argv[2] : TRIGGER_SYNC_POINTS_FILE_NAME);
+  }
+
 	hasInitGtest = true;
 
 	testing::InitGoogleTest(&argc, argv);
+
+	if (argc >= 2 && strcmp(argv[1], "parallel") == 0) {
+		// each test in its own forked process, optional worker count, one per core by default
+		return runTestsInParallel(argc > 2 ? atoi(argv[2]) : 0);
+	}
 	// uncomment if you only want to run selected tests
 	/**
 	 * See TEST_FROM_TRIGGER_ID to limit test just for last trigger
@@ -1,16 +1,9 @@
 #!/bin/bash
 
-# This script runs every test in its own process (own invocation of rusefi_test executable)
+# This script runs every test in its own process (own forked child of rusefi_test executable)
 # This allows us to test for accidental cross-test leakage that fixes/breaks something
+# Tests run on all cores, optional argument is worker count. See test_results/unit_tests.xml for JUnit report
 
 set -e
 
-export GTEST_TOTAL_SHARDS=600
-for IDX in {0..599}
-do
-	export GTEST_SHARD_INDEX=$IDX
-	build/rusefi_test
-done
-
-unset GTEST_TOTAL_SHARDS
-unset GTEST_SHARD_INDEX
+build/rusefi_test parallel $1
@@ -2,6 +2,7 @@
 #define RECORD_H
 
 #include <string>
+#include <cstring>
 #include <fstream> // For std::ifstream
 #include <stdexcept> // For std::runtime_error
 #include <iostream>  // For std::cerr
@@ -24,6 +25,46 @@ public:
 
     const std::string& getFieldName() const { return fieldName; }
 
+    static uint16_t decode16(const uint8_t* p) {
+        return static_cast<uint16_t>(p[0] << 8 | p[1]);
+    }
+
+    static uint32_t decode32(const uint8_t* p) {
+        return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+    }
+
+    int getSize() const { return getRecordSize(type); }
+
+    /**
+     * Same as read() but from a line already in memory, big-endian like the file
+     */
+    float decode(const uint8_t* p) const {
+        switch (type) {
+            case MlgDataType::MLG_DATA_S8:
+                return static_cast<float>(static_cast<int8_t>(p[0])) * scale;
+            case MlgDataType::MLG_DATA_U8:
+                return static_cast<float>(p[0]) * scale;
+            case MlgDataType::MLG_DATA_BIT:
+                return static_cast<float>(p[0]);
+            case MlgDataType::MLG_DATA_S16:
+                return static_cast<float>(static_cast<int16_t>(decode16(p))) * scale;
+            case MlgDataType::MLG_DATA_U16:
+                return static_cast<float>(decode16(p)) * scale;
+            case MlgDataType::MLG_DATA_S32:
+                return static_cast<float>(static_cast<int32_t>(decode32(p))) * scale;
+            case MlgDataType::MLG_DATA_U32:
+                return static_cast<float>(decode32(p)) * scale;
+            case MlgDataType::MLG_DATA_FLOAT: {
+                uint32_t raw = decode32(p);
+                float f;
+                memcpy(&f, &raw, sizeof(f));
+                return f * scale;
+            }
+            default:
+                throw std::runtime_error("Unsupported MLG data type");
+        }
+    }
+
     float read(std::ifstream& ifs) {
         float value = 0.0f;
         int32_t temp_s32;
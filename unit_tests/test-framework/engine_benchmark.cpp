@@ -0,0 +1,246 @@
+/*
+ * engine_benchmark.cpp
+ *
+ * Virtual time makes everything but wall time deterministic: same configuration always produces the same
+ * teeth, scheduled events and queue depth, so those are exact regression checks while ns numbers are
+ * only comparable on the same machine.
+ */
+
+#include "pch.h"
+#include "engine_benchmark.h"
+
+#include <chrono>
+
+namespace {
+	using BenchmarkClock = std::chrono::steady_clock;
+
+	double elapsedNs(BenchmarkClock::time_point from, BenchmarkClock::time_point to) {
+		return std::chrono::duration<double, std::nano>(to - from).count();
+	}
+
+	struct CylinderFiringOrder {
+		int cylinders;
+		firing_order_e firingOrder;
+	};
+
+	const CylinderFiringOrder firingOrders[] = {
+		{ 1, FO_1 },
+		{ 2, FO_1_2 },
+		{ 3, FO_1_2_3 },
+		{ 4, FO_1_3_4_2 },
+		{ 5, FO_1_2_4_5_3 },
+		{ 6, FO_1_5_3_6_2_4 },
+		{ 8, FO_1_8_4_3_6_5_7_2 },
+		{ 9, FO_1_2_3_4_5_6_7_8_9 },
+		{ 10, FO_1_10_9_4_3_6_5_8_7_2 },
+		{ 12, FO_1_7_5_11_3_9_6_12_2_8_4_10 },
+	};
+}
+
+EngineBenchmark::EngineBenchmark(EngineTestHelper& eth, const EngineBenchmarkConfig& config)
+	: m_eth(eth)
+	, m_config(config) {
+}
+
+bool EngineBenchmark::configure() {
+	bool hasFiringOrder = false;
+	for (const auto& entry : firingOrders) {
+		if (entry.cylinders == m_config.cylinders) {
+			engineConfiguration->cylindersCount = entry.cylinders;
+			engineConfiguration->firingOrder = entry.firingOrder;
+			hasFiringOrder = true;
+		}
+	}
+	if (!hasFiringOrder) {
+		printf("benchmark: no default firing order for %d cylinder(s)\n", m_config.cylinders);
+		return false;
+	}
+
+	engineConfiguration->injectionMode = m_config.injectionMode;
+	// fuel cut would make top of the sweep look cheap
+	engineConfiguration->rpmHardLimit = m_config.rpmTo + 1000;
+	engineConfiguration->trigger.type = m_config.trigger;
+	m_eth.applyTriggerWaveform();
+
+	const TriggerWaveform& shape = engine->triggerCentral.triggerShape;
+	if (shape.shapeDefinitionError || shape.getSize() == 0) {
+		printf("benchmark: trigger %s has no valid shape\n", getTrigger_type_e(m_config.trigger));
+		return false;
+	}
+
+	m_phase = 0;
+	m_phaseIndex = 0;
+	m_phaseNt = getTimeNowNt();
+	return true;
+}
+
+void EngineBenchmark::spin(int rpm, int revolutions, EngineBenchmarkPoint* point) {
+	const TriggerWaveform& shape = engine->triggerCentral.triggerShape;
+	float cycle = shape.getCycleDuration();
+	int size = shape.getSize();
+	// crank degrees per tick: rpm * 360 / 60 per second
+	double degPerNt = rpm * 6.0 / NT_PER_SECOND;
+
+	double totalAngle = 0;
+	double targetAngle = 360.0 * revolutions;
+
+	while (totalAngle < targetAngle) {
+		float edgeAngle = shape.wave.getSwitchTime(m_phaseIndex) * cycle;
+		efitick_t edgeNt = m_phaseNt + (efitick_t)((edgeAngle - m_phase) / degPerNt);
+
+		auto start = BenchmarkClock::now();
+		m_eth.setTimeNtAndInvokeEvents(edgeNt);
+		auto eventsDone = BenchmarkClock::now();
+		m_eth.fireTriggerShapeEvents(m_phaseIndex, edgeNt);
+		auto toothDone = BenchmarkClock::now();
+
+		if (point != nullptr) {
+			point->teeth++;
+			point->eventNs += elapsedNs(start, eventsDone);
+			point->toothNs += elapsedNs(eventsDone, toothDone);
+		}
+
+		totalAngle += edgeAngle - m_phase;
+		m_phase = edgeAngle;
+		m_phaseNt = edgeNt;
+		m_phaseIndex++;
+		if (m_phaseIndex == size) {
+			m_phaseIndex = 0;
+			m_phase -= cycle;
+		}
+	}
+
+	if (point != nullptr) {
+		point->revolutions += totalAngle / 360;
+	}
+}
+
+EngineBenchmarkPoint EngineBenchmark::runAtRpm(int rpm) {
+	spin(rpm, m_config.warmupRevolutions, nullptr);
+
+	TestExecutor& scheduler = engine->scheduler;
+	scheduler.resetStats();
+	uint32_t errorsBefore = engine->triggerCentral.triggerState.totalTriggerErrorCounter;
+
+	EngineBenchmarkPoint point;
+	point.rpm = rpm;
+	spin(rpm, m_config.revolutions, &point);
+
+	if (point.teeth > 0) {
+		point.toothNs /= point.teeth;
+		point.eventNs /= point.teeth;
+	}
+	point.eventsPerRevolution = scheduler.getScheduledCount() / point.revolutions;
+	point.maxQueueDepth = scheduler.getMaxQueueDepth();
+	point.triggerErrors = engine->triggerCentral.triggerState.totalTriggerErrorCounter - errorsBefore;
+	return point;
+}
+
+std::vector<EngineBenchmarkPoint> EngineBenchmark::sweep() {
+	std::vector<EngineBenchmarkPoint> points;
+	for (int rpm = m_config.rpmFrom; rpm <= m_config.rpmTo; rpm += m_config.rpmStep) {
+		points.push_back(runAtRpm(rpm));
+	}
+	return points;
+}
+
+void EngineBenchmark::writeJson(FILE* fp, const std::vector<EngineBenchmarkPoint>& points) const {
+	fprintf(fp, "{\"cylinders\":%d,\"trigger\":\"%s\",\"injectionMode\":\"%s\",\"revolutions\":%d,\"points\":[",
+		m_config.cylinders,
+		getTrigger_type_e(m_config.trigger),
+		getInjection_mode_e(m_config.injectionMode),
+		m_config.revolutions);
+
+	for (size_t i = 0; i < points.size(); i++) {
+		const EngineBenchmarkPoint& point = points[i];
+		fprintf(fp, "%s\n{\"rpm\":%d,\"teeth\":%d,\"toothNs\":%.1f,\"eventNs\":%.1f,\"eventsPerRevolution\":%.3f,\"maxQueueDepth\":%d,\"triggerErrors\":%d}",
+			i == 0 ? "" : ",",
+			point.rpm,
+			point.teeth,
+			point.toothNs,
+			point.eventNs,
+			point.eventsPerRevolution,
+			point.maxQueueDepth,
+			(int)point.triggerErrors);
+	}
+	fprintf(fp, "\n]}\n");
+}
+
+static void printBenchmarkUsage() {
+	printf("usage: benchmark [cylinders=4] [trigger=<trigger_type_e>] [injection=<injection_mode_e>]\n");
+	printf("  [rpm_from=1000] [rpm_to=8000] [rpm_step=1000] [revolutions=500] [output=engine_benchmark.json] [max_tooth_ns=0]\n");
+}
+
+int runEngineBenchmark(int argc, char** argv) {
+	EngineBenchmarkConfig config;
+	const char *outputFileName = "engine_benchmark.json";
+	double maxToothNs = 0;
+
+	for (int i = 0; i < argc; i++) {
+		const char *separator = strchr(argv[i], '=');
+		if (separator == nullptr) {
+			printBenchmarkUsage();
+			return -1;
+		}
+		std::string key(argv[i], separator - argv[i]);
+		const char *value = separator + 1;
+
+		if (key == "cylinders") {
+			config.cylinders = atoi(value);
+		} else if (key == "trigger") {
+			config.trigger = (trigger_type_e)atoi(value);
+		} else if (key == "injection") {
+			config.injectionMode = (injection_mode_e)atoi(value);
+		} else if (key == "rpm_from") {
+			config.rpmFrom = atoi(value);
+		} else if (key == "rpm_to") {
+			config.rpmTo = atoi(value);
+		} else if (key == "rpm_step") {
+			config.rpmStep = atoi(value);
+		} else if (key == "revolutions") {
+			config.revolutions = atoi(value);
+		} else if (key == "output") {
+			outputFileName = value;
+		} else if (key == "max_tooth_ns") {
+			maxToothNs = atof(value);
+		} else {
+			printBenchmarkUsage();
+			return -1;
+		}
+	}
+
+	if (config.rpmStep <= 0 || config.revolutions <= 0) {
+		printBenchmarkUsage();
+		return -1;
+	}
+
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	EngineBenchmark benchmark(eth, config);
+	if (!benchmark.configure()) {
+		return -1;
+	}
+
+	std::vector<EngineBenchmarkPoint> points = benchmark.sweep();
+
+	benchmark.writeJson(stdout, points);
+	FILE *fp = fopen(outputFileName, "w");
+	if (fp == nullptr) {
+		printf("benchmark: error creating %s\n", outputFileName);
+		return -1;
+	}
+	benchmark.writeJson(fp, points);
+	fclose(fp);
+
+	int result = 0;
+	for (const auto& point : points) {
+		if (point.triggerErrors != 0) {
+			printf("benchmark: %d trigger error(s) at %d rpm\n", (int)point.triggerErrors, point.rpm);
+			result = 1;
+		}
+		if (maxToothNs > 0 && point.toothNs > maxToothNs) {
+			printf("benchmark: %.1fns per tooth at %d rpm is above %.1fns\n", point.toothNs, point.rpm, maxToothNs);
+			result = 1;
+		}
+	}
+	return result;
+}
@@ -0,0 +1,72 @@
+/*
+ * engine_benchmark.h
+ *
+ * Host side throughput benchmark: configured engine is spun across an RPM sweep in virtual time, wall time
+ * spent in trigger handling and in scheduled events is measured per tooth.
+ */
+
+#pragma once
+
+#include <cstdio>
+#include <vector>
+
+class EngineTestHelper;
+
+struct EngineBenchmarkConfig {
+	int cylinders = 4;
+	trigger_type_e trigger = trigger_type_e::TT_TOOTHED_WHEEL_60_2;
+	injection_mode_e injectionMode = IM_SEQUENTIAL;
+	int rpmFrom = 1000;
+	int rpmTo = 8000;
+	int rpmStep = 1000;
+	// crank revolutions at each RPM point, warm up revolutions are not measured
+	int revolutions = 500;
+	int warmupRevolutions = 50;
+};
+
+struct EngineBenchmarkPoint {
+	int rpm = 0;
+	int teeth = 0;
+	float revolutions = 0;
+	// wall time of trigger edge handling (decoder, mainTriggerCallback, fuel and spark scheduling) per tooth
+	double toothNs = 0;
+	// wall time of executing scheduled actions per tooth
+	double eventNs = 0;
+	float eventsPerRevolution = 0;
+	int maxQueueDepth = 0;
+	uint32_t triggerErrors = 0;
+};
+
+class EngineBenchmark {
+public:
+	EngineBenchmark(EngineTestHelper& eth, const EngineBenchmarkConfig& config);
+
+	/**
+	 * @return false if cylinder count has no default firing order or trigger shape is invalid
+	 */
+	bool configure();
+	EngineBenchmarkPoint runAtRpm(int rpm);
+	std::vector<EngineBenchmarkPoint> sweep();
+
+	void writeJson(FILE* fp, const std::vector<EngineBenchmarkPoint>& points) const;
+
+private:
+	/**
+	 * @param point nullptr while warming up
+	 */
+	void spin(int rpm, int revolutions, EngineBenchmarkPoint* point);
+
+	EngineTestHelper& m_eth;
+	const EngineBenchmarkConfig m_config;
+
+	// crank angle within trigger cycle at m_phaseNt, next edge is m_phaseIndex
+	float m_phase = 0;
+	int m_phaseIndex = 0;
+	efitick_t m_phaseNt = 0;
+};
+
+/**
+ * "benchmark" command line mode, arguments are key=value pairs
+ * @return non-zero on bad arguments, trigger errors or if max_tooth_ns gate was exceeded
+ */
+int runEngineBenchmark(int argc, char** argv);
@@ -16,6 +16,7 @@
 #include "logicdata.h"
 #include "unit_test_logger.h"
 #include "hardware.h"
+#include "trigger_emulator_algo.h"
 // https://stackoverflow.com/questions/23427804/cant-find-mkdir-function-in-dirent-h-for-windows
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -300,6 +301,21 @@ void EngineTestHelper::firePrimaryTriggerFall() {
 	handleShaftSignal(0, false, nowNt);
 }
 
+void EngineTestHelper::fireTriggerShapeEvents(int index, efitick_t nowNt) {
+	const MultiChannelStateSequence& wave = engine.triggerCentral.triggerShape.wave;
+
+	for (int channel = 0; channel < PWM_PHASE_MAX_WAVE_PER_PWM; channel++) {
+		if (needEvent(index, wave, channel)) {
+			bool isRise = TriggerValue::RISE == wave.getChannelState(channel, index);
+
+			isRise ^= (channel == 0 && engineConfiguration->invertPrimaryTriggerSignal);
+			isRise ^= (channel == 1 && engineConfiguration->invertSecondaryTriggerSignal);
+
+			handleShaftSignal(channel, isRise, nowNt);
+		}
+	}
+}
+
 void EngineTestHelper::fireTriggerEventsWithDuration(float durationMs) {
 	fireTriggerEvents2(/*count*/1, durationMs);
 }
@@ -381,6 +397,10 @@ void EngineTestHelper::setTimeNtAndInvokeCallBacks(efitick_t nt)
 }
 
 void EngineTestHelper::setTimeAndInvokeEventsUs(int targetTimeUs) {
+	setTimeNtAndInvokeEvents(US_TO_NT_MULTIPLIER * (efitick_t)targetTimeUs);
+}
+
+void EngineTestHelper::setTimeNtAndInvokeEvents(efitick_t targetNt) {
 	int counter = 0;
 	while (true) {
 		criticalAssertVoid(counter++ < 100'000, "EngineTestHelper: failing to setTimeAndInvokeEventsUs");
@@ -390,7 +410,7 @@ void EngineTestHelper::setTimeAndInvokeEventsUs(int targetTimeUs) {
 			break;
 		}
 		efitick_t nextEventNt = nextScheduledEvent->getMomentNt();
-		if (nextEventNt > US2NT(targetTimeUs)) {
+		if (nextEventNt > targetNt) {
 			// next event is too far in the future
 			break;
 		}
@@ -403,9 +423,9 @@ void EngineTestHelper::setTimeAndInvokeEventsUs(int targetTimeUs) {
 		engine.scheduler.executeAllNt(getTimeNowNt());
 	}
 	if (unitTestTaskNoFastCallWhileAdvancingTimeHack) {
-		setTimeNowUs(targetTimeUs);
+		setTimeNowNt(targetNt);
 	} else {
-		setTimeNtAndInvokeCallBacks(US_TO_NT_MULTIPLIER * targetTimeUs);
+		setTimeNtAndInvokeCallBacks(targetNt);
 	}
 }
 
@@ -68,6 +68,8 @@ public:
 	void moveTimeForwardAndInvokeEventsUs(int deltaTimeUs);
 	void setTimeNtAndInvokeCallBacks(efitick_t nt);
 	void setTimeAndInvokeEventsUs(int timeNowUs);
+	// same as above, without 35 minutes limit of int microseconds
+	void setTimeNtAndInvokeEvents(efitick_t targetNt);
 	void moveTimeForwardAndInvokeEventsSec(int deltaTimeSeconds);
 	/**
 	 * both Rise and Fall
@@ -83,6 +85,10 @@ public:
 	 */
 	void firePrimaryTriggerFall();
 	void fireTriggerEvents(int count);
+	/**
+	 * Edges of configured trigger shape at given wave index, honoring signal inversion
+	 */
+	void fireTriggerShapeEvents(int index, efitick_t nowNt);
 	void fireTriggerEventsWithDuration(float delayMs);
 	/**
 	 * todo: better method name since this method executes events in the FUTURE
@@ -0,0 +1,252 @@
+/*
+ * log_replay.cpp
+ *
+ * Log columns are resolved to indices once per log, after that each line is decoded in place and
+ * nothing is allocated or looked up by name until the end of the log.
+ */
+
+#include "pch.h"
+#include "log_replay.h"
+
+#include <cmath>
+
+// below this RPM logged engine is considered stopped and no shaft edges are synthesized
+#define LOG_REPLAY_MIN_RPM 20
+
+namespace {
+	struct InputColumn {
+		const char *name;
+		SensorType type;
+	};
+
+	// names as in data_logs.ini
+	const InputColumn inputs[LOG_REPLAY_INPUT_COUNT] = {
+		{ "CLT", SensorType::Clt },
+		{ "IAT", SensorType::Iat },
+		{ "TPS", SensorType::Tps1 },
+		{ "MAP", SensorType::Map },
+		{ "Lambda", SensorType::Lambda1 },
+		{ "Lambda 2", SensorType::Lambda2 },
+	};
+
+	struct OutputColumn {
+		const char *name;
+		float (*getter)();
+	};
+
+	// outputs channels are only refreshed on TS requests, prefer the values they are copied from
+	const OutputColumn outputs[LOG_REPLAY_OUTPUT_COUNT] = {
+		{ "Fuel: Last inj pulse width", [] () -> float { return engine->outputChannels.actualLastInjection; } },
+		{ "Fuel: VE", [] () -> float { return engine->engineState.currentVe; } },
+		{ "Fuel: Load", [] () -> float { return engine->engineState.fuelingLoad; } },
+		{ "Fuel: Total correction", [] () -> float { return engine->fuelComputer.totalFuelCorrection; } },
+		{ "Timing: base ignition", [] () -> float { return engine->ignitionState.baseIgnitionAdvance; } },
+		{ "Ign: Timing Cyl 1", [] () -> float { return engine->outputChannels.ignitionAdvanceCyl[0]; } },
+	};
+}
+
+LogReplay::LogReplay(EngineTestHelper& eth) : m_eth(eth) {
+}
+
+const char* LogReplay::getOutputName(int column) {
+	return outputs[column].name;
+}
+
+void LogReplay::loadTune(const char* fileName) {
+	FILE *fp = fopen(fileName, "rb");
+	if (fp == nullptr) {
+		throw std::runtime_error(std::string("Error opening tune: ") + fileName);
+	}
+
+	fseek(fp, 0, SEEK_END);
+	long size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	if (size != (long)sizeof(persistent_config_s)) {
+		fclose(fp);
+		throw std::runtime_error("Tune size " + std::to_string(size) + " does not match this firmware "
+			+ std::to_string(sizeof(persistent_config_s)));
+	}
+
+	size_t read = fread(config, 1, sizeof(persistent_config_s), fp);
+	fclose(fp);
+	if (read != sizeof(persistent_config_s)) {
+		throw std::runtime_error(std::string("Error reading tune: ") + fileName);
+	}
+
+	m_eth.applyTriggerWaveform();
+}
+
+void LogReplay::replay(const char* mlgFileName, const char* diffFileName) {
+	BinarySensorReader reader;
+	reader.openMlg(mlgFileName);
+
+	FILE *diff = nullptr;
+	if (diffFileName != nullptr) {
+		diff = fopen(diffFileName, "w");
+		if (diff == nullptr) {
+			throw std::runtime_error(std::string("Error creating ") + diffFileName);
+		}
+	}
+
+	replay(reader, diff);
+
+	if (diff != nullptr) {
+		fclose(diff);
+	}
+}
+
+void LogReplay::resolveFields(BinarySensorReader& reader) {
+	m_timeIndex = reader.getFieldIndex("Time");
+	if (m_timeIndex < 0) {
+		throw std::runtime_error("Log has no Time column");
+	}
+	m_rpmIndex = reader.getFieldIndex("RPM");
+
+	for (int i = 0; i < LOG_REPLAY_INPUT_COUNT; i++) {
+		m_inputIndex[i] = reader.getFieldIndex(inputs[i].name);
+	}
+	for (int i = 0; i < LOG_REPLAY_OUTPUT_COUNT; i++) {
+		m_outputIndex[i] = reader.getFieldIndex(outputs[i].name);
+		m_stats[i] = {};
+	}
+}
+
+void LogReplay::writeDiffHeader(FILE* diff) const {
+	fprintf(diff, "Time");
+	for (int i = 0; i < LOG_REPLAY_OUTPUT_COUNT; i++) {
+		if (hasOutput(i)) {
+			fprintf(diff, ",%s log,%s replay,%s diff", outputs[i].name, outputs[i].name, outputs[i].name);
+		}
+	}
+	fprintf(diff, "\n");
+}
+
+void LogReplay::replay(BinarySensorReader& reader, FILE* diff) {
+	resolveFields(reader);
+	if (diff != nullptr) {
+		writeDiffHeader(diff);
+	}
+
+	m_lineCount = 0;
+	m_phase = 0;
+	m_phaseIndex = 0;
+	m_phaseNt = getTimeNowNt();
+
+	efitick_t startNt = m_phaseNt;
+	efitick_t slowStep = MS2NT(SLOW_CALLBACK_PERIOD_MS);
+	efitick_t nextSlowNt = startNt;
+	float firstTime = 0;
+	// RPM of the previous line is what engine was doing until this line
+	float rpm = 0;
+
+	while (reader.readLine()) {
+		float time = reader.getValue(m_timeIndex);
+		if (m_lineCount == 0) {
+			firstTime = time;
+		}
+
+		mockSensors(reader);
+
+		efitick_t lineNt = startNt + (efitick_t)((time - firstTime) * 1e6 * US_TO_NT_MULTIPLIER);
+		spinUntil(lineNt, rpm);
+		if (lineNt >= nextSlowNt) {
+			engine->periodicSlowCallback();
+			nextSlowNt = lineNt + slowStep;
+		}
+
+		compareOutputs(reader, time, diff);
+
+		rpm = m_rpmIndex < 0 ? 0 : reader.getValue(m_rpmIndex);
+		m_lineCount++;
+	}
+}
+
+void LogReplay::mockSensors(const BinarySensorReader& reader) {
+	for (int i = 0; i < LOG_REPLAY_INPUT_COUNT; i++) {
+		if (m_inputIndex[i] >= 0) {
+			Sensor::setMockValue(inputs[i].type, reader.getValue(m_inputIndex[i]));
+		}
+	}
+}
+
+void LogReplay::spinUntil(efitick_t targetNt, float rpm) {
+	if (targetNt <= m_phaseNt) {
+		return;
+	}
+
+	if (rpm < LOG_REPLAY_MIN_RPM) {
+		m_phaseNt = targetNt;
+		m_eth.setTimeNtAndInvokeEvents(targetNt);
+		return;
+	}
+
+	const TriggerWaveform& shape = engine->triggerCentral.triggerShape;
+	float cycle = shape.getCycleDuration();
+	int size = shape.getSize();
+	// crank degrees per tick: rpm * 360 / 60 per second
+	double degPerNt = rpm * 6.0 / (1e6 * US_TO_NT_MULTIPLIER);
+
+	while (true) {
+		float edgeAngle = shape.wave.getSwitchTime(m_phaseIndex) * cycle;
+		efitick_t edgeNt = m_phaseNt + (efitick_t)((edgeAngle - m_phase) / degPerNt);
+		if (edgeNt > targetNt) {
+			break;
+		}
+
+		m_eth.setTimeNtAndInvokeEvents(edgeNt);
+		m_eth.fireTriggerShapeEvents(m_phaseIndex, edgeNt);
+
+		m_phase = edgeAngle;
+		m_phaseNt = edgeNt;
+		m_phaseIndex++;
+		if (m_phaseIndex == size) {
+			m_phaseIndex = 0;
+			m_phase -= cycle;
+		}
+	}
+
+	m_phase += (targetNt - m_phaseNt) * degPerNt;
+	m_phaseNt = targetNt;
+	m_eth.setTimeNtAndInvokeEvents(targetNt);
+}
+
+void LogReplay::compareOutputs(const BinarySensorReader& reader, float time, FILE* diff) {
+	if (diff != nullptr) {
+		fprintf(diff, "%.3f", time);
+	}
+
+	for (int i = 0; i < LOG_REPLAY_OUTPUT_COUNT; i++) {
+		if (!hasOutput(i)) {
+			continue;
+		}
+
+		float logged = reader.getValue(m_outputIndex[i]);
+		float replayed = outputs[i].getter();
+		float delta = replayed - logged;
+
+		ColumnStats& stats = m_stats[i];
+		stats.samples++;
+		stats.sumAbsDiff += std::abs(delta);
+		stats.maxAbsDiff = std::max(stats.maxAbsDiff, std::abs(delta));
+
+		if (diff != nullptr) {
+			fprintf(diff, ",%.3f,%.3f,%.3f", logged, replayed, delta);
+		}
+	}
+
+	if (diff != nullptr) {
+		fprintf(diff, "\n");
+	}
+}
+
+void LogReplay::printSummary() const {
+	printf("Log replay: %d line(s)\n", m_lineCount);
+	for (int i = 0; i < LOG_REPLAY_OUTPUT_COUNT; i++) {
+		if (!hasOutput(i)) {
+			printf("  %-28s not in log\n", outputs[i].name);
+			continue;
+		}
+		const ColumnStats& stats = m_stats[i];
+		printf("  %-28s max diff %9.3f mean diff %9.3f\n", outputs[i].name, stats.maxAbsDiff, stats.meanAbsDiff());
+	}
+}
@@ -0,0 +1,82 @@
+/*
+ * log_replay.h
+ *
+ * Whole engine replay of a recorded .mlg log: logged sensors are mocked, shaft edges are synthesized
+ * from the configured trigger shape at logged RPM, and recomputed fuel and ignition outputs are
+ * compared against the logged ones line by line.
+ */
+
+#pragma once
+
+#include "mlg_reader.h"
+
+#include <cstdio>
+
+class EngineTestHelper;
+
+#define LOG_REPLAY_INPUT_COUNT 6
+#define LOG_REPLAY_OUTPUT_COUNT 6
+
+class LogReplay {
+public:
+	struct ColumnStats {
+		int samples = 0;
+		float maxAbsDiff = 0;
+		double sumAbsDiff = 0;
+
+		float meanAbsDiff() const {
+			return samples == 0 ? 0 : sumAbsDiff / samples;
+		}
+	};
+
+	explicit LogReplay(EngineTestHelper& eth);
+
+	/**
+	 * persistent_config_s image as produced by MsqSandbox.java
+	 */
+	void loadTune(const char* fileName);
+
+	/**
+	 * @param diffFileName columnar CSV with logged, replayed and difference of each output column, nullptr for none
+	 */
+	void replay(const char* mlgFileName, const char* diffFileName);
+	void replay(BinarySensorReader& reader, FILE* diff);
+
+	void printSummary() const;
+
+	static int getOutputCount() {
+		return LOG_REPLAY_OUTPUT_COUNT;
+	}
+	static const char* getOutputName(int column);
+	// @return false if the log does not have this output
+	bool hasOutput(int column) const {
+		return m_outputIndex[column] >= 0;
+	}
+	const ColumnStats& getStats(int column) const {
+		return m_stats[column];
+	}
+	int getLineCount() const {
+		return m_lineCount;
+	}
+
+private:
+	void resolveFields(BinarySensorReader& reader);
+	void writeDiffHeader(FILE* diff) const;
+	void mockSensors(const BinarySensorReader& reader);
+	void spinUntil(efitick_t targetNt, float rpm);
+	void compareOutputs(const BinarySensorReader& reader, float time, FILE* diff);
+
+	EngineTestHelper& m_eth;
+
+	int m_timeIndex = -1;
+	int m_rpmIndex = -1;
+	int m_inputIndex[LOG_REPLAY_INPUT_COUNT];
+	int m_outputIndex[LOG_REPLAY_OUTPUT_COUNT];
+	ColumnStats m_stats[LOG_REPLAY_OUTPUT_COUNT];
+	int m_lineCount = 0;
+
+	// crank angle within trigger cycle at m_phaseNt, next edge is m_phaseIndex
+	float m_phase = 0;
+	int m_phaseIndex = 0;
+	efitick_t m_phaseNt = 0;
+};
@@ -11,6 +11,7 @@
 #include <ctime>     // For std::put_time and std::localtime
 #include "mlg_reader.h"
 #define FIXED_HEADER_SIZE 24
+#define FIELD_HEADER_SIZE 89
 
 int readSwappedInt(std::ifstream *ifs) {
 	int32_t value;
@@ -110,33 +111,59 @@ int BinarySensorReader::readRecordsMetadata(std::ifstream &ifs,
 	return lineTotalSize;
 }
 
-void BinarySensorReader::readLoggerFieldData() {
-	/*uint16_t timestamp =*/static_cast<uint16_t>(readSwappedShort(&ifs));
+#define BLOCK_HEADER_SIZE 2
+#define BLOCK_TIMESTAMP_SIZE 2
+#define BLOCK_CRC_SIZE 1
 
-//    std::cout << "Reading for record " << recordCounter << std::endl;
+int BinarySensorReader::getFieldIndex(const std::string& fieldName) const {
+	for (size_t i = 0; i < records.size(); i++) {
+		if (records[i]->getFieldName() == fieldName) {
+			return i;
+		}
+	}
+	return -1;
+}
+
+bool BinarySensorReader::readLine() {
+	if (eof()) {
+		return false;
+	}
+
+	// one read per line, fields are decoded from the buffer
+	if (!ifs.read(reinterpret_cast<char*>(lineBuffer.data()), BLOCK_HEADER_SIZE)) {
+		throw std::runtime_error("Truncated block header " + std::to_string(recordCounter));
+	}
+	uint8_t blockType = lineBuffer[0];
+	if (blockType == 1) {
+		throw std::runtime_error("todo support markers");
+	} else if (blockType != 0) {
+		throw std::runtime_error(
+				"Unexpected block type " + std::to_string(blockType));
+	}
 
-	for (Record *record : records) {
-		float value = record->read(ifs);
-		currentSnapshot[record->getFieldName()] = value;
+	std::streamsize remaining = lineBuffer.size() - BLOCK_HEADER_SIZE;
+	if (!ifs.read(reinterpret_cast<char*>(lineBuffer.data() + BLOCK_HEADER_SIZE), remaining)) {
+		throw std::runtime_error("Truncated line " + std::to_string(recordCounter));
 	}
 
-	/*uint8_t crc = */static_cast<uint8_t>(readByte(&ifs)); // Use the new helper
+	const uint8_t *p = lineBuffer.data() + BLOCK_HEADER_SIZE + BLOCK_TIMESTAMP_SIZE;
+	for (size_t i = 0; i < records.size(); i++) {
+		values[i] = records[i]->decode(p);
+		p += records[i]->getSize();
+	}
+	/* crc is the last byte, not validated */
 
 	recordCounter++;
-	//logContent.emplace_back(currentSnapshot);
+	return true;
 }
 
 std::map<const std::string, float>& BinarySensorReader::readBlock() {
-	uint8_t blockType = static_cast<uint8_t>(readByte(&ifs)); // Use the new helper
-	uint8_t counter = static_cast<uint8_t>(readByte(&ifs)); // Use the new helper
+	if (!readLine()) {
+		throw std::runtime_error("Unexpected end of log");
+	}
 
-	if (blockType == 0) {
-		readLoggerFieldData();
-	} else if (blockType == 1) {
-		throw std::runtime_error("todo support markers");
-	} else {
-		throw std::runtime_error(
-				"Unexpected block type " + std::to_string(blockType));
+	for (size_t i = 0; i < records.size(); i++) {
+		currentSnapshot[records[i]->getFieldName()] = values[i];
 	}
 
 	return currentSnapshot;
@@ -185,7 +212,7 @@ void BinarySensorReader::openMlg(const std::string fileName) {
 	uint16_t numberOfFields = readSwappedShort(&ifs);
 	std::cout << "numberOfFields=" << numberOfFields << std::endl;
 
-	int fieldsHeaderAreaSize = 89 * numberOfFields;
+	int fieldsHeaderAreaSize = FIELD_HEADER_SIZE * numberOfFields;
 	std::cout << "fields area size " << fieldsHeaderAreaSize
 			<< ", recordLength=" << recordLength << std::endl;
 
@@ -198,6 +225,8 @@ void BinarySensorReader::openMlg(const std::string fileName) {
 	}
 
 	int lineTotalSize = readRecordsMetadata(ifs, numberOfFields);
+	values.assign(numberOfFields, 0);
+	lineBuffer.resize(BLOCK_HEADER_SIZE + BLOCK_TIMESTAMP_SIZE + lineTotalSize + BLOCK_CRC_SIZE);
 
 	if (isInfoBlockExpected) {
 
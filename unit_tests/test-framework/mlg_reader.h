@@ -24,6 +24,27 @@ public:
   std::map<const std::string, float>& readBlock();
   bool eof();
 
+  /**
+   * Streaming API: resolve field names to indices once after openMlg, then readLine() decodes
+   * each data block into getValue(index) without allocating or looking up names per line
+   */
+  // @return -1 if log has no such field
+  int getFieldIndex(const std::string& fieldName) const;
+  int getFieldCount() const {
+    return records.size();
+  }
+  const std::string& getFieldName(int index) const {
+    return records[index]->getFieldName();
+  }
+  float getValue(int index) const {
+    return values[index];
+  }
+  // @return false at the end of the log
+  bool readLine();
+  int getLineCounter() const {
+    return recordCounter;
+  }
+
   ~BinarySensorReader() {
   for (auto record : records) {
     delete record;
@@ -31,12 +52,15 @@ public:
 }
 private:
   std::ifstream ifs;
-  void readLoggerFieldData();
   int readRecordsMetadata(std::ifstream &ifs, int numberOfFields);
 
   std::vector<Record*> records;
   std::map<std::string, const Record*> recordByName;
   std::map<const std::string, float> currentSnapshot;
+  // values of the last line, in records order
+  std::vector<float> values;
+  // whole data block: type, counter, timestamp, fields and crc
+  std::vector<uint8_t> lineBuffer;
   //std::vector<LogLine> logContent;
   int recordCounter = 0;
 };
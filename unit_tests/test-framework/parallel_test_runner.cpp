@@ -0,0 +1,391 @@
+/*
+ * parallel_test_runner.cpp
+ *
+ * Same leakage detection as run_sharded_tests.sh used to offer by starting a process per shard, without
+ * paying for process start and for idle cores: every test runs in a forked child while up to 'jobs'
+ * children run at once. Slowest tests of the previous run are started first so that the pool drains evenly.
+ *
+ * Outputs, all in TEST_RESULTS_DIR:
+ *   unit_tests.xml       JUnit XML merged from per test reports
+ *   test_durations.txt   "<suite.test> <ms>" per line, input for ordering of the next run
+ *
+ * Each child gets its own scratch directory exported as TEST_TMPDIR, see ::testing::TempDir(), so that tests
+ * writing files do not collide. Children keep the shared working directory since test resources are read
+ * relative to it. Scratch directories of passed tests are removed.
+ */
+
+#include "pch.h"
+#include "parallel_test_runner.h"
+#include "unit_test_logger.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+#if !IS_WINDOWS_COMPILER
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <fcntl.h>
+#endif
+
+#define PARALLEL_DIR TEST_RESULTS_DIR "/parallel"
+#define DURATIONS_FILE TEST_RESULTS_DIR "/test_durations.txt"
+#define MERGED_XML_FILE TEST_RESULTS_DIR "/unit_tests.xml"
+
+#if IS_WINDOWS_COMPILER
+
+int runTestsInParallel(int) {
+	printf("Parallel test runner needs fork(), please use run_sharded_tests.sh\n");
+	return -1;
+}
+
+#else
+
+namespace {
+	using Clock = std::chrono::steady_clock;
+
+	struct ParallelTest {
+		std::string suite;
+		std::string name;
+		// from previous run, negative if unknown
+		double lastDurationMs = -1;
+
+		pid_t pid = 0;
+		Clock::time_point start;
+		double durationMs = 0;
+		bool passed = false;
+		int signal = 0;
+		int exitCode = 0;
+
+		std::string fullName() const {
+			return suite + "." + name;
+		}
+	};
+
+	// glob with '*' and '?' same as gtest filter
+	bool matchesPattern(const char *pattern, const char *str) {
+		switch (*pattern) {
+		case '\0':
+		case ':':
+			return *str == '\0';
+		case '?':
+			return *str != '\0' && matchesPattern(pattern + 1, str + 1);
+		case '*':
+			return (*str != '\0' && matchesPattern(pattern, str + 1)) || matchesPattern(pattern + 1, str);
+		default:
+			return *pattern == *str && matchesPattern(pattern + 1, str + 1);
+		}
+	}
+
+	bool matchesAny(const std::string& patterns, const std::string& name) {
+		const char *cur = patterns.c_str();
+		while (true) {
+			if (matchesPattern(cur, name.c_str())) {
+				return true;
+			}
+			cur = strchr(cur, ':');
+			if (cur == nullptr) {
+				return false;
+			}
+			cur++;
+		}
+	}
+
+	// "positive:patterns-negative:patterns", see --gtest_filter
+	bool matchesFilter(const std::string& filter, const std::string& name) {
+		size_t dash = filter.find('-');
+		std::string positive = filter.substr(0, dash);
+		if (positive.empty()) {
+			positive = "*";
+		}
+		if (!matchesAny(positive, name)) {
+			return false;
+		}
+		return dash == std::string::npos || !matchesAny(filter.substr(dash + 1), name);
+	}
+
+	std::vector<ParallelTest> collectTests() {
+		std::string filter = ::testing::GTEST_FLAG(filter);
+		std::vector<ParallelTest> tests;
+
+		auto unitTest = ::testing::UnitTest::GetInstance();
+		for (int i = 0; i < unitTest->total_test_suite_count(); i++) {
+			auto suite = unitTest->GetTestSuite(i);
+			for (int j = 0; j < suite->total_test_count(); j++) {
+				auto info = suite->GetTestInfo(j);
+				ParallelTest test;
+				test.suite = suite->name();
+				test.name = info->name();
+				if (test.suite.rfind("DISABLED_", 0) == 0 || test.name.rfind("DISABLED_", 0) == 0) {
+					continue;
+				}
+				if (!matchesFilter(filter, test.fullName())) {
+					continue;
+				}
+				tests.push_back(test);
+			}
+		}
+		return tests;
+	}
+
+	void loadDurations(std::vector<ParallelTest>& tests) {
+		std::unordered_map<std::string, double> durations;
+		std::ifstream in(DURATIONS_FILE);
+		std::string name;
+		double ms;
+		while (in >> name >> ms) {
+			durations[name] = ms;
+		}
+
+		for (auto& test : tests) {
+			auto it = durations.find(test.fullName());
+			if (it != durations.end()) {
+				test.lastDurationMs = it->second;
+			}
+		}
+
+		// longest first, new tests are assumed to be long
+		std::stable_sort(tests.begin(), tests.end(), [](const ParallelTest& a, const ParallelTest& b) {
+			double aKey = a.lastDurationMs < 0 ? 1e12 : a.lastDurationMs;
+			double bKey = b.lastDurationMs < 0 ? 1e12 : b.lastDurationMs;
+			return aKey > bKey;
+		});
+	}
+
+	void saveDurations(const std::vector<ParallelTest>& tests) {
+		std::ofstream out(DURATIONS_FILE);
+		for (const auto& test : tests) {
+			out << test.fullName() << " " << test.durationMs << "\n";
+		}
+	}
+
+	std::string logFileName(size_t index) {
+		return PARALLEL_DIR "/" + std::to_string(index) + ".log";
+	}
+
+	std::string scratchDirName(size_t index) {
+		return PARALLEL_DIR "/" + std::to_string(index) + ".tmp";
+	}
+
+	std::string xmlEscape(const std::string& text) {
+		std::string result;
+		for (char c : text) {
+			switch (c) {
+			case '&': result += "&amp;"; break;
+			case '<': result += "&lt;"; break;
+			case '>': result += "&gt;"; break;
+			case '"': result += "&quot;"; break;
+			default: result += c;
+			}
+		}
+		return result;
+	}
+
+	std::string xmlFileName(size_t index) {
+		return PARALLEL_DIR "/" + std::to_string(index) + ".xml";
+	}
+
+	std::string readFile(const std::string& fileName) {
+		std::ifstream in(fileName);
+		std::stringstream ss;
+		ss << in.rdbuf();
+		return ss.str();
+	}
+
+	/**
+	 * gtest installs its XML printer only while parsing --gtest_output in InitGoogleTest, that is before
+	 * we know which test a child runs, so children report their single test case themselves
+	 */
+	class TestCaseReport : public ::testing::EmptyTestEventListener {
+	public:
+		explicit TestCaseReport(std::string fileName) : m_fileName(std::move(fileName)) {
+		}
+
+		void OnTestPartResult(const ::testing::TestPartResult& result) override {
+			if (result.failed()) {
+				m_failures << (result.file_name() == nullptr ? "unknown" : result.file_name())
+					<< ":" << result.line_number() << "\n" << result.message() << "\n";
+			}
+		}
+
+		void OnTestEnd(const ::testing::TestInfo& info) override {
+			const ::testing::TestResult *result = info.result();
+			std::ofstream out(m_fileName);
+			out << "  <testsuite name=\"" << xmlEscape(info.test_suite_name()) << "\" tests=\"1\" failures=\""
+				<< (result->Failed() ? 1 : 0) << "\" errors=\"0\" skipped=\"" << (result->Skipped() ? 1 : 0) << "\">\n"
+				<< "    <testcase name=\"" << xmlEscape(info.name()) << "\" classname=\"" << xmlEscape(info.test_suite_name())
+				<< "\" time=\"" << result->elapsed_time() / 1000.0 << "\">\n";
+			if (result->Failed()) {
+				out << "      <failure message=\"failed\">" << xmlEscape(m_failures.str()) << "</failure>\n";
+			} else if (result->Skipped()) {
+				out << "      <skipped/>\n";
+			}
+			out << "    </testcase>\n"
+				<< "  </testsuite>\n";
+		}
+
+	private:
+		std::string m_fileName;
+		std::stringstream m_failures;
+	};
+
+	[[noreturn]] void runChild(const ParallelTest& test, size_t index) {
+		int log = open(logFileName(index).c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (log >= 0) {
+			dup2(log, STDOUT_FILENO);
+			dup2(log, STDERR_FILENO);
+			close(log);
+		}
+		unlink(xmlFileName(index).c_str());
+
+		std::error_code ec;
+		std::filesystem::path scratchDir = std::filesystem::absolute(scratchDirName(index), ec);
+		std::filesystem::remove_all(scratchDir, ec);
+		std::filesystem::create_directories(scratchDir, ec);
+		if (ec) {
+			printf("Failed to create %s: %s\n", scratchDir.c_str(), ec.message().c_str());
+			exit(-1);
+		}
+		setenv("TEST_TMPDIR", scratchDir.c_str(), 1);
+
+		::testing::GTEST_FLAG(filter) = test.fullName();
+		::testing::UnitTest::GetInstance()->listeners().Append(new TestCaseReport(xmlFileName(index)));
+		// exit() and not _exit() so that sanitizers still report leaks
+		exit(RUN_ALL_TESTS());
+	}
+
+	// report of a test which did not get to write one
+	std::string crashReport(const ParallelTest& test) {
+		std::stringstream ss;
+		ss << "  <testsuite name=\"" << xmlEscape(test.suite) << "\" tests=\"1\" failures=\"1\" errors=\"0\">\n"
+			<< "    <testcase name=\"" << xmlEscape(test.name) << "\" classname=\"" << xmlEscape(test.suite) << "\" time=\""
+			<< test.durationMs / 1000 << "\">\n"
+			<< "      <failure message=\"process died, " << (test.signal ? "signal " : "exit code ")
+			<< (test.signal ? test.signal : test.exitCode) << "\"/>\n"
+			<< "    </testcase>\n"
+			<< "  </testsuite>\n";
+		return ss.str();
+	}
+
+	// test passed but the process did not exit cleanly, for example sanitizer found a leak
+	std::string exitReport(const ParallelTest& test) {
+		std::stringstream ss;
+		ss << "  <testsuite name=\"" << xmlEscape(test.suite) << "\" tests=\"1\" failures=\"1\" errors=\"0\">\n"
+			<< "    <testcase name=\"" << xmlEscape(test.name) << "\" classname=\"" << xmlEscape(test.suite) << "\" time=\""
+			<< test.durationMs / 1000 << "\">\n"
+			<< "      <failure message=\"exit code " << test.exitCode << "\"/>\n"
+			<< "    </testcase>\n"
+			<< "  </testsuite>\n";
+		return ss.str();
+	}
+
+	void mergeXml(const std::vector<ParallelTest>& tests, int failures, double wallMs) {
+		std::ofstream out(MERGED_XML_FILE);
+		out << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+			<< "<testsuites tests=\"" << tests.size() << "\" failures=\"" << failures
+			<< "\" errors=\"0\" time=\"" << wallMs / 1000 << "\" name=\"AllTests\">\n";
+
+		for (size_t i = 0; i < tests.size(); i++) {
+			const ParallelTest& test = tests[i];
+			std::string xml = readFile(xmlFileName(i));
+			if (xml.empty()) {
+				out << crashReport(test);
+			} else if (!test.passed && xml.find("<failure") == std::string::npos) {
+				out << exitReport(test);
+			} else {
+				out << xml;
+			}
+		}
+
+		out << "</testsuites>\n";
+	}
+}
+
+int runTestsInParallel(int jobs) {
+	if (jobs <= 0) {
+		jobs = std::max(1L, sysconf(_SC_NPROCESSORS_ONLN));
+	}
+
+	mkdir(TEST_RESULTS_DIR, 0777);
+	mkdir(PARALLEL_DIR, 0777);
+
+	std::vector<ParallelTest> tests = collectTests();
+	loadDurations(tests);
+	printf("Running %d test(s) in %d worker(s)\n", (int)tests.size(), jobs);
+
+	auto wallStart = Clock::now();
+	size_t next = 0;
+	int running = 0;
+	int failures = 0;
+	std::unordered_map<pid_t, size_t> indexByPid;
+
+	while (next < tests.size() || running > 0) {
+		while (running < jobs && next < tests.size()) {
+			ParallelTest& test = tests[next];
+			// do not duplicate buffered output into children
+			fflush(stdout);
+			fflush(stderr);
+			test.start = Clock::now();
+			pid_t pid = fork();
+			if (pid < 0) {
+				perror("fork");
+				return -1;
+			}
+			if (pid == 0) {
+				runChild(test, next);
+			}
+			test.pid = pid;
+			indexByPid[pid] = next;
+			next++;
+			running++;
+		}
+
+		int status;
+		pid_t pid = waitpid(-1, &status, 0);
+		if (pid < 0) {
+			perror("waitpid");
+			return -1;
+		}
+		auto it = indexByPid.find(pid);
+		if (it == indexByPid.end()) {
+			continue;
+		}
+		size_t index = it->second;
+		indexByPid.erase(it);
+		running--;
+
+		ParallelTest& test = tests[index];
+		test.durationMs = std::chrono::duration<double, std::milli>(Clock::now() - test.start).count();
+		test.passed = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+		test.signal = WIFSIGNALED(status) ? WTERMSIG(status) : 0;
+		test.exitCode = WIFEXITED(status) ? WEXITSTATUS(status) : 0;
+
+		if (test.passed) {
+			std::error_code ec;
+			std::filesystem::remove_all(scratchDirName(index), ec);
+		} else {
+			failures++;
+			printf("[  FAILED  ] %s, output:\n%s\n", test.fullName().c_str(), readFile(logFileName(index)).c_str());
+		}
+	}
+
+	double wallMs = std::chrono::duration<double, std::milli>(Clock::now() - wallStart).count();
+
+	saveDurations(tests);
+	mergeXml(tests, failures, wallMs);
+
+	printf("%d test(s) in %.1f seconds, %d failed, see %s\n", (int)tests.size(), wallMs / 1000, failures, MERGED_XML_FILE);
+	for (const auto& test : tests) {
+		if (!test.passed) {
+			printf("[  FAILED  ] %s\n", test.fullName().c_str());
+		}
+	}
+
+	return failures == 0 ? 0 : -1;
+}
+
+#endif // IS_WINDOWS_COMPILER
@@ -0,0 +1,15 @@
+/*
+ * parallel_test_runner.h
+ *
+ * Runs every test case in its own forked process using a pool of workers, one per core.
+ */
+
+#pragma once
+
+/**
+ * Has to be invoked after testing::InitGoogleTest and before any test was executed: children are forked
+ * from this pristine process so each test starts from the same global state as a fresh executable would.
+ * @param jobs worker count, 0 for one per core
+ * @return 0 if all tests passed
+ */
+int runTestsInParallel(int jobs);
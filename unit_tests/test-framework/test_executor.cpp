@@ -53,6 +53,9 @@ void TestExecutor::schedule(const char *msg, scheduling_s* scheduling, efitick_t
     	scheduleTime = US2NT(NT2US(timeNt));
    	}
 	schedulingQueue.insertTask(scheduling, scheduleTime, action);
+
+	m_scheduledCount++;
+	m_maxQueueDepth = std::max(m_maxQueueDepth, schedulingQueue.size());
 }
 
 void TestExecutor::cancel(scheduling_s* s) {
@@ -64,6 +67,11 @@ void TestExecutor::cancel(scheduling_s* s) {
 	schedulingQueue.remove(s);
 }
 
+void TestExecutor::resetStats() {
+	m_scheduledCount = 0;
+	m_maxQueueDepth = schedulingQueue.size();
+}
+
 void TestExecutor::setMockExecutor(Scheduler* exec) {
 	m_mockExecutor = exec;
 }
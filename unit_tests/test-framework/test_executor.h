@@ -26,7 +26,20 @@ public:
 	scheduling_s * getForUnitTest(int index);
 
 	void setMockExecutor(Scheduler* exec);
+
+	/**
+	 * counters since last resetStats(), used by engine benchmark
+	 */
+	int getScheduledCount() const {
+		return m_scheduledCount;
+	}
+	int getMaxQueueDepth() const {
+		return m_maxQueueDepth;
+	}
+	void resetStats();
 private:
 	EventQueue schedulingQueue;
 	Scheduler* m_mockExecutor = nullptr;
+	int m_scheduledCount = 0;
+	int m_maxQueueDepth = 0;
 };
@@ -0,0 +1,87 @@
+/*
+ * trigger_sync_points.cpp
+ *
+ * Unit tests simulate unless 'useBakedTriggerSyncPoints' is set, so whatever is in the generated table
+ * does not influence what gets written into the next one.
+ */
+
+#include "pch.h"
+#include "trigger_sync_points.h"
+
+static bool simulateTriggerSyncPoint(trigger_type_e type, bool camMode, BakedTriggerSyncPoint& result) {
+	persistent_config_s pc{};
+	Engine e;
+	EngineTestHelperBase base(&e, &pc.engineConfiguration, &pc);
+
+	engineConfiguration->trigger.type = type;
+	if (camMode) {
+		setCamOperationMode();
+	} else {
+		setCrankOperationMode();
+	}
+
+	try {
+		engine->updateTriggerConfiguration();
+	} catch (...) {
+		// sync failure is a firmwareError, firmware would simulate and report it again
+		return false;
+	}
+
+	TriggerWaveform& shape = engine->triggerCentral.triggerShape;
+	if (shape.shapeDefinitionError) {
+		return false;
+	}
+
+	result = { type, shape.getSyncFingerprint(type), (uint16_t)shape.getTriggerWaveformSynchPointIndex() };
+	return true;
+}
+
+std::vector<BakedTriggerSyncPoint> simulateTriggerSyncPoints() {
+	std::vector<BakedTriggerSyncPoint> points;
+
+	// TT_TOOTHED_WHEEL depends on configured tooth count, not worth baking
+	for (int type = (int)trigger_type_e::TT_TOOTHED_WHEEL + 1; type < (int)trigger_type_e::TT_UNUSED; type++) {
+		for (bool camMode : { false, true }) {
+			BakedTriggerSyncPoint point;
+			if (!simulateTriggerSyncPoint((trigger_type_e)type, camMode, point)) {
+				continue;
+			}
+
+			// most shapes define their own operation mode
+			bool isDuplicate = !points.empty() && points.back().type == point.type
+				&& points.back().fingerprint == point.fingerprint;
+			if (!isDuplicate) {
+				points.push_back(point);
+			}
+		}
+	}
+
+	return points;
+}
+
+int writeTriggerSyncPoints(const char *fileName) {
+	std::vector<BakedTriggerSyncPoint> points = simulateTriggerSyncPoints();
+
+	FILE *fp = fopen(fileName, "w");
+	if (fp == nullptr) {
+		printf("Failed to write %s\n", fileName);
+		return -1;
+	}
+
+	fprintf(fp, "//\n");
+	fprintf(fp, "// was generated automatically by rusEFI unit tests, see trigger_sync_points.cpp\n");
+	fprintf(fp, "// run 'make trigger_sync_points' in unit_tests after changing trigger shapes\n");
+	fprintf(fp, "//\n");
+	fprintf(fp, "// trigger type, shape fingerprint, sync point index\n");
+	fprintf(fp, "//\n\n");
+	fprintf(fp, "#pragma once\n\n");
+	fprintf(fp, "#define BAKED_TRIGGER_SYNC_POINTS \\\n");
+	for (const auto& point : points) {
+		fprintf(fp, "\t{ trigger_type_e::%s, 0x%08x, %d }, \\\n", getTrigger_type_e(point.type), point.fingerprint, point.syncIndex);
+	}
+	fprintf(fp, "\n");
+	fclose(fp);
+
+	printf("%d trigger sync points written to %s\n", (int)points.size(), fileName);
+	return 0;
+}
@@ -0,0 +1,24 @@
+/*
+ * trigger_sync_points.h
+ *
+ * Source of firmware/controllers/trigger/trigger_sync_points_generated.h: sync points of built-in trigger
+ * shapes as found by trigger simulation.
+ */
+
+#pragma once
+
+#include <vector>
+
+#define TRIGGER_SYNC_POINTS_FILE_NAME "../firmware/controllers/trigger/trigger_sync_points_generated.h"
+
+/**
+ * Every built-in trigger type in crank and in cam operation mode, duplicates and shapes which do not
+ * sync are left out. VVT shapes are cam mode shapes so these are covered, too.
+ */
+std::vector<BakedTriggerSyncPoint> simulateTriggerSyncPoints();
+
+/**
+ * "trigger_sync_points" command line mode
+ * @return non-zero if file could not be written
+ */
+int writeTriggerSyncPoints(const char *fileName);
@@ -2,6 +2,10 @@ FRAMEWORK_SRC_CPP = test-framework/unit_test_framework.cpp \
 	test-framework/engine_test_helper.cpp \
 	test-framework/logicdata_csv_reader.cpp \
 	test-framework/mlg_reader.cpp \
+	test-framework/log_replay.cpp \
+	test-framework/parallel_test_runner.cpp \
+	test-framework/engine_benchmark.cpp \
+	test-framework/trigger_sync_points.cpp \
 	boards.cpp \
 	test-framework/test_executor.cpp \
 	test_basic_math/test_find_index.cpp \
@@ -0,0 +1,179 @@
+#include "pch.h"
+
+#include <vector>
+
+#include "mlg_field.h"
+#include "mlg_delta.h"
+#include "mlg_delta_decoder.h"
+
+using namespace MLG;
+using namespace MLG::Entries;
+
+namespace {
+class VectorWriter : public Writer {
+public:
+	size_t write(const char* buffer, size_t count) override {
+		data.insert(data.end(), buffer, buffer + count);
+		return count;
+	}
+
+	size_t flush() override {
+		return 0;
+	}
+
+	std::vector<uint8_t> data;
+};
+
+struct TestChannels {
+	scaled_channel<uint16_t, 1> rpm;
+	float map;
+	scaled_channel<int8_t, 2> clt;
+	uint32_t counter;
+	uint8_t flag;
+};
+
+void writeHeader(Writer& out, const char* magic, const Field* fields, size_t count) {
+	char header[Types::Header::Size] = {};
+	memcpy(header, magic, 6);
+	header[7] = 2;
+
+	size_t headerSize = Types::Header::Size + count * Types::Field::DescriptorSize;
+	header[18] = headerSize >> 8;
+	header[19] = headerSize & 0xFF;
+
+	size_t recordLength = 0;
+	for (size_t i = 0; i < count; i++) {
+		recordLength += fields[i].getSize();
+	}
+	header[21] = recordLength;
+	header[23] = count;
+
+	out.write(header, sizeof(header));
+	for (size_t i = 0; i < count; i++) {
+		fields[i].writeHeader(out);
+	}
+}
+} // namespace
+
+TEST(MlgDelta, decodesToStandardMlg) {
+	TestChannels channels{};
+
+	const Field fields[] = {
+		Field(channels.rpm, "RPM", "rpm", 0),
+		Field(channels.map, "MAP", "kPa", 1),
+		Field(channels.clt, "CLT", "C", 1),
+		Field(channels.counter, "counter", "", 0),
+		Field(channels.flag, "flag", "", 0),
+	};
+	size_t recordLength = 2 + 4 + 1 + 4 + 1;
+
+	VectorWriter plain;
+	VectorWriter delta;
+
+	writeHeader(plain, "MLVLG", fields, efi::size(fields));
+	writeHeader(delta, Delta::magic, fields, efi::size(fields));
+
+	// small block so that the log spans several blocks
+	uint8_t block[256];
+	uint8_t previous[32];
+	Delta::Encoder encoder(block, sizeof(block), previous, sizeof(previous));
+	ASSERT_TRUE(encoder.reset(efi::size(fields), recordLength));
+
+	uint8_t rollCounter = 0;
+	uint16_t timestamp = 65000;
+
+	for (int line = 0; line < 500; line++) {
+		// mostly steady values
+		channels.rpm = 800 + (line / 50) * 10;
+		channels.map = line % 7 == 0 ? 35.5f : 35.0f;
+		channels.clt = 80;
+		channels.counter = line;
+		channels.flag = (line / 100) % 2;
+		// wraps around
+		timestamp += 100;
+
+		char buffer[8];
+		buffer[0] = 0;
+		buffer[1] = rollCounter++;
+		buffer[2] = timestamp >> 8;
+		buffer[3] = timestamp & 0xFF;
+		plain.write(buffer, 4);
+
+		encoder.beginRecord(timestamp, delta);
+
+		uint8_t sum = 0;
+		for (const auto& field : fields) {
+			size_t size = field.writeData(buffer, nullptr);
+			for (size_t i = 0; i < size; i++) {
+				sum += buffer[i];
+			}
+			plain.write(buffer, size);
+			encoder.addField(buffer, size);
+		}
+		buffer[0] = sum;
+		plain.write(buffer, 1);
+	}
+	encoder.flush(delta);
+
+	// several-fold smaller
+	EXPECT_LT(delta.data.size() - 24 - 5 * 89, (plain.data.size() - 24 - 5 * 89) / 4);
+
+	VectorWriter decoded;
+	size_t recordCount;
+	ASSERT_TRUE(Delta::decode(delta.data.data(), delta.data.size(), decoded, &recordCount));
+	EXPECT_EQ(500u, recordCount);
+	EXPECT_EQ(plain.data, decoded.data);
+
+	// truncated file keeps the complete blocks
+	VectorWriter truncated;
+	EXPECT_FALSE(Delta::decode(delta.data.data(), delta.data.size() - 3, truncated, &recordCount));
+	EXPECT_GT(recordCount, 0u);
+	EXPECT_LT(recordCount, 500u);
+	EXPECT_EQ(0, memcmp(plain.data.data(), truncated.data.data(), truncated.data.size()));
+
+	// not a delta log
+	EXPECT_FALSE(Delta::decode(plain.data.data(), plain.data.size(), truncated));
+}
+
+TEST(MlgDelta, recordTooLong) {
+	uint8_t block[64];
+	uint8_t previous[16];
+	Delta::Encoder encoder(block, sizeof(block), previous, sizeof(previous));
+
+	EXPECT_TRUE(encoder.reset(10, 16));
+	EXPECT_FALSE(encoder.reset(10, 17));
+	// worst case record does not fit the block
+	EXPECT_FALSE(encoder.reset(500, 16));
+}
+
+TEST(MlgLz, roundTrip) {
+	std::vector<uint8_t> input;
+	// compressible start, random tail, long runs
+	for (int i = 0; i < 3000; i++) {
+		input.push_back(i % 37);
+	}
+	srand(3);
+	for (int i = 0; i < 1000; i++) {
+		input.push_back(rand());
+	}
+	input.insert(input.end(), 700, 0x55);
+
+	uint16_t hashTable[Lz::hashSize];
+
+	for (size_t size : { (size_t)1, (size_t)8, (size_t)9, (size_t)100, (size_t)3000, input.size() }) {
+		VectorWriter compressed;
+		size_t writen = Lz::compress(input.data(), size, compressed, hashTable);
+		ASSERT_EQ(writen, compressed.data.size());
+
+		std::vector<uint8_t> output(size);
+		size_t consumed;
+		ASSERT_TRUE(Lz::decompress(compressed.data.data(), compressed.data.size(), output.data(), size, &consumed)) << size;
+		EXPECT_EQ(consumed, compressed.data.size());
+		EXPECT_EQ(0, memcmp(input.data(), output.data(), size)) << size;
+
+		// truncated input is detected
+		if (compressed.data.size() > 1) {
+			EXPECT_FALSE(Lz::decompress(compressed.data.data(), compressed.data.size() - 1, output.data(), size, &consumed));
+		}
+	}
+}
@@ -0,0 +1,166 @@
+#include "pch.h"
+
+#include "can_hw_filter.h"
+
+#include <algorithm>
+#include <vector>
+
+using FilterBank = SimulatedCanFilterBank<14>;
+
+static CANRxFrame makeFrame(uint32_t id, bool isExtended) {
+	CANRxFrame frame{};
+	frame.IDE = isExtended;
+	if (isExtended) {
+		frame.EID = id;
+	} else {
+		frame.SID = id;
+	}
+	return frame;
+}
+
+static FilterBank program(CanHwFilterSet& filters) {
+	filters.reduce(FilterBank::capacity);
+	EXPECT_LE(filters.size(), FilterBank::capacity);
+
+	FilterBank bank;
+	bank.program(filters.get(), filters.size());
+	return bank;
+}
+
+static bool contains(const std::vector<uint32_t>& ids, uint32_t id) {
+	return std::find(ids.begin(), ids.end(), id) != ids.end();
+}
+
+TEST(CanHwFilter, ExactIdsRejectEverythingElse) {
+	std::vector<uint32_t> wanted = { 0x123, 0x190, 0x191, 0x360, 0x7DF };
+
+	CanHwFilterSet filters;
+	filters.reset(0);
+	for (auto id : wanted) {
+		filters.addStandard(CanHwFilterSet::anyBus, id);
+	}
+
+	auto bank = program(filters);
+
+	for (uint32_t id = 0; id <= CAN_SID_MASK; id++) {
+		EXPECT_EQ(contains(wanted, id), bank.accepts(makeFrame(id, false))) << id;
+	}
+
+	// standard only request does not let extended frames through
+	EXPECT_FALSE(bank.accepts(makeFrame(0x123, true)));
+}
+
+TEST(CanHwFilter, ListenerIdMatchesBothFrameTypes) {
+	CanHwFilterSet filters;
+	filters.reset(0);
+	filters.addId(CanHwFilterSet::anyBus, 0x123);
+	filters.addId(CanHwFilterSet::anyBus, 0x18DAF110);
+
+	auto bank = program(filters);
+
+	EXPECT_TRUE(bank.accepts(makeFrame(0x123, false)));
+	EXPECT_TRUE(bank.accepts(makeFrame(0x123, true)));
+	EXPECT_TRUE(bank.accepts(makeFrame(0x18DAF110, true)));
+	EXPECT_FALSE(bank.accepts(makeFrame(0x124, false)));
+	EXPECT_FALSE(bank.accepts(makeFrame(0x18DAF111, true)));
+	// bits above 11 could never match a standard frame
+	EXPECT_EQ(3u, filters.size());
+}
+
+TEST(CanHwFilter, MaskedRequest) {
+	CanHwFilterSet filters;
+	filters.reset(0);
+	// Lua style canRxAddMask
+	filters.addIdMask(CanHwFilterSet::anyBus, 0x500, 0x7F0);
+
+	auto bank = program(filters);
+
+	for (uint32_t id = 0; id <= CAN_SID_MASK; id++) {
+		EXPECT_EQ(id >= 0x500 && id <= 0x50F, bank.accepts(makeFrame(id, false))) << id;
+	}
+}
+
+TEST(CanHwFilter, MergedFiltersKeepWantedIds) {
+	std::vector<uint32_t> wanted;
+	// a busy setup: dash, VSS, wideband, Lua, all in a few clusters
+	for (uint32_t base : { 0x100, 0x200, 0x280, 0x4F0, 0x6A0 }) {
+		for (uint32_t i = 0; i < 6; i++) {
+			wanted.push_back(base + i * 3);
+		}
+	}
+
+	CanHwFilterSet filters;
+	filters.reset(0);
+	for (auto id : wanted) {
+		filters.addStandard(CanHwFilterSet::anyBus, id);
+	}
+	ASSERT_GT(filters.size(), FilterBank::capacity);
+
+	auto bank = program(filters);
+
+	size_t acceptedUnwanted = 0;
+	for (uint32_t id = 0; id <= CAN_SID_MASK; id++) {
+		bool accepted = bank.accepts(makeFrame(id, false));
+		if (contains(wanted, id)) {
+			EXPECT_TRUE(accepted) << id;
+		} else if (accepted) {
+			acceptedUnwanted++;
+		}
+	}
+
+	// merging costs a few extra IDs but most of the bus is still dropped
+	EXPECT_LT(acceptedUnwanted, 100u);
+	EXPECT_FALSE(bank.accepts(makeFrame(0x7E8, false)));
+	EXPECT_FALSE(bank.accepts(makeFrame(0x000, false)));
+}
+
+TEST(CanHwFilter, TooManyRequestsStillAcceptWanted) {
+	CanHwFilterSet filters;
+	filters.reset(0);
+	for (uint32_t i = 0; i < 3 * CAN_HW_FILTER_REQUEST_MAX; i++) {
+		filters.addExtended(CanHwFilterSet::anyBus, 0x10000 + i * 37);
+	}
+
+	auto bank = program(filters);
+
+	for (uint32_t i = 0; i < 3 * CAN_HW_FILTER_REQUEST_MAX; i++) {
+		EXPECT_TRUE(bank.accepts(makeFrame(0x10000 + i * 37, true))) << i;
+	}
+}
+
+TEST(CanHwFilter, AcceptAllIsPerBus) {
+	CanHwFilterSet filters;
+	filters.reset(1);
+	filters.addStandard(CanHwFilterSet::anyBus, 0x123);
+	// other bus
+	filters.acceptAll(0);
+	EXPECT_FALSE(filters.isAcceptAll());
+	// not for this bus either
+	filters.addStandard(0, 0x456);
+
+	auto bank = program(filters);
+	EXPECT_TRUE(bank.accepts(makeFrame(0x123, false)));
+	EXPECT_FALSE(bank.accepts(makeFrame(0x456, false)));
+
+	filters.acceptAll(1);
+	EXPECT_TRUE(filters.isAcceptAll());
+	bank = program(filters);
+	EXPECT_TRUE(bank.accepts(makeFrame(0x456, false)));
+	EXPECT_TRUE(bank.accepts(makeFrame(0x1ABCDEF, true)));
+}
+
+TEST(CanHwFilter, ChecksumTracksRequests) {
+	CanHwFilterSet filters;
+
+	filters.reset(0);
+	filters.addStandard(CanHwFilterSet::anyBus, 0x123);
+	uint32_t first = filters.getChecksum();
+
+	filters.reset(0);
+	filters.addStandard(CanHwFilterSet::anyBus, 0x123);
+	EXPECT_EQ(first, filters.getChecksum());
+
+	filters.reset(0);
+	filters.addStandard(CanHwFilterSet::anyBus, 0x124);
+	EXPECT_NE(first, filters.getChecksum());
+}
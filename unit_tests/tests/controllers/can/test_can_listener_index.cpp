@@ -0,0 +1,120 @@
+#include "pch.h"
+
+#include "can_listener_index.h"
+
+#include <vector>
+
+namespace {
+struct RecordingListener : public CanListener {
+	RecordingListener(uint32_t id, std::vector<RecordingListener*>* log = nullptr)
+		: CanListener(id)
+		, m_log(log)
+	{
+	}
+
+	bool acceptFrame(const size_t busIndex, const CANRxFrame& frame) const override {
+		offered++;
+		return CanListener::acceptFrame(busIndex, frame) || !hasExactId();
+	}
+
+	void decodeFrame(const CANRxFrame&, efitick_t) override {
+		decoded++;
+		if (m_log) {
+			m_log->push_back(this);
+		}
+	}
+
+	mutable int offered = 0;
+	int decoded = 0;
+
+private:
+	std::vector<RecordingListener*>* const m_log;
+};
+
+CANRxFrame makeFrame(uint32_t id) {
+	CANRxFrame frame{};
+	frame.SID = id;
+	frame.IDE = false;
+	return frame;
+}
+
+void link(std::vector<CanListener*> listeners) {
+	for (size_t i = 0; i + 1 < listeners.size(); i++) {
+		listeners[i]->setNext(listeners[i + 1]);
+	}
+}
+} // namespace
+
+TEST(CanListenerIndex, OnlyMatchingIdIsOffered) {
+	RecordingListener a(0x100), b(0x200), any(CanListener::anyId);
+	link({ &a, &b, &any });
+
+	CanListenerIndex dut;
+	dut.rebuild(&a);
+	EXPECT_EQ(1u, dut.getResidualCount());
+
+	dut.processFrame(0, makeFrame(0x200), 0);
+	EXPECT_EQ(0, a.offered);
+	EXPECT_EQ(1, b.offered);
+	EXPECT_EQ(1, b.decoded);
+	EXPECT_EQ(1, any.offered);
+	EXPECT_EQ(1, any.decoded);
+
+	// no listener for this ID, only the residual one is offered
+	dut.processFrame(0, makeFrame(0x300), 0);
+	EXPECT_EQ(0, a.offered);
+	EXPECT_EQ(1, b.offered);
+	EXPECT_EQ(2, any.decoded);
+}
+
+TEST(CanListenerIndex, SameIdKeepsListOrder) {
+	std::vector<RecordingListener*> log;
+	RecordingListener first(0x123, &log), other(0x124, &log), second(0x123, &log);
+	link({ &first, &other, &second });
+
+	CanListenerIndex dut;
+	dut.rebuild(&first);
+
+	dut.processFrame(0, makeFrame(0x123), 0);
+	ASSERT_EQ(2u, log.size());
+	EXPECT_EQ(&first, log[0]);
+	EXPECT_EQ(&second, log[1]);
+}
+
+TEST(CanListenerIndex, EndIsExcluded) {
+	RecordingListener a(0x100), sentinel(CanListener::anyId);
+	link({ &a, &sentinel });
+
+	CanListenerIndex dut;
+	dut.rebuild(&a, &sentinel);
+	EXPECT_EQ(0u, dut.getResidualCount());
+
+	dut.processFrame(0, makeFrame(0x100), 0);
+	EXPECT_EQ(1, a.decoded);
+	EXPECT_EQ(0, sentinel.offered);
+}
+
+TEST(CanListenerIndex, OverflowGoesToResidual) {
+	std::vector<RecordingListener> listeners;
+	listeners.reserve(CAN_LISTENER_INDEX_SIZE);
+	for (uint32_t i = 0; i < CAN_LISTENER_INDEX_SIZE; i++) {
+		listeners.emplace_back(0x400 + i);
+	}
+	std::vector<CanListener*> list;
+	for (auto& l : listeners) {
+		list.push_back(&l);
+	}
+	link(list);
+
+	CanListenerIndex dut;
+	dut.rebuild(list[0]);
+	EXPECT_EQ(CAN_LISTENER_INDEX_SIZE / 2u, dut.getResidualCount());
+
+	// every listener still gets its frames
+	for (uint32_t i = 0; i < CAN_LISTENER_INDEX_SIZE; i++) {
+		dut.processFrame(0, makeFrame(0x400 + i), 0);
+	}
+	for (auto& l : listeners) {
+		EXPECT_EQ(1, l.decoded);
+	}
+}
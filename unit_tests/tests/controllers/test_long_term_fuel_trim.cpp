@@ -117,3 +117,160 @@ TEST(LTFT, testSlowCallbackLoadError) {
 	EXPECT_FALSE(ltft.ltftLoadPending);
 	EXPECT_TRUE(ltft.ltftLoadError);
 }
+
+static void learnPositive(LongTermFuelTrim& ltft, float rpm, float load) {
+	engineConfiguration->ltft.enabled = true;
+	engineConfiguration->ltft.deadband = 0.5; // %
+	engineConfiguration->ltft.maxAdd = 15.0; // %
+	engineConfiguration->ltft.maxRemove = 5; // %
+	engineConfiguration->ltft.timeConstant[ftRegionIdle] = 30; // seconds
+
+	ClosedLoopFuelResult clInput;
+	clInput.region = ftRegionIdle;
+	clInput.banks[0] = clInput.banks[1] = 1.1;
+	ITERATE_TIME(10, ltft.learn(clInput, rpm, load))
+}
+
+TEST(LTFT, journalReplay) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	LtftState ltftState;
+	LongTermFuelTrim ltft;
+
+	ltftState.load();
+	ltft.init(&ltftState);
+	// what storage would hold as full trims record
+	ltftState.save();
+	EXPECT_FALSE(ltftState.dirty.any());
+
+	learnPositive(ltft, config->veRpmBins[2], config->veLoadBins[3]);
+	learnPositive(ltft, config->veRpmBins[5], config->veLoadBins[1]);
+	EXPECT_TRUE(ltftState.dirty.any());
+
+	EXPECT_TRUE(ltftState.flushDirty());
+	EXPECT_FALSE(ltftState.dirty.any());
+	// two cells in each bank
+	EXPECT_EQ(2 * FT_BANK_COUNT, ltftState.journal.count);
+
+	// same cell learned again takes the same record
+	learnPositive(ltft, config->veRpmBins[2], config->veLoadBins[3]);
+	EXPECT_TRUE(ltftState.flushDirty());
+	EXPECT_EQ(2 * FT_BANK_COUNT, ltftState.journal.count);
+
+	// fresh state with zero trims as stored by save() above, plus journal
+	LtftState restored;
+	restored.load();
+	restored.journal = ltftState.journal;
+	ASSERT_TRUE(restored.replayJournal());
+	restored.onTrimsReplaced();
+
+	EXPECT_GT(ltftState.trims[0][3][2], 0.01f);
+	for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
+		EXPECT_NEAR(ltftState.trims[bank][3][2], restored.trims[bank][3][2], 1e-5);
+		EXPECT_NEAR(ltftState.trims[bank][1][5], restored.trims[bank][1][5], 1e-5);
+		EXPECT_EQ(0, restored.trims[bank][4][4]);
+	}
+	EXPECT_TRUE(restored.learned.get(3 * VE_RPM_COUNT + 2));
+	EXPECT_FALSE(restored.learned.get(4 * VE_RPM_COUNT + 4));
+
+	// journal written on top of other trims is ignored
+	restored.trims[0][0][0] = 0.05f;
+	EXPECT_FALSE(restored.replayJournal());
+}
+
+TEST(LTFT, journalCompaction) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	LtftState ltftState;
+	ltftState.load();
+	ltftState.save();
+
+	// more cells than journal holds
+	for (size_t cell = 0; cell < LTFT_JOURNAL_SIZE + 1; cell++) {
+		ltftState.setTrim(0, cell / VE_RPM_COUNT, cell % VE_RPM_COUNT, 0.01f);
+	}
+	EXPECT_FALSE(ltftState.flushDirty());
+
+	// full write takes everything and starts empty journal
+	ltftState.save();
+	EXPECT_FALSE(ltftState.dirty.any());
+	EXPECT_EQ(0, ltftState.journal.count);
+	EXPECT_TRUE(ltftState.replayJournal());
+}
+
+TEST(LTFT, journalFlushedOnSlowCallbackAndShutoff) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	LtftState ltftState;
+	LongTermFuelTrim ltft;
+	ltftState.load();
+	ltft.init(&ltftState);
+	ltftState.save();
+
+	ltftState.setTrim(1, 2, 3, 0.02f);
+
+	// too early
+	engine->module<MainRelayController>()->hasIgnitionVoltage = true;
+	ltft.onSlowCallback();
+	EXPECT_TRUE(ltftState.dirty.any());
+
+	// ignition off: keep main relay on and flush right away
+	engine->module<MainRelayController>()->hasIgnitionVoltage = false;
+	EXPECT_TRUE(ltft.needsDelayedShutoff());
+	ltft.onSlowCallback();
+	EXPECT_FALSE(ltftState.dirty.any());
+	EXPECT_EQ(1, ltftState.journal.count);
+	EXPECT_FALSE(ltft.needsDelayedShutoff());
+
+	ltftState.setTrim(1, 2, 4, 0.02f);
+	advanceTimeUs(11'000'000);
+	ltft.onSlowCallback();
+	EXPECT_EQ(2, ltftState.journal.count);
+}
+
+TEST(LTFT, requestedStoreRunsFromSlowCallback) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	LtftState ltftState;
+	LongTermFuelTrim ltft;
+	ltftState.load();
+	ltft.init(&ltftState);
+	ltftState.save();
+
+	ltftState.setTrim(0, 1, 1, 0.03f);
+	advanceTimeUs(11'000'000);
+	ltft.onSlowCallback();
+	EXPECT_EQ(1, ltftState.journal.count);
+
+	// full save takes the journaled cell into the base and starts an empty journal
+	ltft.requestStore();
+	EXPECT_EQ(1, ltftState.journal.count);
+	ltft.onSlowCallback();
+	EXPECT_EQ(0, ltftState.journal.count);
+	EXPECT_FALSE(ltftState.dirty.any());
+	EXPECT_TRUE(ltftState.replayJournal());
+}
+
+TEST(LTFT, applyToVeTouchesLearnedCellsOnly) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	LtftState ltftState;
+	ltftState.load();
+
+	setTable(config->veTable, 80);
+	for (size_t bank = 0; bank < FT_BANK_COUNT; bank++) {
+		ltftState.setTrim(bank, 2, 3, 0.1f);
+	}
+	EXPECT_TRUE(ltftState.learned.get(2 * VE_RPM_COUNT + 3));
+	EXPECT_FALSE(ltftState.learned.get(2 * VE_RPM_COUNT + 4));
+
+	ltftState.applyToVe();
+	EXPECT_NEAR(88, config->veTable[2][3], 0.1);
+	EXPECT_NEAR(80, config->veTable[2][4], 0.1);
+
+	// cleared cells go to storage as well
+	ltftState.flushDirty();
+	ltftState.reset();
+	EXPECT_TRUE(ltftState.dirty.get(2 * VE_RPM_COUNT + 3));
+	EXPECT_FALSE(ltftState.learned.get(2 * VE_RPM_COUNT + 3));
+}
@@ -88,4 +88,74 @@ TEST(MainLoop, operatorTest){
 
     auto operatorResult = LoopPeriod::None & LoopPeriod::Period500hz;
     EXPECT_FALSE(operatorResult);
-}
\ No newline at end of file
+}
+
+namespace {
+    std::vector<const char*> ranTasks;
+
+    class MainLoopTasks : public ::testing::Test {
+    protected:
+        void TearDown() override {
+            // mainLoop is global, don't leave it with tasks of a finished test even if an assertion failed
+            mainLoop.setTasks(nullptr, 0);
+        }
+    };
+}
+
+TEST_F(MainLoopTasks, runInOrderWithBudget){
+    EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+    ranTasks.clear();
+
+    MainLoopTask tasks[] = {
+        { "fast", LoopPeriod::Period500hz, 100, [](efitick_t) { ranTasks.push_back("fast"); advanceTimeUs(50); } },
+        { "slow", LoopPeriod::Period20hz, 100, [](efitick_t) { ranTasks.push_back("slow"); advanceTimeUs(300); } },
+    };
+    mainLoop.setTasks(tasks, efi::size(tasks));
+
+    // every period is due
+    mainLoop.m_cycleCounter = 0;
+    mainLoop.PeriodicTask(getTimeNowNt());
+    ASSERT_EQ(2u, ranTasks.size());
+    EXPECT_STREQ("fast", ranTasks[0]);
+    EXPECT_STREQ("slow", ranTasks[1]);
+
+    // only 500hz is due
+    mainLoop.m_cycleCounter = 2;
+    mainLoop.PeriodicTask(getTimeNowNt());
+    ASSERT_EQ(3u, ranTasks.size());
+    EXPECT_STREQ("fast", ranTasks[2]);
+
+    EXPECT_EQ(50u, tasks[0].lastUs);
+    EXPECT_EQ(0u, tasks[0].overrunCount);
+    EXPECT_EQ(300u, tasks[1].maxUs);
+    EXPECT_EQ(1u, tasks[1].overrunCount);
+}
+
+TEST_F(MainLoopTasks, slowTaskOverrunsOnlyItsOwnBudget){
+    EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+    MainLoopTask tasks[] = {
+        { "fast", LoopPeriod::Period200hz, 200, [](efitick_t) { advanceTimeUs(150); } },
+        { "slow", LoopPeriod::Period20hz, MAIN_LOOP_PERIOD_US, [](efitick_t) { advanceTimeUs(1500); } },
+    };
+    mainLoop.setTasks(tasks, efi::size(tasks));
+    mainLoop.m_cycleCounter = 0;
+
+    for (int cycle = 0; cycle < MAIN_LOOP_RATE; cycle++) {
+        mainLoop.PeriodicTask(getTimeNowNt());
+    }
+
+    // one second: slow ran 20 times and was over its budget every time, fast never was
+    EXPECT_EQ(0u, tasks[0].overrunCount);
+    EXPECT_EQ(20u, tasks[1].overrunCount);
+    EXPECT_EQ(1500u, tasks[1].maxUs);
+}
+
+TEST_F(MainLoopTasks, budgetAboveLoopPeriodIsRejected){
+    EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+    MainLoopTask tasks[] = {
+        { "slow", LoopPeriod::Period20hz, 2 * MAIN_LOOP_PERIOD_US, [](efitick_t) { } },
+    };
+    EXPECT_FATAL_ERROR(mainLoop.setTasks(tasks, efi::size(tasks)));
+}
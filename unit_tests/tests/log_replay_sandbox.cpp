@@ -1,11 +1,17 @@
 #include "pch.h"
+#include "log_replay.h"
 
 /**
  * manual preparation step: MsqSandbox.java to convert msq/xml tune into binary configuration snapshot
  */
 
 
-void runLogReplay() {
-  // todo: load "output.bin" configuration and apply config changes
+void runLogReplay(const char *logFileName) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
 
+	LogReplay replay(eth);
+	replay.loadTune("output.bin");
+	replay.replay(logFileName, "replay_diff.csv");
+
+	replay.printSummary();
 }
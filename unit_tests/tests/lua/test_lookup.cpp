@@ -31,3 +31,16 @@ TEST(LuaBasic, configLookup) {
 		ASSERT_EQ(13.0, getConfigValueByName(name));
 	}
 }
+
+TEST(LuaBasic, configLookupBySlot) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	int slot = getConfigSlotByHash(djb2lowerCase("launchRpm"));
+	ASSERT_TRUE(slot >= 0);
+	engineConfiguration->launchRpm = 123;
+	ASSERT_EQ(123.0, getConfigValueBySlot(slot));
+	ASSERT_EQ(123.0, getConfigValueByHash(djb2lowerCase("LAUNCHRPM")));
+
+	ASSERT_NE(slot, getConfigSlotByHash(djb2lowerCase("maxAcTps")));
+	ASSERT_EQ(-1, getConfigSlotByHash(djb2lowerCase("noSuchCalibration")));
+}
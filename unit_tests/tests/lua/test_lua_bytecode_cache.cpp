@@ -0,0 +1,70 @@
+#include "pch.h"
+#include "rusefi_lua.h"
+#include "lua_bytecode_cache.h"
+
+TEST(LuaBytecodeCache, SecondLoadSkipsParser) {
+	auto script = R"(
+		local offset = 3
+		function testFunc()
+			return offset + 0.5
+		end
+	)";
+
+	EXPECT_FLOAT_EQ(3.5f, testLuaReturnsNumber(script));
+	EXPECT_GT(luaBytecodeCacheSize(), 0u);
+	uint32_t hits = luaBytecodeCacheHitCount();
+
+	// locals and upvalues survive the dump
+	EXPECT_FLOAT_EQ(3.5f, testLuaReturnsNumber(script));
+	EXPECT_EQ(hits + 1, luaBytecodeCacheHitCount());
+}
+
+TEST(LuaBytecodeCache, ChangedScriptIsParsed) {
+	auto script = R"(
+		function testFunc()
+			return 11
+		end
+	)";
+	auto otherScript = R"(
+		function testFunc()
+			return 12
+		end
+	)";
+
+	EXPECT_EQ(11, testLuaReturnsInteger(script));
+	uint32_t hits = luaBytecodeCacheHitCount();
+
+	EXPECT_EQ(12, testLuaReturnsInteger(otherScript));
+	EXPECT_EQ(hits, luaBytecodeCacheHitCount());
+
+	// cache only remembers the most recent script
+	EXPECT_EQ(11, testLuaReturnsInteger(script));
+	EXPECT_EQ(hits, luaBytecodeCacheHitCount());
+	EXPECT_EQ(11, testLuaReturnsInteger(script));
+	EXPECT_EQ(hits + 1, luaBytecodeCacheHitCount());
+}
+
+TEST(LuaBytecodeCache, SyntaxErrorIsNotCached) {
+	auto script = R"(
+		function testFunc()
+			return 1 +
+		end
+	)";
+
+	EXPECT_ANY_THROW(testLuaReturnsInteger(script));
+	uint32_t hits = luaBytecodeCacheHitCount();
+	EXPECT_ANY_THROW(testLuaReturnsInteger(script));
+	EXPECT_EQ(hits, luaBytecodeCacheHitCount());
+}
+
+TEST(LuaBytecodeCache, RuntimeErrorOfCachedChunk) {
+	// top level code of a cached chunk runs on every load
+	auto script = R"(
+		error("from top level")
+	)";
+
+	EXPECT_ANY_THROW(testLuaExecString(script));
+	uint32_t hits = luaBytecodeCacheHitCount();
+	EXPECT_ANY_THROW(testLuaExecString(script));
+	EXPECT_EQ(hits + 1, luaBytecodeCacheHitCount());
+}
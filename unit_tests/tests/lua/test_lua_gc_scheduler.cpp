@@ -0,0 +1,61 @@
+#include "pch.h"
+#include "rusefi_lua.h"
+#include "lua_gc_scheduler.h"
+
+static void makeGarbage(lua_State* l, int count) {
+	lua_pushinteger(l, count);
+	lua_setglobal(l, "garbageCount");
+	ASSERT_EQ(0, luaL_dostring(l, R"(
+		for i = 1, garbageCount do
+			local t = { i, i + 1 }
+		end
+	)"));
+}
+
+TEST(LuaGcScheduler, TakesOverFromAutomaticCollector) {
+	LuaHandle ls = luaL_newstate();
+	LuaGcScheduler gc;
+	gc.start(ls);
+
+	EXPECT_EQ(0, lua_gc(ls, LUA_GCISRUNNING));
+	EXPECT_EQ(1u, gc.getCompletedCycles());
+	EXPECT_EQ(LuaGcScheduler::heapBytes(ls), gc.getHeapAfterGc());
+
+	// nothing to collect yet
+	EXPECT_EQ(0, gc.onIdle(ls, 100));
+	EXPECT_FALSE(gc.isCycleRunning());
+}
+
+TEST(LuaGcScheduler, StepsStopAtEndOfCycle) {
+	LuaHandle ls = luaL_newstate();
+	LuaGcScheduler gc;
+	gc.start(ls);
+	size_t baseline = gc.getHeapAfterGc();
+
+	makeGarbage(ls, 5000);
+	size_t withGarbage = LuaGcScheduler::heapBytes(ls);
+	EXPECT_GT(withGarbage, baseline * 2);
+
+	// virtual time does not move while stepping so budget is never spent, steps stop at end of cycle
+	gc.onIdle(ls, 1);
+	EXPECT_FALSE(gc.isCycleRunning());
+	EXPECT_EQ(2u, gc.getCompletedCycles());
+	EXPECT_LT(gc.getHeapAfterGc(), withGarbage / 2);
+
+	// no new garbage, no new cycle
+	gc.onIdle(ls, 100000);
+	EXPECT_FALSE(gc.isCycleRunning());
+	EXPECT_EQ(2u, gc.getCompletedCycles());
+}
+
+TEST(LuaGcScheduler, ZeroBudgetRestoresAutomaticCollector) {
+	LuaHandle ls = luaL_newstate();
+	LuaGcScheduler gc;
+	gc.start(ls);
+
+	EXPECT_EQ(0, gc.onIdle(ls, 0));
+	EXPECT_EQ(1, lua_gc(ls, LUA_GCISRUNNING));
+
+	gc.onIdle(ls, 100);
+	EXPECT_EQ(0, lua_gc(ls, LUA_GCISRUNNING));
+}
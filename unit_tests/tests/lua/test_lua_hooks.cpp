@@ -34,6 +34,28 @@ TEST(LuaHooks, TestGetCalibration) {
 	EXPECT_EQ(testLuaReturnsNumber(sourceCode), 550);
 }
 
+TEST(LuaHooks, TestGetCalibrationByHandle) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	const char* sourceCode = R"(
+
+	function testFunc()
+		local handle = getCalibrationHandle("cranking.rpm")
+		return getCalibrationByHandle(handle)
+	end
+
+	)";
+	EXPECT_EQ(testLuaReturnsNumber(sourceCode), 550);
+
+	const char* unknownName = R"(
+
+	function testFunc()
+		return getCalibrationHandle("noSuchCalibration")
+	end
+
+	)";
+	EXPECT_FALSE(testLuaReturnsNumberOrNil(unknownName).has_value());
+}
+
 TEST(LuaHooks, TestSetCalibration) {
 	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
 		const char* sourceCode = R"(
@@ -0,0 +1,243 @@
+#include "pch.h"
+#include "lua_slab.h"
+
+namespace {
+	// page pool standing in for ChibiOS heaps
+	constexpr int poolPages = LUA_SLAB_MAX_PAGES + 4;
+	alignas(LUA_SLAB_PAGE_SIZE) uint8_t pool[poolPages][LUA_SLAB_PAGE_SIZE];
+	bool poolUsed[poolPages];
+	int poolAllocCounter;
+
+	void* poolAlloc(size_t size, size_t alignment) {
+		EXPECT_EQ(LUA_SLAB_PAGE_SIZE, size);
+		EXPECT_EQ(LUA_SLAB_PAGE_SIZE, alignment);
+		for (int i = 0; i < poolPages; i++) {
+			if (!poolUsed[i]) {
+				poolUsed[i] = true;
+				poolAllocCounter++;
+				return pool[i];
+			}
+		}
+		return nullptr;
+	}
+
+	void poolFree(void* page) {
+		for (int i = 0; i < poolPages; i++) {
+			if (pool[i] == page) {
+				EXPECT_TRUE(poolUsed[i]);
+				poolUsed[i] = false;
+				return;
+			}
+		}
+		FAIL() << "not a pool page";
+	}
+
+	int poolPagesInUse() {
+		int result = 0;
+		for (int i = 0; i < poolPages; i++) {
+			result += poolUsed[i] ? 1 : 0;
+		}
+		return result;
+	}
+
+	class LuaSlab : public ::testing::Test {
+	protected:
+		void SetUp() override {
+			memset(poolUsed, 0, sizeof(poolUsed));
+			poolAllocCounter = 0;
+		}
+
+		LuaSlabAllocator slab{poolAlloc, poolFree};
+	};
+}
+
+TEST_F(LuaSlab, sizeClasses) {
+	EXPECT_EQ(-1, LuaSlabAllocator::getSizeClass(0));
+	EXPECT_EQ(0, LuaSlabAllocator::getSizeClass(1));
+	EXPECT_EQ(0, LuaSlabAllocator::getSizeClass(16));
+	EXPECT_EQ(1, LuaSlabAllocator::getSizeClass(17));
+	EXPECT_EQ(3, LuaSlabAllocator::getSizeClass(40));
+	EXPECT_EQ(LUA_SLAB_CLASS_COUNT - 1, LuaSlabAllocator::getSizeClass(LUA_SLAB_MAX_SIZE));
+	EXPECT_EQ(-1, LuaSlabAllocator::getSizeClass(LUA_SLAB_MAX_SIZE + 1));
+
+	for (size_t size = 1; size <= LUA_SLAB_MAX_SIZE; size++) {
+		int sizeClass = LuaSlabAllocator::getSizeClass(size);
+		EXPECT_GE(LuaSlabAllocator::getClassSlotSize(sizeClass), size);
+		if (sizeClass > 0) {
+			// smallest class which fits
+			EXPECT_LT(LuaSlabAllocator::getClassSlotSize(sizeClass - 1), size);
+		}
+	}
+}
+
+TEST_F(LuaSlab, largeObjectsAreNotOurs) {
+	EXPECT_EQ(nullptr, slab.alloc(LUA_SLAB_MAX_SIZE + 1));
+	EXPECT_EQ(0, poolAllocCounter);
+
+	uint8_t notSlab[16];
+	EXPECT_FALSE(slab.owns(notSlab));
+}
+
+TEST_F(LuaSlab, slotsAndPages) {
+	size_t capacity = LuaSlabAllocator::getClassCapacity(0);
+	std::vector<void*> slots;
+
+	for (size_t i = 0; i < capacity + 1; i++) {
+		void* slot = slab.alloc(10);
+		ASSERT_NE(nullptr, slot);
+		ASSERT_TRUE(slab.owns(slot));
+		EXPECT_EQ(16u, slab.getSlotSize(slot));
+		memset(slot, 0xAA, 10);
+		slots.push_back(slot);
+	}
+	// second page for the slot which did not fit the first one
+	EXPECT_EQ(2u, slab.getPageCount());
+
+	auto stats = slab.getClassStats(0);
+	EXPECT_EQ(2u, stats.pages);
+	EXPECT_EQ(capacity + 1, stats.usedSlots);
+	EXPECT_EQ(2 * capacity, stats.totalSlots);
+	EXPECT_EQ(10 * (capacity + 1), stats.requestedBytes);
+	EXPECT_EQ(16 * (capacity + 1), slab.usedBytes());
+
+	// freed slot is reused
+	void* freed = slots[3];
+	slab.free(freed, 10);
+	EXPECT_EQ(freed, slab.alloc(10));
+
+	// second page is empty but kept for the next allocation
+	slab.free(slots.back(), 10);
+	slots.pop_back();
+	EXPECT_EQ(2u, slab.getPageCount());
+	EXPECT_EQ(2, poolPagesInUse());
+
+	// first page is the second empty page of this class, it goes back
+	for (void* slot : slots) {
+		slab.free(slot, 10);
+	}
+	EXPECT_EQ(1u, slab.getPageCount());
+	EXPECT_EQ(1, poolPagesInUse());
+	EXPECT_EQ(0u, slab.usedBytes());
+	EXPECT_EQ(0u, slab.getClassStats(0).requestedBytes);
+
+	EXPECT_EQ(1u, slab.releaseEmptyPages());
+	EXPECT_EQ(0u, slab.getPageCount());
+	EXPECT_EQ(0, poolPagesInUse());
+}
+
+TEST_F(LuaSlab, emptyPageIsKept) {
+	for (int i = 0; i < 10; i++) {
+		void* slot = slab.alloc(10);
+		ASSERT_NE(nullptr, slot);
+		slab.free(slot, 10);
+	}
+	EXPECT_EQ(1, poolAllocCounter);
+	EXPECT_EQ(1u, slab.getPageCount());
+
+	// one empty page per class
+	void* small = slab.alloc(10);
+	void* large = slab.alloc(LUA_SLAB_MAX_SIZE);
+	slab.free(small, 10);
+	slab.free(large, LUA_SLAB_MAX_SIZE);
+	EXPECT_EQ(2u, slab.getPageCount());
+	EXPECT_EQ(2, poolAllocCounter);
+
+	EXPECT_EQ(2u, slab.releaseEmptyPages());
+	EXPECT_EQ(0, poolPagesInUse());
+	EXPECT_EQ(0u, slab.releaseEmptyPages());
+}
+
+TEST_F(LuaSlab, releaseAll) {
+	void* first = slab.alloc(10);
+	slab.alloc(10);
+	slab.alloc(LUA_SLAB_MAX_SIZE);
+	slab.free(first, 10);
+	EXPECT_EQ(2, poolPagesInUse());
+
+	// slots still in use do not keep pages
+	slab.releaseAll();
+	EXPECT_EQ(0, poolPagesInUse());
+	EXPECT_EQ(0u, slab.getPageCount());
+	EXPECT_EQ(0u, slab.usedBytes());
+	EXPECT_FALSE(slab.owns(first));
+
+	ASSERT_NE(nullptr, slab.alloc(10));
+	EXPECT_EQ(1, poolPagesInUse());
+}
+
+TEST_F(LuaSlab, resizeWithinClass) {
+	void* slot = slab.alloc(20);
+	EXPECT_TRUE(slab.resize(slot, 20, 24));
+	EXPECT_FALSE(slab.resize(slot, 24, 25));
+	EXPECT_EQ(24u, slab.getClassStats(1).requestedBytes);
+	slab.free(slot, 24);
+	EXPECT_EQ(0u, slab.getClassStats(1).requestedBytes);
+}
+
+TEST_F(LuaSlab, pageLimit) {
+	std::vector<void*> slots;
+	while (void* slot = slab.alloc(LUA_SLAB_MAX_SIZE)) {
+		slots.push_back(slot);
+	}
+
+	// pool still has pages but slab is at its limit, caller falls back to heap
+	EXPECT_EQ((size_t)LUA_SLAB_MAX_PAGES, slab.getPageCount());
+	EXPECT_EQ(LUA_SLAB_MAX_PAGES * LuaSlabAllocator::getClassCapacity(LUA_SLAB_CLASS_COUNT - 1), slots.size());
+
+	// page ownership survives removals from page table
+	for (size_t i = 0; i < slots.size(); i += 2) {
+		slab.free(slots[i], LUA_SLAB_MAX_SIZE);
+	}
+	for (size_t i = 1; i < slots.size(); i += 2) {
+		EXPECT_TRUE(slab.owns(slots[i]));
+	}
+	for (size_t i = 1; i < slots.size(); i += 2) {
+		slab.free(slots[i], LUA_SLAB_MAX_SIZE);
+	}
+	EXPECT_EQ(1, poolPagesInUse());
+}
+
+TEST_F(LuaSlab, churnKeepsData) {
+	struct Object {
+		uint8_t* ptr;
+		size_t size;
+		uint8_t fill;
+	};
+	std::vector<Object> objects;
+	uint32_t seed = 12345;
+	auto next = [&seed]() {
+		seed = seed * 1103515245 + 12345;
+		return seed >> 16;
+	};
+
+	for (int i = 0; i < 20000; i++) {
+		if (objects.empty() || next() % 100 < 55) {
+			size_t size = 1 + next() % LUA_SLAB_MAX_SIZE;
+			auto ptr = static_cast<uint8_t*>(slab.alloc(size));
+			if (ptr == nullptr) {
+				continue;
+			}
+			uint8_t fill = next();
+			memset(ptr, fill, size);
+			objects.push_back({ ptr, size, fill });
+		} else {
+			size_t index = next() % objects.size();
+			Object object = objects[index];
+			objects[index] = objects.back();
+			objects.pop_back();
+
+			for (size_t j = 0; j < object.size; j++) {
+				ASSERT_EQ(object.fill, object.ptr[j]);
+			}
+			slab.free(object.ptr, object.size);
+		}
+	}
+
+	for (auto& object : objects) {
+		slab.free(object.ptr, object.size);
+	}
+	EXPECT_LE(slab.getPageCount(), (size_t)LUA_SLAB_CLASS_COUNT);
+	slab.releaseEmptyPages();
+	EXPECT_EQ(0u, slab.getPageCount());
+	EXPECT_EQ(0, poolPagesInUse());
+}
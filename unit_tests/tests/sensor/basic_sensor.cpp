@@ -139,3 +139,44 @@ TEST_F(SensorBasic, FindByName) {
 	ASSERT_EQ(SensorType::Clt, findSensorTypeByName("Clt"));
 	ASSERT_EQ(SensorType::Clt, findSensorTypeByName("cLT"));
 }
+
+TEST_F(SensorBasic, SnapshotIsPublishedCopy) {
+	MockSensor clt(SensorType::Clt);
+	MockSensor tps(SensorType::Tps1);
+	ASSERT_TRUE(clt.Register());
+	ASSERT_TRUE(tps.Register());
+
+	clt.set(75);
+	tps.invalidate();
+	Sensor::setMockValue(SensorType::Map, 101);
+	Sensor::publishSnapshot();
+
+	// later changes are not visible until the next publish
+	clt.set(80);
+	tps.set(20);
+
+	SensorSnapshot snapshot;
+	Sensor::getSnapshot(snapshot);
+
+	EXPECT_FLOAT_EQ(75, snapshot.get(SensorType::Clt).Value);
+	EXPECT_FALSE(snapshot.get(SensorType::Tps1).Valid);
+	EXPECT_FLOAT_EQ(101, snapshot.getOrZero(SensorType::Map));
+	// never registered
+	auto iat = snapshot.get(SensorType::Iat);
+	EXPECT_FALSE(iat.Valid);
+	EXPECT_EQ(UnexpectedCode::Configuration, iat.Code);
+
+	Sensor::publishSnapshot();
+	Sensor::getSnapshot(snapshot);
+	EXPECT_FLOAT_EQ(80, snapshot.get(SensorType::Clt).Value);
+	EXPECT_FLOAT_EQ(20, snapshot.get(SensorType::Tps1).Value);
+
+	// the other buffer of the pair holds consistent values too
+	clt.unregister();
+	Sensor::publishSnapshot();
+	Sensor::getSnapshot(snapshot);
+	EXPECT_FALSE(snapshot.get(SensorType::Clt).Valid);
+	EXPECT_FLOAT_EQ(20, snapshot.get(SensorType::Tps1).Value);
+
+	Sensor::resetAllMocks();
+}
@@ -0,0 +1,55 @@
+#include "pch.h"
+#include "engine_benchmark.h"
+
+static std::vector<EngineBenchmarkPoint> runShortSweep() {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	EngineBenchmarkConfig config;
+	config.rpmFrom = 2000;
+	config.rpmTo = 4000;
+	config.rpmStep = 2000;
+	config.revolutions = 20;
+	config.warmupRevolutions = 10;
+
+	EngineBenchmark benchmark(eth, config);
+	EXPECT_TRUE(benchmark.configure());
+	return benchmark.sweep();
+}
+
+TEST(EngineBenchmark, sweep) {
+	auto points = runShortSweep();
+	ASSERT_EQ(2u, points.size());
+
+	for (const auto& point : points) {
+		// 60-2 wheel, both edges of 58 teeth
+		EXPECT_NEAR(20 * 58 * 2, point.teeth, 2 * 2) << point.rpm;
+		EXPECT_NEAR(20, point.revolutions, 0.1) << point.rpm;
+		EXPECT_EQ(0u, point.triggerErrors) << point.rpm;
+		EXPECT_GT(point.eventsPerRevolution, 0) << point.rpm;
+		EXPECT_GT(point.maxQueueDepth, 0) << point.rpm;
+		EXPECT_GT(point.toothNs, 0) << point.rpm;
+	}
+	EXPECT_EQ(2000, points[0].rpm);
+	EXPECT_EQ(4000, points[1].rpm);
+}
+
+TEST(EngineBenchmark, deterministic) {
+	auto first = runShortSweep();
+	auto second = runShortSweep();
+	ASSERT_EQ(first.size(), second.size());
+
+	for (size_t i = 0; i < first.size(); i++) {
+		EXPECT_EQ(first[i].teeth, second[i].teeth);
+		EXPECT_EQ(first[i].eventsPerRevolution, second[i].eventsPerRevolution);
+		EXPECT_EQ(first[i].maxQueueDepth, second[i].maxQueueDepth);
+	}
+}
+
+TEST(EngineBenchmark, unsupportedCylinderCount) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	EngineBenchmarkConfig config;
+	config.cylinders = 7;
+	EngineBenchmark benchmark(eth, config);
+	EXPECT_FALSE(benchmark.configure());
+}
@@ -9,6 +9,9 @@
 
 #include "event_queue.h"
 
+#include <algorithm>
+#include <chrono>
+
 static int callbackCounter = 0;
 
 static void callback() {
@@ -101,9 +104,12 @@ TEST(EventQueue, complex) {
 
 	ASSERT_EQ(4, eq.size());
 	ASSERT_EQ(10, eq.getHead()->getMomentNt());
-	ASSERT_EQ(10, eq.getHead()->next->getMomentNt());
-	ASSERT_EQ(11, eq.getHead()->next->next->getMomentNt());
-	ASSERT_EQ(12, eq.getHead()->next->next->next->getMomentNt());
+	ASSERT_EQ(10, eq.getElementAtIndexForUnitText(1)->getMomentNt());
+	ASSERT_EQ(11, eq.getElementAtIndexForUnitText(2)->getMomentNt());
+	ASSERT_EQ(12, eq.getElementAtIndexForUnitText(3)->getMomentNt());
+	// same time: insertion order
+	ASSERT_EQ(&s1, eq.getElementAtIndexForUnitText(0));
+	ASSERT_EQ(&s4, eq.getElementAtIndexForUnitText(1));
 
 	callbackCounter = 0;
 	eq.executeAll(10);
@@ -217,3 +223,124 @@ TEST_F(EventQueueRemoveTest, removeNotPresent) {
 	ASSERT_EQ(&s3, dut.getElementAtIndexForUnitText(2));
 	ASSERT_EQ(nullptr, dut.getElementAtIndexForUnitText(3));
 }
+
+TEST(EventQueue, sameTimeIsFifo) {
+	EventQueue eq;
+	scheduling_s s[10];
+
+	for (size_t i = 0; i < efi::size(s); i++) {
+		eq.insertTask(&s[i], 50, callbackAction);
+	}
+	eq.remove(&s[3]);
+
+	ASSERT_EQ(&s[0], eq.getElementAtIndexForUnitText(0));
+	ASSERT_EQ(&s[4], eq.getElementAtIndexForUnitText(3));
+	ASSERT_EQ(&s[9], eq.getElementAtIndexForUnitText(8));
+	ASSERT_EQ(nullptr, eq.getElementAtIndexForUnitText(9));
+
+	callbackCounter = 0;
+	eq.executeAll(50);
+	ASSERT_EQ(9, callbackCounter);
+	ASSERT_EQ(0, eq.size());
+}
+
+TEST(EventQueue, sameTimeIsFifoBehindEarlierEvent) {
+	EventQueue eq;
+	scheduling_s s1;
+	scheduling_s s2;
+	scheduling_s s3;
+
+	// sorted list used to put s3 in front of s2 here
+	prevValue = 0;
+	eq.insertTask(&s1, 5, action_s::make<orderCallback>(uintptr_t{1}));
+	eq.insertTask(&s2, 10, action_s::make<orderCallback>(uintptr_t{2}));
+	eq.insertTask(&s3, 10, action_s::make<orderCallback>(uintptr_t{3}));
+
+	ASSERT_EQ(&s2, eq.getElementAtIndexForUnitText(1));
+	ASSERT_EQ(&s3, eq.getElementAtIndexForUnitText(2));
+	eq.executeAll(100);
+	ASSERT_EQ(3u, prevValue);
+}
+
+namespace {
+	// reference: the sorted linked list EventQueue used to be
+	struct SortedList {
+		scheduling_s *head = nullptr;
+
+		void assertSorted() const {
+			for (auto current = head; current && current->next; current = current->next) {
+				ASSERT_LE(current->getMomentNt(), current->next->getMomentNt());
+			}
+		}
+
+		void insert(scheduling_s *s, efitick_t timeNt) {
+			s->setMomentNt(timeNt);
+			if (!head || timeNt < head->getMomentNt()) {
+				s->next = head;
+				head = s;
+			} else {
+				scheduling_s *position = head;
+				while (position->next && position->next->getMomentNt() < timeNt) {
+					position = position->next;
+				}
+				s->next = position->next;
+				position->next = s;
+			}
+		}
+	};
+
+	constexpr int maxPending = 64;
+	constexpr int benchmarkRuns = 50;
+
+	// ascending times are the worst case for the list: every insert walks to the tail
+	// descending times are the worst case for the heap: every insert bubbles up to the root
+	// @return worst over queue depth of the best over runs, so that OS noise does not count
+	template<typename TReset, typename TInsert>
+	int64_t worstInsertNs(int pendingCount, bool descending, TReset reset, TInsert insert) {
+		int64_t best[maxPending];
+		std::fill(best, best + maxPending, INT64_MAX);
+
+		for (int run = 0; run < benchmarkRuns; run++) {
+			reset();
+			for (int i = 0; i < pendingCount; i++) {
+				auto start = std::chrono::steady_clock::now();
+				insert(i, descending ? 1000 - i : 1000 + i);
+				auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+				best[i] = std::min<int64_t>(best[i], duration);
+			}
+		}
+
+		return *std::max_element(best, best + pendingCount);
+	}
+}
+
+// wall clock timing, run with --gtest_also_run_disabled_tests
+TEST(EventQueue, DISABLED_insertLatencyBenchmark) {
+	for (int pendingCount : { 8, 32, 64 }) {
+		int64_t listWorst = 0;
+		int64_t queueWorst = 0;
+
+		for (bool descending : { false, true }) {
+			scheduling_s listItems[maxPending];
+			SortedList list;
+			listWorst = std::max(listWorst, worstInsertNs(pendingCount, descending,
+				[&]() { list.head = nullptr; },
+				[&](int i, efitick_t timeNt) { list.insert(&listItems[i], timeNt); }));
+			list.assertSorted();
+
+			scheduling_s queueItems[maxPending];
+			EventQueue eq;
+			// time the queue, not its O(n) unit test self-check
+			eq.validateHeap = false;
+			queueWorst = std::max(queueWorst, worstInsertNs(pendingCount, descending,
+				[&]() { eq.clear(); },
+				[&](int i, efitick_t timeNt) { eq.insertTask(&queueItems[i], timeNt, callbackAction); }));
+			ASSERT_EQ(pendingCount, eq.size());
+			ASSERT_EQ(&queueItems[descending ? pendingCount - 1 : 0], eq.getHead());
+			eq.clear();
+		}
+
+		printf("EventQueue insert worst case with %d pending: list %dns heap %dns\n",
+			pendingCount, (int)listWorst, (int)queueWorst);
+	}
+}
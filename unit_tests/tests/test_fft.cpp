@@ -29,3 +29,47 @@ TEST(knock, fft) {
   ASSERT_NEAR(data.fftBuffer[4].real(), -8960, 1);
 */
 }
+
+static void checkAgainstDft(size_t size) {
+  std::vector<float> input(size);
+  for (size_t i = 0; i < size; i++) {
+    // a couple of tones plus some deterministic noise
+    input[i] = sinf(2 * 3.14159265f * 37 * i / size) + 0.5f * cosf(2 * 3.14159265f * 101 * i / size) + ((i * 7919) % 13) / 13.0f;
+  }
+
+  std::vector<fft::complex_type> output(size);
+  ASSERT_TRUE(fft::fft(input.data(), output.data(), size));
+
+  for (size_t k = 0; k < size; k++) {
+    double re = 0;
+    double im = 0;
+    for (size_t n = 0; n < size; n++) {
+      double angle = -2 * M_PI * k * n / size;
+      re += input[n] * cos(angle);
+      im += input[n] * sin(angle);
+    }
+
+    EXPECT_NEAR(re, output[k].real(), 2e-2) << size << " " << k;
+    EXPECT_NEAR(im, output[k].imag(), 2e-2) << size << " " << k;
+  }
+}
+
+TEST(knock, fftRadix4MatchesDft) {
+  // power of four
+  checkAgainstDft(FFT_SIZE);
+  checkAgainstDft(64);
+}
+
+TEST(knock, fftRadix2MatchesDft) {
+  // not a power of four
+  checkAgainstDft(512);
+  checkAgainstDft(8);
+}
+
+TEST(knock, fftRejectsBadSize) {
+  std::vector<float> input(FFT_MAX_SIZE * 2);
+  std::vector<fft::complex_type> output(FFT_MAX_SIZE * 2);
+
+  EXPECT_FALSE(fft::fft(input.data(), output.data(), 100));
+  EXPECT_FALSE(fft::fft(input.data(), output.data(), FFT_MAX_SIZE * 2));
+}
@@ -118,3 +118,53 @@ TEST(gpioext, testGpioExt) {
 	EXPECT_ANY_THROW(gpiochips_writePad((Gpio)(chip3_base + 16), 1));
 
 }
+
+static int updatecalls = 0;
+// This chip is served by shared gpiochips thread
+class TestChip4 : public GoodChip {
+	int writePad(size_t pin, int value) override {
+		gpiochips_requestUpdate(*this);
+		return 0;
+	}
+
+	int update() override {
+		updatecalls++;
+		return 0;
+	}
+};
+
+static TestChip4 testchip4;
+
+TEST(gpioext, sharedUpdate) {
+	brain_pin_e base = (brain_pin_e)(BRAIN_PIN_ONCHIP_LAST + 1 + 64);
+	testchip4.update_interval_ms = 100;
+	ASSERT_TRUE(gpiochip_register(base, "shared update", testchip4, 8) > 0);
+
+	efitick_t nowNt = MS2NT(5000);
+
+	/* first pass polls every chip */
+	EXPECT_EQ(MS2NT(100), gpiochips_update(nowNt));
+	EXPECT_EQ(1, updatecalls);
+
+	/* nothing written, poll interval not elapsed */
+	EXPECT_EQ(MS2NT(60), gpiochips_update(nowNt + MS2NT(40)));
+	EXPECT_EQ(1, updatecalls);
+
+	/* several writes go out with single update */
+	gpiochips_writePad(base + 1, 1);
+	gpiochips_writePad(base + 7, 0);
+	EXPECT_TRUE(testchip4.update_pending);
+	EXPECT_EQ(MS2NT(100), gpiochips_update(nowNt + MS2NT(50)));
+	EXPECT_EQ(2, updatecalls);
+	EXPECT_FALSE(testchip4.update_pending);
+
+	/* poll interval elapsed */
+	gpiochips_update(nowNt + MS2NT(150));
+	EXPECT_EQ(3, updatecalls);
+
+	/* pins lookup is gone with the chip */
+	EXPECT_EQ(0, gpiochip_unregister(base));
+	EXPECT_TRUE(gpiochips_readPad(base + 1) < 0);
+	gpiochips_update(nowNt + MS2NT(1000));
+	EXPECT_EQ(3, updatecalls);
+}
@@ -1,6 +1,7 @@
 #include "pch.h"
 
 #include "knock_logic.h"
+#include "knock_sample_buffers.h"
 
 struct MockKnockController : public KnockControllerBase {
 	float getKnockThreshold() const override {
@@ -173,3 +174,54 @@ TEST(Knock, FuelTrimReapply) {
 	// Should have no knock retard
 	EXPECT_FLOAT_EQ(dut.getFuelTrimMultiplier(), 1.0);
 }
+
+TEST(Knock, sampleBuffersHandOver) {
+	uint16_t storage[2][10];
+	KnockSampleBuffers<uint16_t, 2> buffers;
+	buffers.init(&storage[0][0], 10);
+
+	auto first = buffers.startSampling();
+	ASSERT_NE(nullptr, first);
+	EXPECT_EQ(&storage[0][0], first->samples);
+	EXPECT_TRUE(buffers.onSamplingComplete());
+	// spurious completion
+	EXPECT_FALSE(buffers.onSamplingComplete());
+
+	// next window is sampled while first one waits for processing
+	auto second = buffers.startSampling();
+	ASSERT_NE(nullptr, second);
+	EXPECT_EQ(&storage[1][0], second->samples);
+	EXPECT_TRUE(buffers.onSamplingComplete());
+
+	// both are waiting, this window is skipped
+	EXPECT_EQ(nullptr, buffers.startSampling());
+
+	// processed in sampling order
+	EXPECT_EQ(first, buffers.findReady());
+	buffers.release(first);
+	EXPECT_EQ(second, buffers.findReady());
+	buffers.release(second);
+	EXPECT_EQ(nullptr, buffers.findReady());
+}
+
+TEST(Knock, sampleBuffersAdcError) {
+	uint16_t storage[2][10];
+	KnockSampleBuffers<uint16_t, 2> buffers;
+	buffers.init(&storage[0][0], 10);
+
+	// many more failed conversions than there are buffers
+	for (int i = 0; i < 10; i++) {
+		ASSERT_NE(nullptr, buffers.startSampling());
+		buffers.onSamplingError();
+		EXPECT_EQ(nullptr, buffers.findReady());
+	}
+
+	// conversion which ended without any callback
+	for (int i = 0; i < 10; i++) {
+		ASSERT_NE(nullptr, buffers.startSampling());
+	}
+
+	ASSERT_NE(nullptr, buffers.startSampling());
+	EXPECT_TRUE(buffers.onSamplingComplete());
+	EXPECT_NE(nullptr, buffers.findReady());
+}
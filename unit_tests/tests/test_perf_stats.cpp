@@ -0,0 +1,38 @@
+#include "pch.h"
+
+TEST(PerfStats, Buckets) {
+	EXPECT_EQ(0u, PerfStatsEntry::getBucket(0));
+	EXPECT_EQ(0u, PerfStatsEntry::getBucket(63));
+	EXPECT_EQ(1u, PerfStatsEntry::getBucket(64));
+	EXPECT_EQ(1u, PerfStatsEntry::getBucket(127));
+	EXPECT_EQ(2u, PerfStatsEntry::getBucket(128));
+	EXPECT_EQ(10u, PerfStatsEntry::getBucket((1 << 16) - 1));
+	EXPECT_EQ(11u, PerfStatsEntry::getBucket(1 << 16));
+	EXPECT_EQ(11u, PerfStatsEntry::getBucket(UINT32_MAX));
+}
+
+TEST(PerfStats, Record) {
+	PerfStatsEntry entry{};
+
+	entry.record(100);
+	EXPECT_EQ(1u, entry.count);
+	EXPECT_EQ(100u, entry.minTicks);
+	EXPECT_EQ(100u, entry.maxTicks);
+
+	entry.record(10);
+	entry.record(5000);
+	EXPECT_EQ(3u, entry.count);
+	EXPECT_EQ(10u, entry.minTicks);
+	EXPECT_EQ(5000u, entry.maxTicks);
+
+	EXPECT_EQ(1u, entry.histogram[0]);
+	EXPECT_EQ(1u, entry.histogram[1]);
+	// 5000 is between 2^12 and 2^13
+	EXPECT_EQ(1u, entry.histogram[7]);
+
+	entry.reset();
+	EXPECT_EQ(0u, entry.count);
+	entry.record(200);
+	EXPECT_EQ(200u, entry.minTicks);
+	EXPECT_EQ(1u, entry.histogram[2]);
+}
@@ -1,6 +1,7 @@
 #include "pch.h"
 #include "tunerstudio.h"
 #include "tunerstudio_io.h"
+#include "live_data.h"
 
 static uint8_t st5TestBuffer[16000];
 
@@ -136,3 +137,71 @@ TEST(TunerstudioCommands, outOfRangeWriteChunkSendsExactlyOneError) {
 
 	EXPECT_EQ(tsState.errorOutOfRange - prevErrors, 1);
 }
+
+static uint16_t packScatterEntry(size_t offset, size_t size) {
+	uint16_t type = size == 1 ? 1 : (size == 2 ? 2 : 3);
+	return (type << 13) | offset;
+}
+
+TEST(TunerstudioCommands, scatterPlanMatchesCopyRange) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	// recognizable live data
+	auto bytes = reinterpret_cast<uint8_t*>(&engine->outputChannels);
+	for (size_t i = 0; i < sizeof(engine->outputChannels); i++) {
+		bytes[i] = i * 7 + 3;
+	}
+
+	FragmentList fragments = getLiveDataFragments();
+	size_t firstFragmentSize = sizeof(engine->outputChannels);
+
+	uint16_t offsets[TS_SCATTER_OFFSETS_COUNT] = {
+		packScatterEntry(4, 4),
+		// next three are adjacent
+		packScatterEntry(100, 2),
+		packScatterEntry(102, 2),
+		packScatterEntry(104, 4),
+		packScatterEntry(20, 1),
+		// crosses the end of output channels
+		packScatterEntry(firstFragmentSize - 2, 4),
+		// adjacent across fragment boundary
+		packScatterEntry(firstFragmentSize + 2, 2),
+		packScatterEntry(4, 4),
+	};
+
+	TsScatterPlan plan;
+	EXPECT_FALSE(plan.isValid());
+	plan.build(offsets, efi::size(offsets), fragments);
+	EXPECT_TRUE(plan.isValid());
+
+	EXPECT_EQ(plan.getTotalSize(), 4u + 2 + 2 + 4 + 1 + 4 + 2 + 4);
+	// adjacent ranges are merged
+	EXPECT_EQ(plan.getSpanCount(), 5u);
+
+	uint8_t expected[64];
+	size_t expectedSize = 0;
+	for (size_t i = 0; i < efi::size(offsets); i++) {
+		uint16_t type = offsets[i] >> 13;
+		if (type == 0) {
+			continue;
+		}
+		size_t size = 1 << (type - 1);
+		copyRange(expected + expectedSize, fragments, offsets[i] & 0x1FFF, size);
+		expectedSize += size;
+	}
+	ASSERT_EQ(expectedSize, plan.getTotalSize());
+
+	uint8_t actual[64];
+	EXPECT_EQ(plan.copy(actual, fragments, 0, expectedSize), expectedSize);
+	EXPECT_EQ(0, memcmp(expected, actual, expectedSize));
+
+	// partial copies as used for chunked responses
+	memset(actual, 0, sizeof(actual));
+	EXPECT_EQ(plan.copy(actual, fragments, 0, 5), 5u);
+	EXPECT_EQ(plan.copy(actual + 5, fragments, 5, 9), 9u);
+	EXPECT_EQ(plan.copy(actual + 14, fragments, 14, 100), expectedSize - 14);
+	EXPECT_EQ(0, memcmp(expected, actual, expectedSize));
+
+	plan.invalidate();
+	EXPECT_FALSE(plan.isValid());
+}
@@ -7,6 +7,8 @@ TESTS_SRC_CPP = \
 	tests/trigger/test_symmetrical_crank.cpp \
 	tests/trigger/test_trigger_decoder.cpp \
 	tests/trigger/test_trigger_decoder_2.cpp \
+	tests/trigger/test_trigger_sync_points.cpp \
+	tests/trigger/test_sync_gap_ratio.cpp \
 	tests/trigger/test_coil.cpp \
 	tests/trigger/test_trigger_noiseless.cpp \
 	tests/trigger/test_trigger_input_adc.cpp \
@@ -117,6 +119,9 @@ TESTS_SRC_CPP = \
 	tests/lua/test_can_filter.cpp \
 	tests/lua/test_lua_vin.cpp \
 	tests/lua/test_lua_debounce.cpp \
+	tests/lua/test_lua_slab.cpp \
+	tests/lua/test_lua_bytecode_cache.cpp \
+	tests/lua/test_lua_gc_scheduler.cpp \
 	tests/test_change_engine_type.cpp \
 	tests/test_big_buffer.cpp \
 	tests/system/test_periodic_thread_controller.cpp \
@@ -140,6 +145,7 @@ TESTS_SRC_CPP = \
 	tests/test_pwm_generator.cpp \
 	tests/test_log_buffer.cpp \
 	tests/test_event_queue.cpp \
+	tests/test_perf_stats.cpp \
 	tests/test_cpp_memory_layout.cpp \
 	tests/test_pid.cpp \
 	tests/test_accel_enrichment.cpp \
@@ -167,7 +173,10 @@ TESTS_SRC_CPP = \
 	tests/test_hpfp_integrated.cpp \
 	tests/test_fuel_math.cpp \
 	tests/test_binary_log.cpp \
+	tests/test_log_replay.cpp \
+	tests/test_engine_benchmark.cpp \
 	tests/binary_log/test_bit_logger_field.cpp \
+	tests/binary_log/test_mlg_delta.cpp \
 	tests/test_dynoview.cpp \
 	tests/test_gpio.cpp \
 	tests/test_limp.cpp \
@@ -195,6 +204,8 @@ TESTS_SRC_CPP = \
 	tests/actuators/boost/test_open_loop_multipliers.cpp \
 	tests/actuators/boost/test_closed_loop_adders.cpp \
 	tests/controllers/can/test_can_rx.cpp \
+	tests/controllers/can/test_can_listener_index.cpp \
+	tests/controllers/can/test_can_hw_filter.cpp \
 	tests/controllers/can/test_can_msg_tx.cpp \
 	tests/controllers/can/test_can_serial.cpp \
 	tests/controllers/can/test_can_wideband.cpp \
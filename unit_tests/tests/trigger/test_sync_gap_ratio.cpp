@@ -0,0 +1,75 @@
+#include "pch.h"
+
+TEST(SyncGapRatio, toothDurationsRingMatchesShift) {
+	ToothDurations ring;
+	ring.reset();
+	uint32_t shifted[GAP_TRACKING_LENGTH + 1] = {};
+
+	for (uint32_t tooth = 1; tooth < 200; tooth++) {
+		uint32_t duration = 1000 + (tooth * 7919) % 3000;
+		ring[0] = duration;
+		shifted[0] = duration;
+
+		for (int i = 0; i <= GAP_TRACKING_LENGTH; i++) {
+			ASSERT_EQ(shifted[i], ring[i]) << "tooth " << tooth << " age " << i;
+		}
+
+		ring.advance();
+		for (int i = GAP_TRACKING_LENGTH; i > 0; i--) {
+			shifted[i] = shifted[i - 1];
+		}
+		// until next tooth current duration still reads the last one
+		ASSERT_EQ(duration, ring[0]);
+		ASSERT_EQ(duration, ring[1]);
+	}
+}
+
+TEST(SyncGapRatio, fixedPointRanges) {
+	TriggerWaveform shape;
+
+	// default is a single 2x gap
+	EXPECT_EQ(0x1u, shape.syncGapCheckMask);
+	EXPECT_EQ((uint32_t)(1.5 * 65536), shape.syncGapRatioFromQ[0]);
+	EXPECT_EQ((uint32_t)(2.5 * 65536), shape.syncGapRatioToQ[0]);
+
+	shape.setTriggerSynchronizationGap3(/*gapIndex*/2, 0.75, 100000);
+	EXPECT_EQ(0x5u, shape.syncGapCheckMask);
+	EXPECT_EQ((uint32_t)(0.75 * 65536), shape.syncGapRatioFromQ[2]);
+	// saturated, effectively no upper limit
+	EXPECT_EQ(UINT32_MAX, shape.syncGapRatioToQ[2]);
+
+	// gap overrides write ranges directly
+	shape.synchronizationRatioFrom[2] = NAN;
+	shape.synchronizationRatioFrom[1] = 0.5;
+	shape.synchronizationRatioTo[1] = 1.5;
+	shape.prepareSyncGapRatios();
+	EXPECT_EQ(0x3u, shape.syncGapCheckMask);
+	EXPECT_EQ((uint32_t)(0.5 * 65536), shape.syncGapRatioFromQ[1]);
+	EXPECT_EQ((uint32_t)(1.5 * 65536), shape.syncGapRatioToQ[1]);
+}
+
+TEST(SyncGapRatio, syncOnMissingTooth) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	eth.setTriggerType(trigger_type_e::TT_TOOTHED_WHEEL_60_2);
+	engineConfiguration->overrideTriggerGaps = true;
+	engineConfiguration->gapTrackingLengthOverride = 2;
+	engineConfiguration->triggerGapOverrideFrom[0] = 2;
+	engineConfiguration->triggerGapOverrideTo[0] = 4;
+	engineConfiguration->triggerGapOverrideFrom[1] = 0.5;
+	engineConfiguration->triggerGapOverrideTo[1] = 1.5;
+	eth.applyTriggerWaveform();
+
+	const TriggerWaveform& shape = engine->triggerCentral.triggerShape;
+	EXPECT_EQ(0x3u, shape.syncGapCheckMask);
+
+	// 2ms per tooth, missing teeth make it a 6ms gap
+	for (int revolution = 0; revolution < 3; revolution++) {
+		for (int tooth = 0; tooth < 58; tooth++) {
+			eth.smartFireRise(tooth == 0 ? 5 : 1);
+			eth.smartFireFall(1);
+		}
+	}
+
+	EXPECT_TRUE(engine->triggerCentral.triggerState.getShaftSynchronized());
+	EXPECT_GE(engine->triggerCentral.triggerState.getSynchronizationCounter(), 1);
+}
@@ -0,0 +1,64 @@
+#include "pch.h"
+#include "trigger_sync_points.h"
+#include "trigger_sync_points_generated.h"
+
+extern TriggerDecoderBase initState;
+
+TEST(TriggerSyncPoint, rememberedWhileShapeIsSame) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	eth.setTriggerType(trigger_type_e::TT_TOOTHED_WHEEL_60_2);
+
+	TriggerWaveform& shape = engine->triggerCentral.triggerShape;
+	ASSERT_FALSE(shape.shapeDefinitionError);
+	int syncIndex = shape.getTriggerWaveformSynchPointIndex();
+
+	// configuration change which re-initializes trigger shapes without touching the primary shape
+	initState.resetState();
+	engineConfiguration->globalTriggerAngleOffset += 10;
+	eth.applyTriggerWaveform();
+	EXPECT_EQ(0, initState.getTotalEventCounter()) << "no simulation expected";
+	EXPECT_EQ(syncIndex, shape.getTriggerWaveformSynchPointIndex());
+
+	// gap override changes what sync point search is looking for
+	engineConfiguration->overrideTriggerGaps = true;
+	engineConfiguration->gapTrackingLengthOverride = 1;
+	engineConfiguration->triggerGapOverrideFrom[0] = 1.5;
+	engineConfiguration->triggerGapOverrideTo[0] = 4;
+	eth.applyTriggerWaveform();
+	EXPECT_NE(0, initState.getTotalEventCounter()) << "simulation expected";
+	EXPECT_FALSE(shape.shapeDefinitionError);
+	EXPECT_EQ(syncIndex, shape.getTriggerWaveformSynchPointIndex());
+}
+
+TEST(TriggerSyncPoint, bakedSkipsSimulation) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+	eth.setTriggerType(trigger_type_e::TT_TOOTHED_WHEEL_60_2);
+
+	TriggerWaveform& shape = engine->triggerCentral.triggerShape;
+	int syncIndex = shape.getTriggerWaveformSynchPointIndex();
+	int bakedIndex = findBakedTriggerSyncPoint(trigger_type_e::TT_TOOTHED_WHEEL_60_2,
+		shape.getSyncFingerprint(trigger_type_e::TT_TOOTHED_WHEEL_60_2));
+	ASSERT_EQ(syncIndex, bakedIndex);
+
+	useBakedTriggerSyncPoints = true;
+	eth.setTriggerType(trigger_type_e::TT_TOOTHED_WHEEL_36_1);
+	initState.resetState();
+	eth.setTriggerType(trigger_type_e::TT_TOOTHED_WHEEL_60_2);
+	useBakedTriggerSyncPoints = false;
+
+	EXPECT_EQ(0, initState.getTotalEventCounter()) << "no simulation expected";
+	EXPECT_EQ(syncIndex, shape.getTriggerWaveformSynchPointIndex());
+}
+
+TEST(TriggerSyncPoint, bakedTableIsUpToDate) {
+	std::vector<BakedTriggerSyncPoint> simulated = simulateTriggerSyncPoints();
+	ASSERT_FALSE(simulated.empty());
+
+	for (const auto& point : simulated) {
+		EXPECT_EQ(point.syncIndex, findBakedTriggerSyncPoint(point.type, point.fingerprint))
+			<< getTrigger_type_e(point.type) << " changed, run 'make trigger_sync_points'";
+	}
+
+	const BakedTriggerSyncPoint baked[] = { BAKED_TRIGGER_SYNC_POINTS };
+	EXPECT_EQ(efi::size(baked), simulated.size()) << "stale entries, run 'make trigger_sync_points'";
+}
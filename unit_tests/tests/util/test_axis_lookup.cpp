@@ -0,0 +1,115 @@
+#include "pch.h"
+
+#include "axis_lookup.h"
+
+#include <chrono>
+
+namespace {
+	constexpr int trimSize = 4;
+	constexpr int cylinders = 12;
+
+	uint16_t loadBins[trimSize] = { 20, 50, 80, 110 };
+	uint16_t rpmBins[trimSize] = { 1000, 3000, 5000, 7000 };
+	scaled_channel<uint8_t, 1, 50> scaledRpmBins[trimSize] = { 1000, 3000, 5000, 7000 };
+
+	scaled_channel<int8_t, 5, 1> trims[cylinders][trimSize][trimSize];
+
+	void fillTrims() {
+		for (int cyl = 0; cyl < cylinders; cyl++) {
+			for (int r = 0; r < trimSize; r++) {
+				for (int c = 0; c < trimSize; c++) {
+					trims[cyl][r][c] = 0.2f * ((cyl * 7 + r * 5 + c * 3) % 40) - 4;
+				}
+			}
+		}
+	}
+}
+
+TEST(AxisLookup, sameAsInterpolate3d) {
+	fillTrims();
+
+	for (float load : { 0.0f, 20.0f, 35.5f, 80.0f, 109.0f, 200.0f }) {
+		for (float rpm : { 500.0f, 1000.0f, 2222.0f, 6999.0f, 9000.0f }) {
+			auto row = lookupAxis(load, loadBins);
+			auto col = lookupAxis(rpm, rpmBins);
+
+			for (int cyl = 0; cyl < cylinders; cyl++) {
+				EXPECT_NEAR(
+					interpolate3d(trims[cyl], loadBins, load, rpmBins, rpm),
+					interpolate3d(trims[cyl], row, col),
+					1e-4) << load << " " << rpm << " " << cyl;
+			}
+
+			// scaled axis
+			auto scaledCol = lookupAxis(rpm, scaledRpmBins);
+			EXPECT_NEAR(
+				interpolate3d(trims[0], loadBins, load, scaledRpmBins, rpm),
+				interpolate3d(trims[0], row, scaledCol),
+				1e-4);
+		}
+	}
+}
+
+TEST(AxisLookup, cacheFollowsValueAndInvalidation) {
+	AxisLookupCache cache;
+
+	auto a = cache.get(2000, rpmBins);
+	EXPECT_EQ(0u, a.Idx);
+	EXPECT_NEAR(0.5f, a.Frac, 1e-6);
+
+	auto b = cache.get(4000, rpmBins);
+	EXPECT_EQ(1u, b.Idx);
+	EXPECT_NEAR(0.5f, b.Frac, 1e-6);
+
+	// axis edited, same value: stale until invalidated
+	rpmBins[1] = 2000;
+	EXPECT_EQ(1u, cache.get(4000, rpmBins).Idx);
+	cache.invalidate();
+	EXPECT_NEAR(2.0f / 3, cache.get(4000, rpmBins).Frac, 1e-6);
+	rpmBins[1] = 3000;
+}
+
+// wall clock timing, run with --gtest_also_run_disabled_tests
+TEST(AxisLookup, DISABLED_perCylinderTrimsBenchmark) {
+	fillTrims();
+
+	constexpr int callbacks = 20000;
+	float sink = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < callbacks; i++) {
+		float rpm = 800 + (i % 6000);
+		float load = 20 + (i % 90);
+		for (int cyl = 0; cyl < cylinders; cyl++) {
+			// fuel and ignition trims
+			sink += interpolate3d(trims[cyl], loadBins, load, rpmBins, rpm);
+			sink += interpolate3d(trims[cylinders - 1 - cyl], loadBins, load, rpmBins, rpm);
+		}
+	}
+	auto uncached = std::chrono::steady_clock::now() - start;
+
+	AxisLookupCache loadAxis;
+	AxisLookupCache rpmAxis;
+	float cachedSink = 0;
+
+	start = std::chrono::steady_clock::now();
+	for (int i = 0; i < callbacks; i++) {
+		float rpm = 800 + (i % 6000);
+		float load = 20 + (i % 90);
+		loadAxis.invalidate();
+		rpmAxis.invalidate();
+		for (int cyl = 0; cyl < cylinders; cyl++) {
+			cachedSink += interpolate3d(trims[cyl], loadAxis.get(load, loadBins), rpmAxis.get(rpm, rpmBins));
+			cachedSink += interpolate3d(trims[cylinders - 1 - cyl], loadAxis.get(load, loadBins), rpmAxis.get(rpm, rpmBins));
+		}
+	}
+	auto cached = std::chrono::steady_clock::now() - start;
+
+	EXPECT_NEAR(sink, cachedSink, std::abs(sink) * 1e-5 + 1);
+
+	auto toNs = [](auto duration) {
+		return (int)(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / callbacks);
+	};
+	printf("%d cylinder trims per fast callback: interpolate3d %dns cached axes %dns\n",
+		cylinders, toNs(uncached), toNs(cached));
+}
@@ -16,3 +16,34 @@ TEST(util, biQuad) {
 	// very close, but never actually reaches
 	EXPECT_NEAR(filtered, 25.0, 0.1);
 }
+
+TEST(util, biQuadBlockSumSquares) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	Biquad perSample;
+	Biquad block;
+	perSample.configureBandpass(100000, 7000, 3);
+	block.configureBandpass(100000, 7000, 3);
+
+	uint16_t samples[500];
+	for (size_t i = 0; i < efi::size(samples); i++) {
+		samples[i] = 2048 + 1000 * sinf(2 * CONST_PI * 7000 * i / 100000) + (i * 31) % 50;
+	}
+
+	constexpr float offset = 2048;
+	constexpr float ratio = 3.3f / 4095;
+
+	// what knock code used to do: volts, steady state at the middle of the range
+	perSample.cookSteadyState(ratio * offset);
+	float sumSq = 0;
+	for (size_t i = 0; i < efi::size(samples); i++) {
+		float filtered = perSample.filter(ratio * samples[i]);
+		sumSq += filtered * filtered;
+	}
+
+	// raw counts around zero, scaled once
+	block.reset();
+	float blockSumSq = block.filterSumSquares(samples, efi::size(samples), offset) * ratio * ratio;
+
+	EXPECT_NEAR(sumSq, blockSumSq, sumSq * 1e-4);
+}
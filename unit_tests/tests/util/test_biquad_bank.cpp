@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "biquad_bank.h"
+
+#include <chrono>
+
+namespace {
+	// board with lots of analog inputs
+	constexpr size_t channels = 32;
+
+	float sample(size_t channel, int tick) {
+		return 0.1f * channel + 2 + sinf(0.05f * tick + channel) + 0.01f * ((tick * 7 + channel * 3) % 11);
+	}
+
+	void configure(Biquad (&filters)[channels]) {
+		for (size_t i = 0; i < channels; i++) {
+			filters[i].configureLowpass(200, 1 + i % 20);
+		}
+	}
+}
+
+TEST(BiquadBank, sameAsScalar) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	Biquad scalar[channels];
+	configure(scalar);
+
+	BiquadBank<channels> bank;
+	for (size_t i = 0; i < channels; i++) {
+		EXPECT_EQ((int)i, bank.add(scalar[i]));
+	}
+	EXPECT_EQ(channels, bank.size());
+	EXPECT_EQ(-1, bank.add(scalar[0]));
+
+	for (size_t i = 0; i < channels; i++) {
+		scalar[i].cookSteadyState(sample(i, 0));
+		bank.cookSteadyState(i, sample(i, 0));
+	}
+
+	float input[channels];
+	uint8_t active[channels];
+	float output[channels];
+
+	for (int tick = 0; tick < 500; tick++) {
+		for (size_t i = 0; i < channels; i++) {
+			input[i] = sample(i, tick);
+			// every few ticks some channels have no valid reading
+			active[i] = (tick + i) % 13 != 0;
+		}
+
+		bank.filter(input, active, output);
+
+		for (size_t i = 0; i < channels; i++) {
+			if (active[i]) {
+				EXPECT_NEAR(scalar[i].filter(input[i]), output[i], 1e-5);
+			}
+		}
+	}
+
+	// state copied back continues where the bank stopped
+	Biquad restored = scalar[5];
+	restored.reset();
+	bank.storeState(5, restored);
+	EXPECT_NEAR(scalar[5].filter(3), restored.filter(3), 1e-6);
+}
+
+// wall clock timing, run with --gtest_also_run_disabled_tests
+TEST(BiquadBank, DISABLED_benchmark) {
+	EngineTestHelper eth(engine_type_e::TEST_ENGINE);
+
+	constexpr int ticks = 20000;
+
+	Biquad scalar[channels];
+	configure(scalar);
+
+	BiquadBank<channels> bank;
+	for (size_t i = 0; i < channels; i++) {
+		bank.add(scalar[i]);
+	}
+
+	float input[channels];
+	uint8_t active[channels];
+	float output[channels];
+	for (size_t i = 0; i < channels; i++) {
+		input[i] = sample(i, 0);
+		active[i] = 1;
+	}
+
+	float sink = 0;
+	auto start = std::chrono::steady_clock::now();
+	for (int tick = 0; tick < ticks; tick++) {
+		input[tick % channels] += 0.001f;
+		for (size_t i = 0; i < channels; i++) {
+			sink += scalar[i].filter(input[i]);
+		}
+	}
+	auto perFilter = std::chrono::steady_clock::now() - start;
+
+	for (size_t i = 0; i < channels; i++) {
+		input[i] = sample(i, 0);
+	}
+
+	float bankSink = 0;
+	start = std::chrono::steady_clock::now();
+	for (int tick = 0; tick < ticks; tick++) {
+		input[tick % channels] += 0.001f;
+		bank.filter(input, active, output);
+		for (size_t i = 0; i < channels; i++) {
+			bankSink += output[i];
+		}
+	}
+	auto banked = std::chrono::steady_clock::now() - start;
+
+	EXPECT_NEAR(sink, bankSink, std::abs(sink) * 1e-4);
+
+	auto toNs = [](auto duration) {
+		return (int)(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count() / ticks);
+	};
+	printf("%d ADC channels per tick: Biquad::filter %dns BiquadBank %dns\n",
+		(int)channels, toNs(perFilter), toNs(banked));
+}
@@ -0,0 +1,89 @@
+#include "pch.h"
+
+#include "phase_dispatch_table.h"
+
+using Table = PhaseDispatchTable<12>;
+
+TEST(PhaseDispatchTable, onlyNearbyEvents) {
+	Table dut;
+
+	dut.setAngle(0, 5);
+	dut.setAngle(1, 185);
+	dut.setAngle(2, 365);
+	dut.setAngle(3, 545);
+
+	EXPECT_EQ(0b0001u, dut.getCandidates(0, 6));
+	EXPECT_EQ(0b0010u, dut.getCandidates(180, 186));
+	EXPECT_EQ(0b0000u, dut.getCandidates(20, 26));
+	EXPECT_EQ(0b0110u, dut.getCandidates(180, 370));
+	EXPECT_EQ(0b1111u, dut.getAll());
+}
+
+TEST(PhaseDispatchTable, wrapAround) {
+	Table dut;
+
+	dut.setAngle(0, 2);
+	dut.setAngle(1, 718);
+	dut.setAngle(2, 360);
+
+	// [714, 6) wraps around the end of the cycle
+	EXPECT_EQ(0b011u, dut.getCandidates(714, 6));
+	// next == current means whole cycle, same as isPhaseInRange
+	EXPECT_EQ(0b111u, dut.getCandidates(100, 100));
+}
+
+TEST(PhaseDispatchTable, moveAndRemove) {
+	Table dut;
+
+	dut.setAngle(4, 100);
+	EXPECT_EQ(1u << 4, dut.getCandidates(95, 105));
+
+	dut.setAngle(4, 300);
+	EXPECT_EQ(0u, dut.getCandidates(95, 105));
+	EXPECT_EQ(1u << 4, dut.getCandidates(295, 305));
+
+	dut.remove(4);
+	EXPECT_EQ(0u, dut.getAll());
+}
+
+TEST(PhaseDispatchTable, shifted360) {
+	Table dut;
+
+	dut.setAngle(0, 10);
+	dut.setAngle(1, 400);
+
+	EXPECT_EQ(0b01u, dut.getCandidatesShifted360(365, 375));
+	EXPECT_EQ(0b10u, dut.getCandidatesShifted360(35, 45));
+}
+
+TEST(PhaseDispatchTable, candidatesAreSuperset) {
+	Table dut;
+
+	for (size_t i = 0; i < 12; i++) {
+		dut.setAngle(i, i * 61.3f);
+	}
+
+	for (float current = 0; current < 720; current += 1.7f) {
+		float next = current + 6;
+		if (next >= 720) {
+			next -= 720;
+		}
+
+		auto candidates = dut.getCandidates(current, next);
+		for (size_t i = 0; i < 12; i++) {
+			if (isPhaseInRange(i * 61.3f, current, next)) {
+				EXPECT_TRUE(candidates & (1u << i)) << "event " << i << " at " << current;
+			}
+		}
+	}
+}
+
+TEST(PhaseDispatchTable, forEachInIndexOrder) {
+	std::vector<size_t> visited;
+	Table::forEach(0b101001u, [&](size_t i) { visited.push_back(i); });
+
+	ASSERT_EQ(3u, visited.size());
+	EXPECT_EQ(0u, visited[0]);
+	EXPECT_EQ(3u, visited[1]);
+	EXPECT_EQ(5u, visited[2]);
+}
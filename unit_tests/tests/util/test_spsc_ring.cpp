@@ -0,0 +1,107 @@
+#include "pch.h"
+
+#include "spsc_ring.h"
+
+TEST(SpscRing, pushPeekConsume) {
+	int storage[5];
+	SpscRing<int> dut;
+	dut.init(storage, efi::size(storage));
+
+	EXPECT_EQ(4u, dut.capacity());
+	EXPECT_TRUE(dut.isEmpty());
+
+	const int* data;
+	EXPECT_EQ(0u, dut.peek(&data, 10));
+
+	EXPECT_TRUE(dut.push(1));
+	EXPECT_TRUE(dut.push(2));
+	EXPECT_TRUE(dut.push(3));
+	EXPECT_EQ(3u, dut.size());
+
+	// partial read
+	ASSERT_EQ(2u, dut.peek(&data, 2));
+	EXPECT_EQ(1, data[0]);
+	EXPECT_EQ(2, data[1]);
+	dut.consume(1);
+
+	ASSERT_EQ(2u, dut.peek(&data, 10));
+	EXPECT_EQ(2, data[0]);
+	EXPECT_EQ(3, data[1]);
+	dut.consume(2);
+
+	EXPECT_TRUE(dut.isEmpty());
+	EXPECT_EQ(0u, dut.getOverrunCount());
+}
+
+TEST(SpscRing, wrapAround) {
+	int storage[5];
+	SpscRing<int> dut;
+	dut.init(storage, efi::size(storage));
+
+	int out[4];
+	for (int i = 0; i < 3; i++) {
+		dut.push(i);
+	}
+	EXPECT_EQ(3u, dut.read(out, 4));
+
+	// head wraps past the end of storage
+	for (int i = 10; i < 14; i++) {
+		EXPECT_TRUE(dut.push(i));
+	}
+	EXPECT_EQ(4u, dut.size());
+
+	// contiguous run stops at the end of storage
+	const int* data;
+	ASSERT_EQ(2u, dut.peek(&data, 10));
+	EXPECT_EQ(10, data[0]);
+	EXPECT_EQ(11, data[1]);
+
+	// copying read goes across
+	ASSERT_EQ(4u, dut.read(out, 4));
+	EXPECT_EQ(10, out[0]);
+	EXPECT_EQ(11, out[1]);
+	EXPECT_EQ(12, out[2]);
+	EXPECT_EQ(13, out[3]);
+	EXPECT_TRUE(dut.isEmpty());
+}
+
+TEST(SpscRing, overrunKeepsOldest) {
+	int storage[4];
+	SpscRing<int> dut;
+	dut.init(storage, efi::size(storage));
+
+	for (int i = 0; i < 10; i++) {
+		dut.push(i);
+	}
+
+	EXPECT_EQ(3u, dut.size());
+	EXPECT_EQ(7u, dut.getOverrunCount());
+
+	int out[3];
+	ASSERT_EQ(3u, dut.read(out, 3));
+	EXPECT_EQ(0, out[0]);
+	EXPECT_EQ(2, out[2]);
+
+	// room again
+	EXPECT_TRUE(dut.push(42));
+
+	dut.reset();
+	EXPECT_TRUE(dut.isEmpty());
+	EXPECT_EQ(0u, dut.getOverrunCount());
+}
+
+TEST(SpscRing, noStorage) {
+	SpscRing<int> dut;
+	dut.init(nullptr, 0);
+
+	EXPECT_EQ(0u, dut.capacity());
+	EXPECT_FALSE(dut.push(1));
+	EXPECT_EQ(1u, dut.getOverrunCount());
+
+	const int* data;
+	EXPECT_EQ(0u, dut.peek(&data, 10));
+
+	dut.consume(5);
+	EXPECT_TRUE(dut.isEmpty());
+	EXPECT_EQ(0u, dut.size());
+}
@@ -0,0 +1,69 @@
+#include "pch.h"
+
+#include "type_list.h"
+
+namespace {
+struct PhaseModule : public EngineModule {
+	void onEnginePhase(float, efitick_t, angle_t, angle_t) override {
+		phaseCalls++;
+	}
+
+	int phaseCalls = 0;
+};
+
+struct DerivedPhaseModule : public PhaseModule {
+	void onFastCallback() override {
+		fastCalls++;
+	}
+
+	int fastCalls = 0;
+};
+
+struct IdleModule : public EngineModule {
+};
+
+struct MockableModuleBase : public EngineModule {
+	using interface_t = MockableModuleBase;
+
+	void onFastCallback() override {
+		fastCalls++;
+	}
+
+	int fastCalls = 0;
+};
+}
+
+static_assert(overrides_onEnginePhase<PhaseModule>::value);
+static_assert(overrides_onEnginePhase<DerivedPhaseModule>::value);
+static_assert(!overrides_onEnginePhase<IdleModule>::value);
+static_assert(!overrides_onEnginePhase<EngineModule>::value);
+static_assert(!overrides_onSlowCallback<DerivedPhaseModule>::value);
+
+TEST(TypeList, applyIfSkipsDefaultHooks) {
+	type_list<PhaseModule, DerivedPhaseModule, IdleModule, Mockable<MockableModuleBase>, EngineModule> modules;
+
+	static_assert(decltype(modules)::count_if<overrides_onEnginePhase>() == 2);
+	static_assert(decltype(modules)::count_if<overrides_onFastCallback>() == 2);
+	static_assert(decltype(modules)::count_if<overrides_onSlowCallback>() == 0);
+
+	int visited = 0;
+	modules.apply_if<overrides_onEnginePhase>([&](auto& m) {
+		visited++;
+		m.onEnginePhase(1000, 0, 0, 0);
+	});
+	EXPECT_EQ(2, visited);
+	EXPECT_EQ(1, modules.get<PhaseModule>()->phaseCalls);
+	EXPECT_EQ(1, modules.get<DerivedPhaseModule>()->phaseCalls);
+
+	// mockable entries are called unmocked, same as apply_all
+	MockableModuleBase mock;
+	modules.get<MockableModuleBase>().set(&mock);
+	modules.apply_if<overrides_onFastCallback>([](auto& m) { m.onFastCallback(); });
+	EXPECT_EQ(1, modules.get<DerivedPhaseModule>()->fastCalls);
+	EXPECT_EQ(1, modules.get<MockableModuleBase>().unmock().fastCalls);
+	EXPECT_EQ(0, mock.fastCalls);
+
+	visited = 0;
+	modules.apply_if<overrides_onSlowCallback>([&](auto&) { visited++; });
+	EXPECT_EQ(0, visited);
+}
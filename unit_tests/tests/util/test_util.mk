@@ -9,7 +9,12 @@ CPPSRC += 	$(PROJECT_DIR)/../unit_tests/tests/util/test_buffered_writer.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_timer.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_averaging.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_biquad.cpp \
+	$(PROJECT_DIR)/../unit_tests/tests/util/test_biquad_bank.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_lua_biquad.cpp \
 	$(PROJECT_DIR)/../unit_tests/tests/util/test_hash.cpp \
+	$(PROJECT_DIR)/../unit_tests/tests/util/test_phase_dispatch_table.cpp \
+	$(PROJECT_DIR)/../unit_tests/tests/util/test_axis_lookup.cpp \
+	$(PROJECT_DIR)/../unit_tests/tests/util/test_spsc_ring.cpp \
+	$(PROJECT_DIR)/../unit_tests/tests/util/test_type_list.cpp \
 
 INCDIR += $(PROJECT_DIR)/controllers/system